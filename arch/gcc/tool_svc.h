@@ -89,6 +89,18 @@ rel_wai(ID tskid)
 	CAL_SVC_1M(ER, TFN_REL_WAI, ID, tskid);
 }
 
+Inline ER
+chg_dln(ID tskid, RELTIM reldln)
+{
+	CAL_SVC_2M(ER, TFN_CHG_DLN, ID, tskid, RELTIM, reldln);
+}
+
+Inline ER
+ref_stk(ID tskid, T_RSTK *pk_rstk)
+{
+	CAL_SVC_2M(ER, TFN_REF_STK, ID, tskid, T_RSTK *, pk_rstk);
+}
+
 Inline ER
 sus_tsk(ID tskid)
 {
@@ -709,6 +721,42 @@ ref_alm(ID almid, T_RALM *pk_ralm)
 	CAL_SVC_2M(ER, TFN_REF_ALM, ID, almid, T_RALM *, pk_ralm);
 }
 
+Inline ER_UINT
+ref_ost(uint_t objtyp, ID objid, uint_t num, T_ROST *pk_rost)
+{
+	CAL_SVC_4M(ER_UINT, TFN_REF_OST, uint_t, objtyp, ID, objid, uint_t, num, T_ROST *, pk_rost);
+}
+
+Inline ER_UINT
+ref_snp(uint_t objtyp, ID objid, uint_t num, void *pk_rsnp, uint_t *p_snpgen)
+{
+	CAL_SVC_5M(ER_UINT, TFN_REF_SNP, uint_t, objtyp, ID, objid, uint_t, num, void *, pk_rsnp, uint_t *, p_snpgen);
+}
+
+Inline ER
+sig_chn(ID chnid, MODE chnmode)
+{
+	CAL_SVC_2M(ER, TFN_SIG_CHN, ID, chnid, MODE, chnmode);
+}
+
+Inline ER
+wai_chn(ID chnid, MODE chnmode)
+{
+	CAL_SVC_2M(ER, TFN_WAI_CHN, ID, chnid, MODE, chnmode);
+}
+
+Inline ER
+twai_chn(ID chnid, MODE chnmode, TMO tmout)
+{
+	CAL_SVC_3M(ER, TFN_TWAI_CHN, ID, chnid, MODE, chnmode, TMO, tmout);
+}
+
+Inline ER
+ref_chn(ID chnid, T_RCHN *pk_rchn)
+{
+	CAL_SVC_2M(ER, TFN_REF_CHN, ID, chnid, T_RCHN *, pk_rchn);
+}
+
 #ifdef TOPPERS_SUPPORT_SUBPRIO
 Inline ER
 chg_spr(ID tskid, uint_t subpri)
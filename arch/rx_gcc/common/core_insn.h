@@ -93,6 +93,44 @@ set_ipl( uint32_t ipl )
 	set_psw( ( current_psw() & ( ~PSW_IPL_MASK ) ) | ipl );
 }
 
+/*
+ *  FPUステータスレジスタ(FPSW)の現在値の読出し
+ */
+Inline uint32_t
+current_fpsw( void )
+{
+	uint32_t fpsw;
+	Asm("mvfc	fpsw, %0" : "=r"(fpsw));
+	return fpsw;
+}
+
+/*
+ *  アキュムレータ(ACC0)の上位32ビットと中位32ビットの読出し
+ */
+Inline uint32_t
+current_acchi( void )
+{
+	uint32_t acc;
+#if defined(__RXv2__)
+	Asm("mvfachi	#0, A0, %0" : "=r"(acc));
+#else
+	Asm("mvfachi	%0" : "=r"(acc));
+#endif
+	return acc;
+}
+
+Inline uint32_t
+current_accmi( void )
+{
+	uint32_t acc;
+#if defined(__RXv2__)
+	Asm("mvfacmi	#0, A0, %0" : "=r"(acc));
+#else
+	Asm("mvfacmi	%0" : "=r"(acc));
+#endif
+	return acc;
+}
+
 /*
  *  NMIを除くすべての割込みの禁止
  */
@@ -71,6 +71,15 @@
  */
 #define TA_DIRECT		1
 
+/*
+ *  アキュムレータとFPSWの使用に関する属性
+ *
+ *  USE_LAZY_ACCをマクロ定義した場合に，割込みハンドラ，割込みサービス
+ *  ルーチン，タスクの属性に指定できる．
+ */
+#define TA_NOACC		UINT_C(0x0100)		/* アキュムレータを使用しない */
+#define TA_NOFPU		UINT_C(0x0200)		/* FPSWを変更しない */
+
 /*
  *  サポートする機能の定義
  */
@@ -75,6 +75,31 @@ core_initialize(void)
 	sil_wrw_mem((void *)MPU_MPEN_ADDR, 0x1);
 }
 
+#ifdef CHECK_LAZY_ACC
+/*
+ *  アキュムレータとFPSWが変更されていないかのチェック
+ *
+ *  TA_NOACC／TA_NOFPU属性の割込みハンドラが，アキュムレータ／FPSWを変
+ *  更した場合には，カーネルを終了する．
+ */
+void
+check_acc_context(const ACC_CONTEXT *p_accctx, ATR inhatr, INHNO inhno)
+{
+	if ((inhatr & TA_NOACC) != 0U
+			&& (p_accctx->acchi != current_acchi()
+					|| p_accctx->accmi != current_accmi())) {
+		syslog(LOG_EMERG, "Interrupt handler %d with TA_NOACC "
+										"modified the accumulator.", inhno);
+		ext_ker();
+	}
+	if ((inhatr & TA_NOFPU) != 0U && p_accctx->fpsw != current_fpsw()) {
+		syslog(LOG_EMERG, "Interrupt handler %d with TA_NOFPU "
+										"modified FPSW.", inhno);
+		ext_ker();
+	}
+}
+#endif /* CHECK_LAZY_ACC */
+
 #ifndef OMIT_DEFAULT_INT_HANDLER
 /*
  *  未登録の割込みが発生した場合に呼び出される
@@ -61,6 +61,15 @@
  */
 #define TARGET_MEMATR		(TA_KEEP)
 
+/*
+ *  ターゲット依存のタスク／割込みハンドラ／割込みサービスルーチン属性
+ */
+#ifdef USE_LAZY_ACC
+#define TARGET_TSKATR		(TA_NOACC|TA_NOFPU)
+#define TARGET_INHATR		(TA_NOACC|TA_NOFPU)
+#define TARGET_ISRATR		(TA_NOACC|TA_NOFPU)
+#endif /* USE_LAZY_ACC */
+
 /*
  *  エラーチェック方法の指定
  */
@@ -435,6 +444,17 @@ extern void call_exit_kernel(void) NoReturn;
 extern void start_stask_r(void);
 extern void start_utask_r(void);
 
+/*
+ *  セクションの初期化処理（core_support.src）
+ *
+ *  4バイト単位で処理する関数を用いる．
+ */
+#define OMIT_COPY_SECTION
+#define OMIT_ZERO_SECTION
+
+extern void copy_section(void *dst, const void *src, size_t size);
+extern void zero_section(void *dst, size_t size);
+
 #define activate_context(p_tcb)											\
 {																		\
 	(p_tcb)->tskctxb.sp = (void *)((char *)((p_tcb)->p_tinib->sstk)		\
@@ -476,6 +496,37 @@ initialize_exception(void)
 {
 }
 
+/*
+ *  アキュムレータとFPSWの退避の省略
+ *
+ *  USE_LAZY_ACCをマクロ定義すると，TA_NOACC／TA_NOFPU属性の割込みハン
+ *  ドラ（割込みサービスルーチン）の出入口処理で，アキュムレータ／FPSW
+ *  の退避と復帰を省略する．CHECK_LAZY_ACCをマクロ定義すると，これらの
+ *  割込みハンドラがアキュムレータ／FPSWを変更していないかをチェックす
+ *  る．
+ */
+#if defined(USE_LAZY_ACC) && defined(CHECK_LAZY_ACC)
+typedef struct acc_context {
+	uint32_t	fpsw;			/* FPUステータスレジスタ */
+	uint32_t	acchi;			/* アキュムレータの上位32ビット */
+	uint32_t	accmi;			/* アキュムレータの中位32ビット */
+} ACC_CONTEXT;
+
+Inline void
+save_acc_context(ACC_CONTEXT *p_accctx)
+{
+	p_accctx->fpsw = current_fpsw();
+	p_accctx->acchi = current_acchi();
+	p_accctx->accmi = current_accmi();
+}
+
+/*
+ *  アキュムレータとFPSWが変更されていないかのチェック
+ */
+extern void	check_acc_context(const ACC_CONTEXT *p_accctx,
+											ATR inhatr, INHNO inhno);
+#endif /* defined(USE_LAZY_ACC) && defined(CHECK_LAZY_ACC) */
+
 /*
  *  割込みハンドラの入口処理の生成マクロ
  */
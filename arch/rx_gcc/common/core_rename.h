@@ -12,12 +12,15 @@
 #define start_dispatch				_kernel_start_dispatch
 #define start_stask_r				_kernel_start_stask_r
 #define start_utask_r				_kernel_start_utask_r
+#define copy_section				_kernel_copy_section
+#define zero_section				_kernel_zero_section
 
 /*
  *  core_kernel_impl.c
  */
 #define default_exc_handler			_kernel_default_exc_handler
 #define default_int_handler			_kernel_default_int_handler
+#define check_acc_context			_kernel_check_acc_context
 #define intnest						_kernel_intnest
 
 /*
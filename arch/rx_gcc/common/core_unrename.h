@@ -13,12 +13,15 @@
 #undef start_dispatch
 #undef start_stask_r
 #undef start_utask_r
+#undef copy_section
+#undef zero_section
 
 /*
  *  core_kernel_impl.c
  */
 #undef default_exc_handler
 #undef default_int_handler
+#undef check_acc_context
 #undef intnest
 
 /*
@@ -44,6 +44,9 @@
  */
 
 #include "kernel_impl.h"
+#ifdef TOPPERS_BOOT_PROFILE
+#include "target_timer.h"
+#endif /* TOPPERS_BOOT_PROFILE */
 
 /*
  *  割込み要求ラインの属性の設定
@@ -176,3 +179,39 @@ prc_initialize(void)
 	 */
 	sio_initialize();
 }
+
+#ifdef TOPPERS_BOOT_PROFILE
+/*
+ *  カーネル起動時間の計測のための時刻のオフセット
+ */
+uint32_t	prc_bootprof_offset;
+
+/*
+ *  カーネル起動時間の計測の開始
+ *
+ *  dataセクションとbssセクションの初期化前に呼び出されるため，変数を
+ *  参照してはならない．
+ */
+void
+prc_start_boot_profile(void)
+{
+	/*
+	 * モジュールストップ機能の設定
+	 */
+	sil_wrh_mem((void *)SYSTEM_PRCR_ADDR, SYSTEM_PRCR_PRKEY_BITS | SYSTEM_PRCR_PRC1_BIT);	/* 書込み許可 */
+	*SYSTEM_MSTPCRA_ADDR &= ~(SYSTEM_MSTPCRA_MSTPA1_BIT);
+	sil_wrh_mem((void *)SYSTEM_PRCR_ADDR, SYSTEM_PRCR_PRKEY_BITS);	/* 書込み禁止 */
+
+	/*
+	 * フリーランニングで動作開始
+	 *
+	 * クロック選択は，target_hrt_initializeで動作させる時と同じ
+	 * CMTW_DEFAULT_CKS（FREQ_CMTW0に対応）とする．
+	 */
+	*CMTW0_CMWSTR_ADDR &= ~CMTWn_CMWSTR_STR_BIT;
+	*CMTW0_CMWCR_ADDR = (CMTW_DEFAULT_CKS << CMTWn_CMWCR_CKS_SHIFT)
+								| (0x1 << CMTWn_CMWCR_CCLR_SHIFT);
+	*CMTW0_CMWCNT_ADDR = 0U;
+	*CMTW0_CMWSTR_ADDR |= CMTWn_CMWSTR_STR_BIT;
+}
+#endif /* TOPPERS_BOOT_PROFILE */
@@ -123,6 +123,22 @@ probe_int( INTNO intno )
  */
 extern void prc_initialize(void);
 
+#ifdef TOPPERS_BOOT_PROFILE
+/*
+ *  カーネル起動時間の計測のための時刻の取り出し
+ *
+ *  hardware_init_hookからprc_start_boot_profileを呼び出してCMTW0をフ
+ *  リーランニングで動作させ，そのカウント値（FREQ_CMTW0の周期）を起動
+ *  時刻とする．target_hrt_initializeでCMTW0のカウンタがクリアされる際
+ *  に，それまでのカウント値をprc_bootprof_offsetに加算する．
+ */
+extern void		prc_start_boot_profile(void);
+extern uint32_t	prc_bootprof_offset;
+
+#define TARGET_BOOT_PROFILE_TIME() \
+				(prc_bootprof_offset + *CMTW0_CMWCNT_ADDR)
+#endif /* TOPPERS_BOOT_PROFILE */
+
 #endif /* TOPPERS_MACRO_ONLY */
 
 #endif /* TOPPERS_PRC_KERNEL_IMPL_H */
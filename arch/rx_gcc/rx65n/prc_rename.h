@@ -7,6 +7,8 @@
  *  prc_kernel_impl.c
  */
 #define config_int					_kernel_config_int
+#define prc_start_boot_profile		_kernel_prc_start_boot_profile
+#define prc_bootprof_offset			_kernel_prc_bootprof_offset
 
 /*
  *  prc_timer.c
@@ -14,6 +16,8 @@
 #define target_hrt_initialize		_kernel_target_hrt_initialize
 #define target_hrt_terminate		_kernel_target_hrt_terminate
 #define target_hrt_set_event		_kernel_target_hrt_set_event
+#define hrt_near_count				_kernel_hrt_near_count
+#define hrt_late_count				_kernel_hrt_late_count
 #define target_hrt_raise_event		_kernel_target_hrt_raise_event
 #define target_hrt_handler			_kernel_target_hrt_handler
 #define target_twdtimer_initialize	_kernel_target_twdtimer_initialize
@@ -250,6 +250,9 @@ struct sio_port_control_block {
 	bool_t		getready;						/* 文字を受信した状態 */
 	bool_t		putready;						/* 文字を送信できる状態 */
 	bool_t		is_initialized; 				/* デバイス初期化済みフラグ */
+#ifdef USE_SIO_DTC
+	uint32_t	dtcinfo[4];						/* 送信用のDTC転送情報 */
+#endif /* USE_SIO_DTC */
 };
 
 /*
@@ -263,6 +266,27 @@ static SIOPCB	siopcb_table[TNUM_PORT];
 #define INDEX_SIOP(siopid)	 ((uint_t)((siopid) - 1))
 #define get_siopcb(siopid)	 (&(siopcb_table[INDEX_SIOP(siopid)]))
 
+#ifdef USE_SIO_DTC
+/*
+ *  DTCベクタテーブル
+ *
+ *  割込みベクタ番号毎に，転送情報の先頭番地を置く．DTCVBRに設定する
+ *  ため，1Kバイト境界に配置する．
+ */
+static uint32_t	dtc_vector_table[256] __attribute__((aligned(1024)));
+
+/*
+ *  DTC転送情報の設定値（フルアドレスモード）
+ *
+ *  第1ロングワードの上位8ビットがMRA，次の8ビットがMRBで，第4ロング
+ *  ワードの上位16ビットがCRA（ノーマル転送モードでは転送回数）である．
+ */
+#define DTCINFO_MODE	((uint32_t)(DTC_MRA_MD_NORMAL | DTC_MRA_SZ_BYTE \
+									| DTC_MRA_SM_INC) << 24 \
+								| (uint32_t)(DTC_MRB_DM_FIXED) << 16)
+#define DTCINFO_COUNT(cnt)	((uint32_t)(cnt) << 16)
+#endif /* USE_SIO_DTC */
+
 /*
  *  SCIドライバの初期化ルーチン
  *
@@ -377,6 +401,20 @@ sio_initialize(EXINF exinf)
 		}
 	}
 
+#ifdef USE_SIO_DTC
+	/*
+	 *  DTCの初期化（フルアドレスモード，転送情報リードスキップなし）
+	 */
+	sil_wrh_mem((void *)SYSTEM_PRCR_ADDR, SYSTEM_PRCR_PRKEY_BITS | SYSTEM_PRCR_PRC1_BIT);	/* 書込み許可 */
+	sil_wrw_mem((void *)SYSTEM_MSTPCRA_ADDR,
+		sil_rew_mem((void *)SYSTEM_MSTPCRA_ADDR) & ~SYSTEM_MSTPCRA_MSTPA28_BIT);
+	sil_wrh_mem((void *)SYSTEM_PRCR_ADDR, SYSTEM_PRCR_PRKEY_BITS);	/* 書込み禁止 */
+	sil_wrb_mem((void *)DTC_DTCCR_ADDR, 0x00U);
+	sil_wrb_mem((void *)DTC_DTCADMOD_ADDR, 0x00U);
+	sil_wrw_mem((void *)DTC_DTCVBR_ADDR, (uint32_t) dtc_vector_table);
+	sil_wrb_mem((void *)DTC_DTCST_ADDR, DTC_DTCST_DTCST_BIT);
+#endif /* USE_SIO_DTC */
+
 	/*
 	 *  カーネル起動時のバナー出力用の初期化
 	 */
@@ -423,6 +461,9 @@ sio_opn_por(ID siopid, EXINF exinf)
 	p_siopcb->exinf = exinf;
 	p_siopcb->getready = p_siopcb->putready = false;
 	p_siopcb->openflag = true;
+#ifdef USE_SIO_DTC
+	dtc_vector_table[p_siopinib->tx_intno] = (uint32_t)(p_siopcb->dtcinfo);
+#endif /* USE_SIO_DTC */
 
 	/*
 	 *  シリアルI/O割込みのマスクは解除しない
@@ -458,6 +499,9 @@ sio_cls_por(SIOPCB *p_siopcb)
 	 *  デバイス依存のクローズ処理: UART停止
 	 */
 	sil_wrb_mem((void *)p_siopcb->p_siopinib->ctlreg, 0x00U);
+#ifdef USE_SIO_DTC
+	sil_wrb_mem((void *)ICU_DTCERn_ADDR(p_siopcb->p_siopinib->tx_intno), 0x00U);
+#endif /* USE_SIO_DTC */
 
 	p_siopcb->openflag = false;
 	p_siopcb->is_initialized = false;
@@ -518,6 +562,15 @@ sio_snd_chr(SIOPCB *p_siopcb, char c)
 {
 	bool_t ercd = false;
 
+#ifdef USE_SIO_DTC
+	/*
+	 *  DTCによるブロック送信中は，送信レジスタに書き込まない．
+	 */
+	if((sil_reb_mem((void *)ICU_DTCERn_ADDR(p_siopcb->p_siopinib->tx_intno))
+										& ICU_DTCERn_DTCE_BIT) != 0U){
+		return ercd;
+	}
+#endif /* USE_SIO_DTC */
 	if((sil_reb_mem(
 		(void *)p_siopcb->p_siopinib->ssrreg) & SCIn_SSR_TDRE_BIT) != 0){
 		sil_wrb_mem((void *)p_siopcb->p_siopinib->tdreg, (uint8_t)c);
@@ -527,6 +580,50 @@ sio_snd_chr(SIOPCB *p_siopcb, char c)
 	return ercd;
 }
 
+#ifdef USE_SIO_DTC
+/*
+ *  シリアルI/Oポートへのブロック送信
+ *
+ *  bufからlen文字を送信する．送信レジスタが空いていれば先頭の文字を
+ *  ここで書き込み，残りはTXIを起動要因とするDTCで転送する．最後の転
+ *  送の後はTXIがCPUへの割込みとなり，送信レジスタが空いた時点で送信
+ *  可能コールバックが呼ばれる．この関数は，送信可能コールバックが許
+ *  可された状態で，CPUロック状態または送信割込みの処理中に呼び出す．
+ */
+bool_t
+sio_snd_blk(SIOPCB *p_siopcb, const char *buf, uint_t len)
+{
+	const SIOPINIB	*p_siopinib = p_siopcb->p_siopinib;
+
+	if(len == 0U || len > SIO_SNDBLK_MAX
+		|| (sil_reb_mem((void *)ICU_DTCERn_ADDR(p_siopinib->tx_intno))
+										& ICU_DTCERn_DTCE_BIT) != 0U){
+		return false;
+	}
+
+	if((sil_reb_mem((void *)p_siopinib->ssrreg) & SCIn_SSR_TDRE_BIT) != 0U){
+		/*
+		 *  以前に発生したTXIの要求が残っているとDTCが起動されてしまう
+		 *  ため，要求をクリアしてから先頭の文字を書き込む．
+		 */
+		sil_wrb_mem((void *)ICU_IRn_ADDR(p_siopinib->tx_intno), 0x00U);
+		sil_wrb_mem((void *)p_siopinib->tdreg, (uint8_t)(*buf));
+		buf++;
+		len--;
+	}
+
+	if(len > 0U){
+		p_siopcb->dtcinfo[0] = DTCINFO_MODE;
+		p_siopcb->dtcinfo[1] = (uint32_t) buf;
+		p_siopcb->dtcinfo[2] = (uint32_t)(p_siopinib->tdreg);
+		p_siopcb->dtcinfo[3] = DTCINFO_COUNT(len);
+		sil_wrb_mem((void *)ICU_DTCERn_ADDR(p_siopinib->tx_intno),
+												ICU_DTCERn_DTCE_BIT);
+	}
+	return true;
+}
+#endif /* USE_SIO_DTC */
+
 /*
  *  シリアルI/Oポートからの文字受信
  */
@@ -44,6 +44,18 @@
 #ifndef TOPPERS_PRC_SERIAL_H
 #define TOPPERS_PRC_SERIAL_H
 
+/*
+ *  DTCによるブロック送信
+ *
+ *  USE_SIO_DTCをマクロ定義すると，送信バッファ中の連続した文字をDTC
+ *  で転送するブロック送信をサポートし，送信割込みは1ブロックに1回に
+ *  なる．SIO_SNDBLK_MAXは，1回のブロック送信で送る文字数の最大値．
+ */
+#ifdef USE_SIO_DTC
+#define SIO_SUPPORT_SNDBLK
+#define SIO_SNDBLK_MAX	65535U
+#endif /* USE_SIO_DTC */
+
 #ifndef TOPPERS_MACRO_ONLY
 
 /*
@@ -89,6 +101,13 @@ extern bool_t sio_snd_chr(SIOPCB *siopcb, char c);
  */
 extern int_t sio_rcv_chr(SIOPCB *siopcb);
 
+#ifdef SIO_SUPPORT_SNDBLK
+/*
+ *  シリアルI/Oポートへのブロック送信
+ */
+extern bool_t sio_snd_blk(SIOPCB *siopcb, const char *buf, uint_t len);
+#endif /* SIO_SUPPORT_SNDBLK */
+
 /*
  *  シリアルI/Oポートからのコールバックの許可
  */
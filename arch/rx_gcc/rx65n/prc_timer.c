@@ -63,6 +63,9 @@ target_hrt_initialize(EXINF exinf)
 	 * タイマ停止
 	 */
 	*CMTW0_CMWSTR_ADDR &= ~CMTWn_CMWSTR_STR_BIT;
+#ifdef TOPPERS_BOOT_PROFILE
+	prc_bootprof_offset += *CMTW0_CMWCNT_ADDR;
+#endif /* TOPPERS_BOOT_PROFILE */
 
 	/*
  	 * CMWCNTカウンタのクリア禁止 (i.e. Free Running)
@@ -121,9 +124,71 @@ target_hrt_terminate(EXINF exinf)
 	clear_int(INTNO_TIMER_SWI);
 }
 
+#ifdef USE_HRT_ABSOLUTE
+/*
+ *  割込みタイミングの設定が間に合わなかった回数
+ */
+uint_t	hrt_near_count;
+uint_t	hrt_late_count;
+
+#endif /* USE_HRT_ABSOLUTE */
 /*
  *  高分解能タイマへの割込みタイミングの設定
  */
+#ifdef USE_HRT_ABSOLUTE
+
+void
+target_hrt_set_event(HRTCNT hrtcnt)
+{
+	HRTCNT		evtcnt;
+	uint32_t	base, compare, span, elapsed;
+
+	/*
+	 *  hrtcntはcurrent_hrtcntからの相対値であるため，割込みを発生させ
+	 *  る時点のカウント値（絶対値）を求め，CMWCNTの値に変換する．
+	 */
+	evtcnt = current_hrtcnt + hrtcnt;
+	if (evtcnt >= TCYC_HRTCNT) {
+		evtcnt -= TCYC_HRTCNT;
+	}
+	base = HRTCNT_TO_CMWCNT_CEIL(current_hrtcnt);
+	compare = HRTCNT_TO_CMWCNT_CEIL(evtcnt);
+	span = compare - base;
+
+	/*
+	 *  current_hrtcntを読んで以降の経過時間を求め，割込みを発生させる
+	 *  時点までHRT_MIN_LEADより余裕がある場合には，CMWCORを設定するの
+	 *  みとする．
+	 */
+	elapsed = sil_rew_mem((void*)CMTW0_CMWCNT_ADDR) - base;
+	sil_wrw_mem((void*)CMTW0_CMWCOR_ADDR, compare);
+	if (elapsed < span && span - elapsed >= HRTCNT_TO_CMWCNT(HRT_MIN_LEAD)) {
+		return;
+	}
+
+	if (elapsed < span) {
+		/*
+		 *  余裕がない場合には，CMWCORを設定した後にカウント値を読み直
+		 *  し，割込みを発生させる時点を過ぎていた場合には，割込みを発
+		 *  生させる．
+		 */
+		hrt_near_count += 1U;
+		if (sil_rew_mem((void*)CMTW0_CMWCNT_ADDR) - base < span) {
+			return;
+		}
+	}
+
+	/*
+	 *  割込みを発生させる時点を過ぎていた場合には，割込みを発生させる．
+	 */
+	if (!probe_int(INTNO_TIMER)) {
+		hrt_late_count += 1U;
+		raise_int(INTNO_TIMER_SWI);
+	}
+}
+
+#else /* USE_HRT_ABSOLUTE */
+
 void
 target_hrt_set_event(HRTCNT hrtcnt)
 {
@@ -145,6 +210,8 @@ target_hrt_set_event(HRTCNT hrtcnt)
 	}
 }
 
+#endif /* USE_HRT_ABSOLUTE */
+
 /*
  *  タイマ割込みハンドラ
  */
@@ -69,6 +69,18 @@
 #define INTPRI_TWDTIMER	INTPRI_TIMER		/* 割込み優先度 */
 #define INTATR_TWDTIMER	TA_NULL				/* 割込み属性 */
 
+/*
+ *  割込みタイミングの設定に必要な余裕（USE_HRT_ABSOLUTEの場合）
+ *
+ *  高分解能タイマへの割込みタイミングの設定時に，割込みを発生させる時
+ *  点までこの時間（単位はHRTCNTと同じ）以上の余裕がある場合には，カウ
+ *  ント値の読み直しを省略する．CMTW0のカウント値を読んでからCMWCORを
+ *  設定するまでの時間よりも長くしなければならない．
+ */
+#ifndef HRT_MIN_LEAD
+#define HRT_MIN_LEAD	5U
+#endif /* HRT_MIN_LEAD */
+
 #ifndef TOPPERS_MACRO_ONLY
 
 /*
@@ -104,6 +116,18 @@ target_hrt_get_current(void)
  */
 extern void target_hrt_set_event(HRTCNT hrtcnt);
 
+#ifdef USE_HRT_ABSOLUTE
+/*
+ *  割込みタイミングの設定が間に合わなかった回数
+ *
+ *  hrt_near_countは，割込みを発生させる時点までHRT_MIN_LEADより余裕が
+ *  なく，カウント値を読み直した回数．hrt_late_countは，割込みを発生さ
+ *  せる時点を過ぎていたため，ソフトウェア割込みを要求した回数．
+ */
+extern uint_t	hrt_near_count;
+extern uint_t	hrt_late_count;
+#endif /* USE_HRT_ABSOLUTE */
+
 /*
  *  高分解能タイマ割込みの要求
  */
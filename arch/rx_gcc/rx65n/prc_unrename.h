@@ -8,6 +8,8 @@
  *  prc_kernel_impl.c
  */
 #undef config_int
+#undef prc_start_boot_profile
+#undef prc_bootprof_offset
 
 /*
  *  prc_timer.c
@@ -15,6 +17,8 @@
 #undef target_hrt_initialize
 #undef target_hrt_terminate
 #undef target_hrt_set_event
+#undef hrt_near_count
+#undef hrt_late_count
 #undef target_hrt_raise_event
 #undef target_hrt_handler
 #undef target_twdtimer_initialize
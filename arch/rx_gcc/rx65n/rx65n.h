@@ -114,6 +114,7 @@
 #define SYSTEM_MSTPCRA_ADDR			( ( volatile uint32_t __evenaccess * )0x00080010 )
 #define SYSTEM_MSTPCRA_MSTPA0_BIT	( 1UL << 0U )
 #define SYSTEM_MSTPCRA_MSTPA1_BIT	( 1UL << 1U )
+#define SYSTEM_MSTPCRA_MSTPA28_BIT	( 1UL << 28U )
 #define SYSTEM_MSTPCRB_ADDR			( ( volatile uint32_t __evenaccess * )0x00080014 )
 #define SYSTEM_MSTPCRB_MSTPB15_BIT	( 1UL << 15U )
 #define SYSTEM_MSTPCRB_MSTPB25_BIT	( 1UL << 25U )
@@ -157,6 +158,7 @@
 #define ICU_SWINT2R_ADDR		( ( volatile uint8_t __evenaccess * )0x000872E1 )
 #define ICU_IPRr_ADDR(no)		( ( volatile uint8_t __evenaccess * )(0x00087300+(no)) )
 #define ICU_DTCERn_ADDR(no)		( ( volatile uint8_t __evenaccess * )(0x0008711A+(no)-26) )
+#define ICU_DTCERn_DTCE_BIT		( 1UL << 0U )
 #define ICU_IRQCRn_ADDR(no)		( ( volatile uint8_t __evenaccess * )(0x00087500+(no)) )
 #define ICU_IRQCRn_IRQMD_SHIFT	( 2U )
 #define ICU_GRPBL0_ADDR			( ( volatile uint32_t __evenaccess * )(0x00087630) )
@@ -169,6 +171,19 @@
 #define ICU_GENAL1_ADDR			( ( volatile uint32_t __evenaccess * )(0x00087874) )
 #define ICU_GENAL1_EDMAC0_EINT0	( 1UL << 4U )
 
+/*
+ *  DTCモジュール
+ */
+#define DTC_DTCCR_ADDR			( ( volatile uint8_t __evenaccess * )0x00082400 )
+#define DTC_DTCVBR_ADDR			( ( volatile uint32_t __evenaccess * )0x00082404 )
+#define DTC_DTCADMOD_ADDR		( ( volatile uint8_t __evenaccess * )0x00082408 )
+#define DTC_DTCST_ADDR			( ( volatile uint8_t __evenaccess * )0x0008240C )
+#define DTC_DTCST_DTCST_BIT		( 1UL << 0U )
+#define DTC_MRA_SM_INC			( 2UL << 2U )	/* 転送元アドレスを加算 */
+#define DTC_MRA_SZ_BYTE			( 0UL << 4U )	/* バイト転送 */
+#define DTC_MRA_MD_NORMAL		( 0UL << 6U )	/* ノーマル転送モード */
+#define DTC_MRB_DM_FIXED		( 0UL << 2U )	/* 転送先アドレスを固定 */
+
 /*
  *  SCIモジュール
  */
@@ -87,6 +87,18 @@ class GenFile
     puts(@@fileDataHash[@selfFileName])
   end
 
+  # 作成したすべてのファイル名を返す
+  def self.fileNames()
+    return(@@fileDataHash.keys)
+  end
+
+  # 既存のファイルと内容が異なるファイル名のリストを返す
+  def self.changedFiles()
+    return(@@fileDataHash.select { |fileName, fileData|
+      !File.exist?(fileName) || fileData != File.read(fileName)
+    }.keys)
+  end
+
   # 全ファイルを出力する
   def self.output()
     @@fileDataHash.each do |fileName, fileData|
@@ -48,6 +48,7 @@ require "pp"
 require "csv"
 require "optparse"
 require "pstore"
+require "digest"
 require "GenFile.rb"
 require "SRecord.rb"
 
@@ -76,6 +77,9 @@ CFG2_OUT_DB        = "cfg2_out.db"
 # cfg3_out関係
 CFG3_OUT_DB        = "cfg3_out.db"
 
+# パス間キャッシュ関係
+CFG_CACHE_VERSION  = 1
+
 #
 #  エラー発生有無フラグ
 #
@@ -431,6 +435,9 @@ def IncludeTrb(fileName)
   if filePath.nil?
     error_exit("`#{fileName}' not found")
   else
+    if !$cacheFileName.nil?
+      $cacheTrbFiles[filePath] = Digest::SHA256.file(filePath).hexdigest
+    end
     load(filePath)
   end
 end
@@ -516,8 +523,10 @@ end
 #  生成スクリプト（trbファイル）向けの関数
 #
 def SYMBOL(symbol, contFlag = false)
-  if !$romSymbol.nil? && $romSymbol.has_key?($asmLabel + symbol)
-    return $romSymbol[$asmLabel + symbol]
+  value = LookupSymbol(symbol)
+  RecordAccess([ :SYMBOL, symbol, value ])
+  if !value.nil?
+    return value
   elsif contFlag
     return nil
   else
@@ -526,6 +535,33 @@ def SYMBOL(symbol, contFlag = false)
 end
 
 def BCOPY(fromAddress, toAddress, size)
+  RecordAccess([ :BCOPY, fromAddress, toAddress, size ])
+  CopyRomImage(fromAddress, toAddress, size)
+end
+
+def BZERO(address, size)
+  RecordAccess([ :BZERO, address, size ])
+  ZeroRomImage(address, size)
+end
+
+def PEEK(address, size, signed=false)
+  value = PeekRomImage(address, size, signed)
+  RecordAccess([ :PEEK, address, size, signed, value ])
+  return value
+end
+
+#
+#  シンボルファイルとSレコードファイルの操作
+#
+def LookupSymbol(symbol)
+  if !$romSymbol.nil? && $romSymbol.has_key?($asmLabel + symbol)
+    return $romSymbol[$asmLabel + symbol]
+  else
+    return nil
+  end
+end
+
+def CopyRomImage(fromAddress, toAddress, size)
   if !$romImage.nil?
     copyData = $romImage.get_data(fromAddress, size)
     if !copyData.nil?
@@ -534,13 +570,13 @@ def BCOPY(fromAddress, toAddress, size)
   end
 end
 
-def BZERO(address, size)
+def ZeroRomImage(address, size)
   if !$romImage.nil?
     $romImage.set_data(address, "00" * size)
   end
 end
 
-def PEEK(address, size, signed=false)
+def PeekRomImage(address, size, signed)
   if !$romImage.nil?
     return $romImage.get_value(address, size, signed)
   else
@@ -548,6 +584,125 @@ def PEEK(address, size, signed=false)
   end
 end
 
+#
+#  パスの処理結果のキャッシュ
+#
+#  パス3とパス4の処理結果は，パスへの入力（前のパスのデータファイル，
+#  生成スクリプト）と，生成スクリプトがSYMBOL関数，PEEK関数，BCOPY関数，
+#  BZERO関数によって参照したロードモジュールの内容だけで決まる．そこで，
+#  これらの入力のダイジェストと参照の履歴をキャッシュファイルに記録して
+#  おき，次回の処理時に，入力が変化しておらず，参照の履歴を再現した結果
+#  が一致し，前回生成したファイルが変更されていない場合には，生成スクリ
+#  プトの実行を省略する．
+#
+# 生成スクリプトによるロードモジュールの参照を記録する
+def RecordAccess(access)
+  if !$cacheFileName.nil?
+    $cacheAccessLog.push(access)
+  end
+end
+
+# パスへの入力のダイジェストを求める
+def CacheFingerprint(inputDbFileName)
+  digest = Digest::SHA256.new
+  digest << [ CFG_CACHE_VERSION, VERSION, $pass, $kernel,
+				$trbFileNames, $includeDirectories ].inspect
+  if File.exist?(inputDbFileName)
+    digest << Digest::SHA256.file(inputDbFileName).hexdigest
+  end
+  return(digest.hexdigest)
+end
+
+# ファイルのダイジェストを求める（ファイルがない場合はnil）
+def FileDigest(fileName)
+  if File.exist?(fileName)
+    return(Digest::SHA256.file(fileName).hexdigest)
+  else
+    return(nil)
+  end
+end
+
+# 前回の処理結果を再利用できるかをチェックする
+def CheckCache(fingerprint)
+  return(false) if !File.exist?($cacheFileName)
+
+  cache = {}
+  db = PStore.new($cacheFileName)
+  db.transaction(true) do
+    db.roots.each do |key|
+      cache[key] = db[key]
+    end
+  end
+  return(false) if cache[:fingerprint] != fingerprint
+
+  # 生成スクリプトと生成したファイルが変更されていないかのチェック
+  cache[:trbFiles].each do |fileName, digest|
+    return(false) if FileDigest(fileName) != digest
+  end
+  cache[:genFiles].each do |fileName, digest|
+    return(false) if FileDigest(fileName) != digest
+  end
+
+  # ロードモジュールの参照の再現
+  #
+  # 参照の履歴が一致しなかった場合には，パス3／パス4の処理をやり直すた
+  # め，ROMイメージの複製に対して再現し，すべて一致した場合にのみ，グ
+  # ローバル変数を更新する．
+  savedRomImage = $romImage
+  savedAsmLabel = $asmLabel
+  savedEndianLittle = $endianLittle
+  $romImage = Marshal.load(Marshal.dump(savedRomImage))
+  $asmLabel = cache[:asmLabel]
+  $endianLittle = cache[:endianLittle]
+  if !ReplayAccessLog(cache[:accessLog])
+    $romImage = savedRomImage
+    $asmLabel = savedAsmLabel
+    $endianLittle = savedEndianLittle
+    return(false)
+  end
+
+  $timeStampFileName = cache[:timeStampFileName]
+  return(true)
+end
+
+# ロードモジュールの参照の履歴を再現し，結果が一致するかをチェックする
+def ReplayAccessLog(accessLog)
+  accessLog.each do |access|
+    case access[0]
+    when :SYMBOL
+      return(false) if LookupSymbol(access[1]) != access[2]
+    when :PEEK
+      return(false) if PeekRomImage(access[1], access[2], access[3]) \
+																!= access[4]
+    when :BCOPY
+      CopyRomImage(access[1], access[2], access[3])
+    when :BZERO
+      ZeroRomImage(access[1], access[2])
+    else
+      return(false)
+    end
+  end
+  return(true)
+end
+
+# 処理結果をキャッシュファイルに記録する
+def SaveCache(fingerprint, genFileNames)
+  db = PStore.new($cacheFileName)
+  db.transaction do
+    db.roots.each do |key|
+      db.delete(key)
+    end
+    db[:fingerprint] = fingerprint
+    db[:trbFiles] = $cacheTrbFiles
+    db[:genFiles] = genFileNames.map { |fileName|
+								[ fileName, FileDigest(fileName) ] }.to_h
+    db[:accessLog] = $cacheAccessLog
+    db[:asmLabel] = $asmLabel
+    db[:endianLittle] = $endianLittle
+    db[:timeStampFileName] = $timeStampFileName
+  end
+end
+
 #
 #  グローバル変数の初期化
 #
@@ -559,12 +714,19 @@ $apiTableFileNames = []
 $symvalTableFileNames = []
 $romImageFileName = nil
 $romSymbolFileName = nil
+$romImage = nil
+$asmLabel = nil
+$endianLittle = nil
 $idInputFileName = nil
 $idOutputFileName = nil
 $dependencyFileName = nil
 $omitOutputDb = false
 $supportDomain = false
 $supportClass = false
+$cacheFileName = nil
+$cacheTrbFiles = {}
+$cacheAccessLog = []
+$checkConverge = false
 
 #
 #  オプションの処理
@@ -617,6 +779,12 @@ OptionParser.new("Usage: cfg.rb [options] CONFIG-FILE", 40) do |opt|
   opt.on("--enable-class", "enable CLASS support") do
     $supportClass = true
   end
+  opt.on("--cache-file CACHE-FILE", "cache file of pass results") do |val|
+    $cacheFileName = val
+  end
+  opt.on("--converge", "fail if generated files would change") do
+    $checkConverge = true
+  end
   opt.on("-v", "--version", "show version number") do
     puts(opt.ver)
     exit(0)
@@ -649,6 +817,11 @@ if ($pass != "1" && $trbFileNames.empty?)
   abort("`--trb-file' must be specified except in pass 1")
 end
 
+# 処理結果のキャッシュと収束チェックは，パス3とパス4でのみ有効
+if (!$cacheFileName.nil? || $checkConverge) && /^[34]$/ !~ $pass
+  abort("`--cache-file' and `--converge' are valid only in pass 3 and 4")
+end
+
 #
 #  カーネルオプションの処理
 #
@@ -703,6 +876,19 @@ if !$romImageFileName.nil?
   end
 end
 
+#
+#  前回の処理結果を再利用できるかのチェック
+#
+$cacheHit = false
+if !$cacheFileName.nil?
+  $cacheFingerprint = CacheFingerprint(($pass == "3") ? CFG2_OUT_DB \
+														: CFG3_OUT_DB)
+  if CheckCache($cacheFingerprint)
+    puts("[#{File.basename($0)}] Reused the results of pass #{$pass}")
+    $cacheHit = true
+  end
+end
+
 #
 #  パスに従って各処理を実行
 #
@@ -714,9 +900,9 @@ when "2"
   load("pass2.rb")
   Pass2()
 when "3"
-  Pass3()
+  Pass3() if !$cacheHit
 when "4"
-  Pass4()
+  Pass4() if !$cacheHit
 else
   error_exit("invalid pass: #{$pass}")
 end
@@ -731,11 +917,37 @@ if $errorFlag
   end
 end
 
+#
+#  生成するファイルが変化しないことのチェック
+#
+#  メモリ配置の収束チェック（--converge）では，前回のメモリ配置でリンク
+#  したロードモジュールに対して処理を行い，生成するファイルが変化しな
+#  い場合に限って，そのロードモジュールをそのまま用いる．
+#
+if $checkConverge
+  changedFiles = GenFile.changedFiles
+  if !changedFiles.empty?
+    abort("[#{File.basename($0)}] memory layout not converged: " \
+										"#{changedFiles.join(", ")}")
+  end
+end
+
 #
 #  作成したすべてのファイルを出力する
 #
 GenFile.output
 
+#
+#  処理結果をキャッシュファイルに記録する
+#
+if !$cacheFileName.nil? && !$cacheHit
+  genFileNames = GenFile.fileNames
+  if $pass == "3" && !$omitOutputDb
+    genFileNames.push(CFG3_OUT_DB)
+  end
+  SaveCache($cacheFingerprint, genFileNames)
+end
+
 # 
 #  タイムスタンプファイルの生成
 # 
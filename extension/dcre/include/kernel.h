@@ -255,6 +255,13 @@ typedef struct t_rtsk {
 	uint_t	svclevel;	/* 拡張サービスコールのネストレベル */
 } T_RTSK;
 
+typedef struct t_rstk {
+	size_t	sstksz;		/* システムスタック領域のサイズ */
+	size_t	sstkuse;	/* システムスタック領域の最大使用量 */
+	size_t	ustksz;		/* ユーザスタック領域のサイズ */
+	size_t	ustkuse;	/* ユーザスタック領域の最大使用量 */
+} T_RSTK;
+
 typedef struct t_csem {
 	ATR		sematr;		/* セマフォ属性 */
 	uint_t	isemcnt;	/* セマフォの初期資源数 */
@@ -349,6 +356,41 @@ typedef struct t_rmpf {
 						   付けることができる固定長メモリブロックの数 */
 } T_RMPF;
 
+typedef struct t_chnsnd {
+	uint_t	sndcnt;		/* 送信したブロック数の累計 */
+	uint_t	rwait;		/* 受信側に待っているタスクがあることを示すフラグ */
+} T_CHNSND;
+
+typedef struct t_chnrcv {
+	uint_t	rcvcnt;		/* 受信を終えたブロック数の累計 */
+	uint_t	swait;		/* 送信側に待っているタスクがあることを示すフラグ */
+} T_CHNRCV;
+
+typedef struct t_rchn {
+	ID		chnid;		/* チャネルのID番号 */
+	ID		stskid;		/* チャネルの空きブロック待ち行列の先頭のタスク
+						   のID番号 */
+	ID		rtskid;		/* チャネルの受信ブロック待ち行列の先頭のタスク
+						   のID番号 */
+	uint_t	blkcnt;		/* チャネルのブロック数 */
+	uint_t	blksz;		/* チャネルのブロックのサイズ（丸めた値） */
+	void	*chn;		/* チャネル領域の先頭番地 */
+	T_CHNSND *p_chnsnd;	/* 送信側管理領域の先頭番地 */
+	T_CHNRCV *p_chnrcv;	/* 受信側管理領域の先頭番地 */
+} T_RCHN;
+
+typedef struct t_rost {
+	ulong_t	acqcnt;		/* 獲得に成功した回数 */
+	ulong_t	wtcnt;		/* 待ち状態に入った回数 */
+	ulong_t	tmocnt;		/* 待ちがタイムアウトした回数 */
+	uint_t	maxwtcnt;	/* 待ちタスク数の最大値 */
+	RELTIM	maxwttim;	/* 待ち時間の最大値 */
+	SYSTIM	ttlwttim;	/* 待ち時間の累計 */
+	uint_t	maxocc;		/* 使用量の最大値 */
+	SYSTIM	ttlfultim;	/* 満杯であった時間の累計 */
+	SYSTIM	ttlemptim;	/* 空であった時間の累計 */
+} T_ROST;
+
 typedef struct t_ccyc {
 	ATR			cycatr;		/* 周期通知属性 */
 	T_NFYINFO	nfyinfo;	/* 周期通知の通知方法 */
@@ -438,6 +480,7 @@ typedef struct t_rmem {
 
 #define TA_ACT			UINT_C(0x01)	/* タスクを起動された状態で生成 */
 #define TA_NOACTQUE		UINT_C(0x02)	/* 起動要求をキューイングしない */
+#define TA_RSTR			UINT_C(0x04)	/* 制約タスク */
 
 #define TA_TPRI			UINT_C(0x01)	/* タスクの待ち行列を優先度順に */
 
@@ -445,6 +488,7 @@ typedef struct t_rmem {
 #define TA_CLR			UINT_C(0x04)	/* イベントフラグのクリア指定 */
 
 #define TA_CEILING		UINT_C(0x03)	/* 優先度上限プロトコル */
+#define TA_TSKCTX		UINT_C(0x40)	/* タスクコンテキストからのみ操作 */
 
 #define TA_STA			UINT_C(0x02)	/* 周期通知を動作状態で生成 */
 
@@ -461,6 +505,7 @@ typedef struct t_rmem {
 #define TA_USTACK		UINT_C(0x2000)	/* ユーザスタック領域 */
 
 #define TA_NONKERNEL	UINT_C(0x02)	/* カーネル管理外の割込み */
+#define TA_DEFER		UINT_C(0x10)	/* ISRをタスクで遅延実行する */
 
 #define TA_ENAINT		UINT_C(0x01)	/* 割込み要求禁止フラグをクリア */
 #define TA_EDGE			UINT_C(0x02)	/* エッジトリガ */
@@ -499,6 +544,9 @@ typedef struct t_rmem {
 #define TPM_READ		UINT_C(0x02)	/* 読出しアクセス権のチェック */
 #define TPM_EXEC		UINT_C(0x04)	/* 実行アクセス権のチェック */
 
+#define TCHN_SND		UINT_C(0x01)	/* チャネルの送信側 */
+#define TCHN_RCV		UINT_C(0x02)	/* チャネルの受信側 */
+
 /*
  *  通知処理モードの定義
  */
@@ -541,6 +589,8 @@ typedef struct t_rmem {
 #define TTW_SMBF		UINT_C(0x0400)	/* メッセージバッファへの送信待ち */
 #define TTW_RMBF		UINT_C(0x0800)	/* メッセージバッファからの受信待ち */
 #define TTW_MPF			UINT_C(0x2000)	/* 固定長メモリブロックの獲得待ち */
+#define TTW_SCHN		UINT_C(0x4000)	/* チャネルの空きブロック待ち */
+#define TTW_RCHN		UINT_C(0x8000)	/* チャネルの受信ブロック待ち */
 
 #define TCYC_STP		UINT_C(0x01)	/* 周期通知が動作していない */
 #define TCYC_STA		UINT_C(0x02)	/* 周期通知が動作している */
@@ -562,6 +612,15 @@ typedef struct t_rmem {
 
 #define TSK_SELF		0			/* 自タスク指定 */
 #define TSK_NONE		0			/* 該当するタスクがない */
+#define TSK_ISTK		(-1)		/* 非タスクコンテキスト用スタック指定 */
+
+#define TOBJ_SEM		UINT_C(1)	/* セマフォ */
+#define TOBJ_FLG		UINT_C(2)	/* イベントフラグ */
+#define TOBJ_DTQ		UINT_C(3)	/* データキュー */
+#define TOBJ_MTX		UINT_C(4)	/* ミューテックス */
+#define TOBJ_MBF		UINT_C(5)	/* メッセージバッファ */
+#define TOBJ_MPF		UINT_C(6)	/* 固定長メモリプール */
+#define TOBJ_TSK		UINT_C(7)	/* タスク */
 
 #define TPRI_SELF		0			/* 自タスクのベース優先度 */
 #define TPRI_INI		0			/* タスクの起動時優先度 */
@@ -621,6 +680,16 @@ typedef struct t_rmem {
 #define TMAX_TWDTIM		UINT32_MAX
 #endif /* TMAX_TWDTIM */
 
+/*
+ *  相対デッドラインの最大値（単位：μ秒）
+ *
+ *  絶対デッドラインの比較を，イベント時刻の差の符号で行うため，イベン
+ *  ト時刻の周期の半分よりも十分に小さい値とする．
+ */
+#ifndef TMAX_DLNTIM
+#define TMAX_DLNTIM		1000000000U
+#endif /* TMAX_DLNTIM */
+
 /*
  *  メモリ領域確保のためのマクロ
  *
@@ -134,9 +134,70 @@ target_hrt_get_current(void)
 #endif /* TCYC_HRTCNT */
 }
 
+#ifdef USE_HRT_ABSOLUTE
+/*
+ *  割込みタイミングの設定に必要な余裕
+ */
+#ifndef HRT_MIN_LEAD
+#define HRT_MIN_LEAD		5U
+#endif /* HRT_MIN_LEAD */
+
+/*
+ *  割込みタイミングの設定が間に合わなかった回数
+ */
+uint_t	hrt_near_count;
+uint_t	hrt_late_count;
+
+#endif /* USE_HRT_ABSOLUTE */
 /*
  *  高分解能タイマへの割込みタイミングの設定
  */
+#ifdef USE_HRT_ABSOLUTE
+
+void
+target_hrt_set_event(HRTCNT hrtcnt)
+{
+	HRTCNT	current, elapsed;
+
+#ifdef HOOK_HRT_EVENT
+	hook_hrt_set_event(hrtcnt);
+#endif /* HOOK_HRT_EVENT */
+
+	/*
+	 *  current_hrtcntを読んで以降の経過時間を求め，割込みを発生させる
+	 *  時点（current_hrtcntからhrtcnt後）に割込みが発生するように設定
+	 *  する．
+	 */
+	current = target_hrt_get_current();
+	elapsed = current - current_hrtcnt;
+#ifdef TCYC_HRTCNT
+	if (current < current_hrtcnt) {
+		elapsed += TCYC_HRTCNT;
+	}
+#endif /* TCYC_HRTCNT */
+
+	if (elapsed < hrtcnt) {
+		if (hrtcnt - elapsed < HRT_MIN_LEAD) {
+			hrt_near_count += 1U;
+		}
+		hrt_event.enable = true;
+		hrt_event.simtim = truncate_simtim(current_simtim)
+												+ (hrtcnt - elapsed);
+		select_event();
+	}
+	else {
+		/*
+		 *  割込みを発生させる時点を過ぎていた場合
+		 */
+		hrt_late_count += 1U;
+		hrt_event.enable = false;
+		select_event();
+		target_raise_hrt_int();
+	}
+}
+
+#else /* USE_HRT_ABSOLUTE */
+
 void
 target_hrt_set_event(HRTCNT hrtcnt)
 {
@@ -149,6 +210,8 @@ target_hrt_set_event(HRTCNT hrtcnt)
 	select_event();
 }
 
+#endif /* USE_HRT_ABSOLUTE */
+
 /*
  *  高分解能タイマへの割込みタイミングのクリア
  */
@@ -114,6 +114,18 @@ extern ER_UINT	extsvc_simtim_add(intptr_t time, intptr_t par2,
 
 #endif /* TOPPERS_OMIT_TECS */
 
+/*
+ *  割込みタイミングの設定が間に合わなかった回数（USE_HRT_ABSOLUTEの場
+ *  合）
+ */
+#ifdef USE_HRT_ABSOLUTE
+#define hrt_near_count			_kernel_hrt_near_count
+#define hrt_late_count			_kernel_hrt_late_count
+
+extern uint_t	hrt_near_count;
+extern uint_t	hrt_late_count;
+#endif /* USE_HRT_ABSOLUTE */
+
 /*
  *  テストのためのフックルーチン
  */
@@ -0,0 +1,184 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		割込み処理時間計測サービス（非TECS版専用）
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "target_syssvc.h"
+#include "inthist.h"
+
+/*
+ *  高分解能タイマの周期の取得
+ */
+#define target_hrt_get_current		_kernel_target_hrt_get_current
+#include "target_timer.h"
+
+/*
+ *  高分解能タイマのカウント値の差
+ */
+Inline uint_t
+inthist_diff(HRTCNT begin, HRTCNT end)
+{
+	HRTCNT	diff;
+
+	diff = end - begin;
+#ifdef TCYC_HRTCNT
+	if (end < begin) {
+		diff += TCYC_HRTCNT;
+	}
+#endif /* TCYC_HRTCNT */
+	return((uint_t) diff);
+}
+
+/*
+ *  割込み処理時間の記録
+ *
+ *  同じ計測対象に対する記録が入れ子になることはないため，排他制御は行
+ *  わない．
+ */
+void
+inthist_record(uint_t idx, HRTCNT entry, HRTCNT start, HRTCNT end)
+{
+	T_RINTHIST	*p_inthist = &(inthist_table[idx]);
+	uint_t		exetim, lattim;
+
+	exetim = inthist_diff(start, end);
+	lattim = inthist_diff(entry, start);
+
+	if (p_inthist->count == 0U || exetim < p_inthist->mintim) {
+		p_inthist->mintim = exetim;
+	}
+	if (exetim > p_inthist->maxtim) {
+		p_inthist->maxtim = exetim;
+	}
+	if (lattim > p_inthist->maxlat) {
+		p_inthist->maxlat = lattim;
+	}
+	if (exetim <= INTHIST_MAX_TIME) {
+		p_inthist->hist[exetim]++;
+	}
+	else {
+		p_inthist->over++;
+	}
+	p_inthist->count++;
+}
+
+/*
+ *  割込み処理時間の計測結果の参照
+ */
+ER
+_ref_inthist(uint_t idx, T_RINTHIST *pk_rinthist)
+{
+	bool_t	locked;
+	ER		ercd;
+
+	if (idx >= tnum_inthist) {
+		ercd = E_PAR;
+	}
+	else {
+		locked = sns_loc();
+		if (!locked) {
+			(void) loc_cpu();
+		}
+		*pk_rinthist = inthist_table[idx];
+		if (!locked) {
+			(void) unl_cpu();
+		}
+		ercd = E_OK;
+	}
+	return(ercd);
+}
+
+/*
+ *  割込み処理時間の計測結果を出力するタスクの本体
+ *
+ *  INTHIST_INTERVAL毎に，1回以上計測された対象について，計測回数，最
+ *  小／最大処理時間，最大遅延時間と，処理時間の分布を出力する．
+ */
+void
+inthist_task(EXINF exinf)
+{
+	T_RINTHIST	rinthist;
+	uint_t		i, j;
+
+	while (true) {
+		(void) dly_tsk(INTHIST_INTERVAL);
+		for (i = 0; i < tnum_inthist; i++) {
+			(void) _ref_inthist(i, &rinthist);
+			if (rinthist.count == 0U) {
+				continue;
+			}
+			syslog_5(LOG_NOTICE, "%s: count = %d, min = %d, max = %d, "
+							"maxlat = %d", inthist_name_table[i],
+							rinthist.count, rinthist.mintim,
+							rinthist.maxtim, rinthist.maxlat);
+			for (j = 0; j <= INTHIST_MAX_TIME; j++) {
+				if (rinthist.hist[j] > 0) {
+					syslog_2(LOG_NOTICE, "  %d : %d", j, rinthist.hist[j]);
+				}
+			}
+			if (rinthist.over > 0) {
+				syslog_2(LOG_NOTICE, "  > %d : %d",
+										INTHIST_MAX_TIME, rinthist.over);
+			}
+		}
+	}
+}
+
+/*
+ *  割込み処理時間計測サービスのサービスコールを拡張サービスコールとし
+ *  て登録するための関数
+ */
+ER_UINT
+extsvc_ref_inthist(intptr_t idx, intptr_t pk_rinthist, intptr_t par3,
+							intptr_t par4, intptr_t par5, ID cdmid)
+{
+	ER_UINT	ercd;
+
+	if (!EXTSVC_PROBE_MEM_WRITE(pk_rinthist, T_RINTHIST)) {
+		ercd = E_MACV;
+	}
+	else {
+		ercd = _ref_inthist((uint_t) idx, (T_RINTHIST *) pk_rinthist);
+	}
+	return(ercd);
+}
@@ -0,0 +1,157 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		割込み処理時間計測サービス（非TECS版専用）
+ *
+ *  USE_INTHISTをマクロ定義すると，コンフィギュレータは，カーネル管理
+ *  の割込みハンドラとISRの実行前後で高分解能タイマのカウント値を読み
+ *  出し，inthist_recordを呼び出すコードを生成する．このサービスは，そ
+ *  れを集計し，計測結果の参照と，定期的なシステムログへの出力を行う．
+ */
+
+#ifndef TOPPERS_INTHIST_H
+#define TOPPERS_INTHIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <kernel.h>
+#include <extsvc_fncode.h>
+#include "target_syssvc.h"
+
+/*
+ *  割込み処理時間計測サービス関連の定数のデフォルト値の定義
+ */ 
+#ifndef INTHIST_MAX_TIME
+#define INTHIST_MAX_TIME		100		/* 分布を記録する最大時間 */
+#endif /* INTHIST_MAX_TIME */
+
+#ifndef INTHIST_PRIORITY
+#define INTHIST_PRIORITY		TMAX_TPRI	/* 出力タスクの初期優先度 */
+#endif /* INTHIST_PRIORITY */
+
+#ifndef INTHIST_STACK_SIZE
+#define INTHIST_STACK_SIZE		1024	/* 出力タスクのスタック領域のサイズ */
+#endif /* INTHIST_STACK_SIZE */
+
+#ifndef INTHIST_INTERVAL
+#define INTHIST_INTERVAL		10000000U	/* 出力の周期（マイクロ秒）*/
+#endif /* INTHIST_INTERVAL */
+
+#ifndef SSZ_REF_INTHIST
+#define SSZ_REF_INTHIST			1024	/* 拡張サービスコールのスタックサイズ */
+#endif /* SSZ_REF_INTHIST */
+
+/*
+ *  割込み処理時間の計測結果のパケット
+ *
+ *  処理時間と遅延時間の単位は，高分解能タイマのカウント値である．処理
+ *  時間は，割込みハンドラまたはISRの実行時間，遅延時間は，割込みハン
+ *  ドラの実行開始からISRの実行開始までの時間である（DEF_INHで登録した
+ *  割込みハンドラでは0）．
+ */
+typedef struct t_rinthist {
+	uint_t	count;			/* 計測回数 */
+	uint_t	mintim;			/* 最小処理時間 */
+	uint_t	maxtim;			/* 最大処理時間 */
+	uint_t	maxlat;			/* 最大遅延時間 */
+	uint_t	over;			/* INTHIST_MAX_TIMEを超えた度数 */
+	uint_t	hist[INTHIST_MAX_TIME + 1];		/* 処理時間の分布 */
+} T_RINTHIST;
+
+/*
+ *  計測対象の数と計測結果を格納する領域（kernel_cfg.c）
+ */
+extern const uint_t			tnum_inthist;
+extern const char *const	inthist_name_table[];
+extern T_RINTHIST			inthist_table[];
+
+/*
+ *  割込み処理時間の記録
+ *
+ *  コンフィギュレータが生成する割込みハンドラから呼び出す．idxは計測
+ *  対象の番号，entryは割込みハンドラの実行開始時刻，startとendは割込
+ *  みハンドラまたはISRの実行開始時刻と終了時刻である．
+ */
+extern void	inthist_record(uint_t idx, HRTCNT entry,
+									HRTCNT start, HRTCNT end) throw();
+
+/*
+ *  割込み処理時間の計測結果の参照
+ */
+extern ER	_ref_inthist(uint_t idx, T_RINTHIST *pk_rinthist) throw();
+
+/*
+ *  割込み処理時間の計測結果を出力するタスクの本体
+ */
+extern void	inthist_task(EXINF exinf) throw();
+
+/*
+ *  割込み処理時間計測サービスのサービスコールを呼び出すための定義
+ */
+#ifndef TOPPERS_SVC_CALL
+
+Inline ER
+ref_inthist(uint_t idx, T_RINTHIST *pk_rinthist)
+{
+	return((ER) cal_svc(TFN_REF_INTHIST, (intptr_t) idx,
+									(intptr_t) pk_rinthist, 0, 0, 0));
+}
+
+#else /* TOPPERS_SVC_CALL */
+
+#define ref_inthist		_ref_inthist
+
+#endif /* TOPPERS_SVC_CALL */
+
+/*
+ *  割込み処理時間計測サービスのサービスコールを拡張サービスコールとし
+ *  て登録するための関数
+ */
+extern ER_UINT	extsvc_ref_inthist(intptr_t idx, intptr_t pk_rinthist,
+									intptr_t par3, intptr_t par4,
+									intptr_t par5, ID cdmid) throw();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOPPERS_INTHIST_H */
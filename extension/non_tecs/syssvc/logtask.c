@@ -59,7 +59,7 @@
 #endif /* LOGTASK_PORTID */
 
 /*
- *  システムログタスクの動作間隔（μ秒）
+ *  ログ情報をまとめて出力するための待ち時間の上限（μ秒）
  */
 #ifndef LOGTASK_INTERVAL
 #define LOGTASK_INTERVAL	10000U
@@ -73,12 +73,77 @@
 #endif /* LOGTASK_FLUSH_WAIT */
 
 /*
- *  シリアルインタフェースへの1文字出力
+ *  シリアルインタフェースへの出力バッファのサイズ
+ */
+#ifndef LOGTASK_OUTBUF_SIZE
+#define LOGTASK_OUTBUF_SIZE	128U
+#endif /* LOGTASK_OUTBUF_SIZE */
+
+/*
+ *  システムログタスクのID
+ */
+static ID		logtask_tskid;
+
+/*
+ *  シリアルインタフェースへの出力バッファ
+ *
+ *  整形したログ情報をこのバッファに蓄積し，まとめてシリアルインタ
+ *  フェースドライバに渡す．
+ */
+static char		logtask_outbuf[LOGTASK_OUTBUF_SIZE];
+static uint_t	logtask_outcnt;
+
+/*
+ *  出力バッファの内容のシリアルインタフェースへの出力
+ */
+static void
+logtask_output(void)
+{
+	if (logtask_outcnt > 0U) {
+		(void) serial_wri_dat(LOGTASK_PORTID, logtask_outbuf, logtask_outcnt);
+		logtask_outcnt = 0U;
+	}
+}
+
+/*
+ *  出力バッファへの1文字出力
  */
 static void
 logtask_putc(char c)
 {
-	(void) serial_wri_dat(LOGTASK_PORTID, &c, 1);
+	logtask_outbuf[logtask_outcnt++] = c;
+	if (logtask_outcnt >= LOGTASK_OUTBUF_SIZE) {
+		logtask_output();
+	}
+}
+
+/*
+ *  ログ情報の出力バッファへの整形
+ *
+ *  出力バッファの残りに入り切らない可能性がある場合には，出力バッファ
+ *  の内容を出力してから整形し直す．出力バッファ全体にも入り切らない場
+ *  合には，1文字ずつ出力バッファに格納する．
+ */
+static void
+logtask_format(const SYSLOG *p_syslog)
+{
+	uint_t	len;
+
+	len = syslog_sprint(&(logtask_outbuf[logtask_outcnt]),
+							LOGTASK_OUTBUF_SIZE - logtask_outcnt, p_syslog);
+	if (logtask_outcnt + len < LOGTASK_OUTBUF_SIZE) {
+		logtask_outcnt += len;
+	}
+	else {
+		logtask_output();
+		len = syslog_sprint(logtask_outbuf, LOGTASK_OUTBUF_SIZE, p_syslog);
+		if (len < LOGTASK_OUTBUF_SIZE) {
+			logtask_outcnt = len;
+		}
+		else {
+			syslog_print(p_syslog, logtask_putc);
+		}
+	}
 }
 
 /*
@@ -95,6 +160,14 @@ _logtask_flush(uint_t count)
 		ercd = E_CTX;
 	}
 	else {
+		/*
+		 *  まとめて出力するための待ちを打ち切らせるために，システム
+		 *  ログタスクを起床する．
+		 */
+		if (logtask_tskid != TSK_NONE) {
+			(void) wup_tsk(logtask_tskid);
+		}
+
 		while (true) {
 			if (syslog_ref_log(&rlog) < 0) {
 				ercd = E_SYS;
@@ -142,21 +215,47 @@ _logtask_flush(uint_t count)
 void
 logtask_main(EXINF exinf)
 {
-	SYSLOG	syslog;
-	ER_UINT	rercd;
+	SYSLOG			syslog;
+	T_SYSLOG_RLOG	rlog;
+	ER_UINT			rercd;
 
 	(void) serial_opn_por(LOGTASK_PORTID);
 	(void) syslog_msk_log(LOG_UPTO(LOG_NOTICE), LOG_UPTO(LOG_EMERG));
+	(void) get_tid(&logtask_tskid);
+	_syslog_set_ntf(logtask_tskid);
 	syslog_1(LOG_NOTICE, "System logging task is started on port %d.",
 													LOGTASK_PORTID);
 	while (true) {
+		/*
+		 *  ログバッファが空の間は，システムログ機能から起床されるまで
+		 *  待つ．カーネルの起動前やCPUロック状態で記録されたログ情報
+		 *  では起床されないため，待ち時間を最大LOGTASK_INTERVALμ秒に制限し，
+		 *  ログバッファを調べ直す．
+		 */
+		(void) syslog_ref_log(&rlog);
+		while (rlog.count == 0U) {
+			(void) tslp_tsk(LOGTASK_INTERVAL);
+			(void) syslog_ref_log(&rlog);
+		}
+
+		/*
+		 *  ログ情報をまとめて出力するために，ログの数がしきい値に達す
+		 *  るか，重要度の高いログ情報が記録されて起床されるまで，最大
+		 *  LOGTASK_INTERVALμ秒待つ．
+		 */
+		(void) tslp_tsk(LOGTASK_INTERVAL);
+
+		/*
+		 *  ログバッファ中のすべてのログ情報を出力バッファに整形し，ま
+		 *  とめて出力する．
+		 */
 		while ((rercd = syslog_rea_log(&syslog)) >= 0) {
 			if (((uint_t) rercd) > 0U) {
 				syslog_lostmsg((uint_t) rercd, logtask_putc);
 			}
-			syslog_print(&syslog, logtask_putc);
+			logtask_format(&syslog);
 		}
-		(void) dly_tsk(LOGTASK_INTERVAL);
+		logtask_output();
 	}
 }
 
@@ -167,6 +266,7 @@ void
 logtask_terminate(EXINF exinf)
 {
 	char	c;
+	uint_t	i;
 	SYSLOG	syslog;
 	bool_t	msgflg = false;
 	ER_UINT	rercd;
@@ -179,6 +279,15 @@ logtask_terminate(EXINF exinf)
 		target_fput_log(c);
 	}
 
+	/*
+	 *  出力バッファに残ったデータを，低レベル出力機能を用いて出力す
+	 *  る．
+	 */
+	for (i = 0U; i < logtask_outcnt; i++) {
+		target_fput_log(logtask_outbuf[i]);
+	}
+	logtask_outcnt = 0U;
+
 	/*
 	 *  ログバッファに記録されたログ情報を，低レベル出力機能を用いて出
 	 *  力する．
@@ -176,6 +176,9 @@ typedef struct serial_port_control_block {
 	uint_t	snd_write_ptr;		/* 送信バッファ書込みポインタ */
 	uint_t	snd_count;			/* 送信バッファ中の文字数 */
 	bool_t	snd_stopped;		/* STOPを受け取った状態か？ */
+#ifdef SIO_SUPPORT_SNDBLK
+	uint_t	snd_blklen;			/* SIOポートで送信中のブロックの文字数 */
+#endif /* SIO_SUPPORT_SNDBLK */
 } SPCB;
 
 static SPCB	spcb_table[TNUM_PORT];
@@ -300,6 +303,9 @@ _serial_opn_por(ID portid)
 		p_spcb->snd_write_ptr = 0U;
 		p_spcb->snd_count = 0U;
 		p_spcb->snd_stopped = false;
+#ifdef SIO_SUPPORT_SNDBLK
+		p_spcb->snd_blklen = 0U;
+#endif /* SIO_SUPPORT_SNDBLK */
 
 		/*
 		 *  これ以降，割込みを禁止する．
@@ -671,8 +677,29 @@ void
 sio_irdy_snd(EXINF exinf)
 {
 	SPCB	*p_spcb;
+#ifdef SIO_SUPPORT_SNDBLK
+	uint_t	blklen;
+#endif /* SIO_SUPPORT_SNDBLK */
 
 	p_spcb = (SPCB *) exinf;
+#ifdef SIO_SUPPORT_SNDBLK
+	if (p_spcb->snd_blklen > 0U) {
+		/*
+		 *  送信を終えたブロックを送信バッファから取り除く．
+		 */
+		if (p_spcb->snd_count == p_spcb->p_spinib->snd_bufsz) {
+			if (sig_sem(p_spcb->p_spinib->snd_semid) < 0) {
+				p_spcb->errorflag = true;
+			}
+		}
+		p_spcb->snd_read_ptr += p_spcb->snd_blklen;
+		if (p_spcb->snd_read_ptr == p_spcb->p_spinib->snd_bufsz) {
+			p_spcb->snd_read_ptr = 0U;
+		}
+		p_spcb->snd_count -= p_spcb->snd_blklen;
+		p_spcb->snd_blklen = 0U;
+	}
+#endif /* SIO_SUPPORT_SNDBLK */
 	if (p_spcb->rcv_fc_chr != '\0') {
 		/*
 		 *  START/STOPを送信する．
@@ -681,6 +708,23 @@ sio_irdy_snd(EXINF exinf)
 		p_spcb->rcv_fc_chr = '\0';
 	}
 	else if (!(p_spcb->snd_stopped) && p_spcb->snd_count > 0U) {
+#ifdef SIO_SUPPORT_SNDBLK
+		/*
+		 *  送信バッファ中の連続した文字を，ブロックとして送信する．
+		 */
+		blklen = p_spcb->p_spinib->snd_bufsz - p_spcb->snd_read_ptr;
+		if (blklen > p_spcb->snd_count) {
+			blklen = p_spcb->snd_count;
+		}
+		if (blklen > SIO_SNDBLK_MAX) {
+			blklen = SIO_SNDBLK_MAX;
+		}
+		if (sio_snd_blk(p_spcb->p_siopcb,
+				&(p_spcb->p_spinib->snd_buffer[p_spcb->snd_read_ptr]),
+																blklen)) {
+			p_spcb->snd_blklen = blklen;
+		}
+#else /* SIO_SUPPORT_SNDBLK */
 		/*
 		 *  送信バッファ中から文字を取り出して送信する．
 		 */
@@ -693,6 +737,7 @@ sio_irdy_snd(EXINF exinf)
 			}
 		}
 		p_spcb->snd_count--;
+#endif /* SIO_SUPPORT_SNDBLK */
 	}
 	else {
 		/*
@@ -725,7 +770,14 @@ sio_irdy_rcv(EXINF exinf)
 		 *  送信を再開する．
 		 */
 		p_spcb->snd_stopped = false;
+#ifdef SIO_SUPPORT_SNDBLK
+		/*
+		 *  ブロックを送信中の場合は，その完了時に送信を再開する．
+		 */
+		while (p_spcb->snd_count > 0U && p_spcb->snd_blklen == 0U) {
+#else /* SIO_SUPPORT_SNDBLK */
 		while (p_spcb->snd_count > 0U) {
+#endif /* SIO_SUPPORT_SNDBLK */
 			c = p_spcb->p_spinib->snd_buffer[p_spcb->snd_read_ptr];
 			if (serial_snd_chr(p_spcb, c)) {
 				INC_PTR(p_spcb->snd_read_ptr, p_spcb->p_spinib->snd_bufsz);
@@ -789,6 +841,19 @@ serial_get_chr(ID portid, char *p_c)
 	if (VALID_PORTID(portid)) {					/* ポート番号のチェック */
 		p_spcb = get_spcb(portid);
 		if (p_spcb->openflag) {					/* オープン済みかのチェック */
+#ifdef SIO_SUPPORT_SNDBLK
+			/*
+			 *  SIOポートで送信中のブロックは，送信済みとして扱う．
+			 */
+			if (p_spcb->snd_blklen > 0U) {
+				p_spcb->snd_read_ptr += p_spcb->snd_blklen;
+				if (p_spcb->snd_read_ptr == p_spcb->p_spinib->snd_bufsz) {
+					p_spcb->snd_read_ptr = 0U;
+				}
+				p_spcb->snd_count -= p_spcb->snd_blklen;
+				p_spcb->snd_blklen = 0U;
+			}
+#endif /* SIO_SUPPORT_SNDBLK */
 			if (p_spcb->snd_count > 0U) {
 				*p_c = p_spcb->p_spinib->snd_buffer[p_spcb->snd_read_ptr];
 				INC_PTR(p_spcb->snd_read_ptr, p_spcb->p_spinib->snd_bufsz);
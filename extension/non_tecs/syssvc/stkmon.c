@@ -0,0 +1,80 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		スタック使用量出力サービス（非TECS版専用）
+ */
+
+#include <kernel.h>
+#include <t_stdlib.h>
+#include <t_syslog.h>
+#include "target_syssvc.h"
+#include "stkmon.h"
+
+/*
+ *  スタック使用量を出力するタスクの本体
+ *
+ *  STKMON_INTERVAL毎に，非タスクコンテキスト用のスタック領域と，すべ
+ *  てのタスクのスタック領域について，最大使用量とサイズを出力する．タ
+ *  スクIDは，1からref_stkがエラーを返すまで順に調べる．
+ */
+void
+stkmon_task(EXINF exinf)
+{
+	T_RSTK	rstk;
+	ID		tskid;
+	ER		ercd;
+
+	while (true) {
+		(void) dly_tsk(STKMON_INTERVAL);
+		ercd = ref_stk(TSK_ISTK, &rstk);
+		if (ercd < 0) {
+			syslog_1(LOG_NOTICE, "stack: ref_stk returns %s.",
+												itron_strerror(ercd));
+			continue;
+		}
+		syslog_2(LOG_NOTICE, "stack: istk %u / %u",
+										rstk.sstkuse, rstk.sstksz);
+		for (tskid = 1; ref_stk(tskid, &rstk) == E_OK; tskid++) {
+			syslog_5(LOG_NOTICE, "stack: task %d sstk %u / %u ustk %u / %u",
+								tskid, rstk.sstkuse, rstk.sstksz,
+								rstk.ustkuse, rstk.ustksz);
+		}
+	}
+}
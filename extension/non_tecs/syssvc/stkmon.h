@@ -0,0 +1,83 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		スタック使用量出力サービス（非TECS版専用）
+ *
+ *  カーネルをUSE_STACK_WATERMARKをマクロ定義して構築した場合に，各タ
+ *  スクと非タスクコンテキストのスタック領域の最大使用量をref_stkで参照
+ *  し，定期的にシステムログに出力する．出力した結果は，utils/stksize.rb
+ *  で読み込み，スタック領域のサイズの推奨値を求めることができる．
+ */
+
+#ifndef TOPPERS_STKMON_H
+#define TOPPERS_STKMON_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <kernel.h>
+#include "target_syssvc.h"
+
+/*
+ *  スタック使用量出力サービス関連の定数のデフォルト値の定義
+ */ 
+#ifndef STKMON_PRIORITY
+#define STKMON_PRIORITY			TMAX_TPRI	/* 出力タスクの初期優先度 */
+#endif /* STKMON_PRIORITY */
+
+#ifndef STKMON_STACK_SIZE
+#define STKMON_STACK_SIZE		1024	/* 出力タスクのスタック領域のサイズ */
+#endif /* STKMON_STACK_SIZE */
+
+#ifndef STKMON_INTERVAL
+#define STKMON_INTERVAL			10000000U	/* 出力の周期（マイクロ秒）*/
+#endif /* STKMON_INTERVAL */
+
+/*
+ *  スタック使用量を出力するタスクの本体
+ */
+extern void	stkmon_task(EXINF exinf) throw();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOPPERS_STKMON_H */
@@ -260,6 +260,9 @@
 #define TOPPERS_stp_ovr
 #define TOPPERS_ref_ovr
 #define TOPPERS_ovrcal
+#define TOPPERS_spsini
+#define TOPPERS_spsrel
+#define TOPPERS_spscal
 
 /* sys_manage.c */
 #define TOPPERS_rot_rdq
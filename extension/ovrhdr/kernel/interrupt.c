@@ -378,7 +378,7 @@ chg_ipm(PRI intpri)
 		if (p_runtsk->raster && p_runtsk->enater) {
 #ifdef TOPPERS_SUPPORT_OVRHDR
 			if (p_runtsk->staovr) {
-				(void) target_ovrtimer_stop();
+				p_runtsk->leftotm = target_ovrtimer_stop();
 			}
 #endif /* TOPPERS_SUPPORT_OVRHDR */
 			task_terminate(p_runtsk);
@@ -183,6 +183,9 @@
 #define ovrtimer_start				_kernel_ovrtimer_start
 #define ovrtimer_stop				_kernel_ovrtimer_stop
 #define call_ovrhdr					_kernel_call_ovrhdr
+#define initialize_sporadic			_kernel_initialize_sporadic
+#define sporadic_release			_kernel_sporadic_release
+#define call_sporadic				_kernel_call_sporadic
 
 /*
  *  interrupt.c
@@ -234,6 +237,9 @@
 #define alminib_table				_kernel_alminib_table
 #define almcb_table					_kernel_almcb_table
 #define ovrinib						_kernel_ovrinib
+#define tnum_sps					_kernel_tnum_sps
+#define spsinib_table				_kernel_spsinib_table
+#define spscb_table					_kernel_spscb_table
 #define tnum_def_inhno				_kernel_tnum_def_inhno
 #define inhinib_table				_kernel_inhinib_table
 #define tnum_cfg_intno				_kernel_tnum_cfg_intno
@@ -184,6 +184,9 @@
 #undef ovrtimer_start
 #undef ovrtimer_stop
 #undef call_ovrhdr
+#undef initialize_sporadic
+#undef sporadic_release
+#undef call_sporadic
 
 /*
  *  interrupt.c
@@ -235,6 +238,9 @@
 #undef alminib_table
 #undef almcb_table
 #undef ovrinib
+#undef tnum_sps
+#undef spsinib_table
+#undef spscb_table
 #undef tnum_def_inhno
 #undef inhinib_table
 #undef tnum_cfg_intno
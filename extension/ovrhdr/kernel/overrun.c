@@ -45,6 +45,7 @@
 #include "kernel_impl.h"
 #include "check.h"
 #include "task.h"
+#include "taskhook.h"
 #include "overrun.h"
 
 #ifdef TOPPERS_SUPPORT_OVRHDR
@@ -85,6 +86,21 @@
 #define LOG_REF_OVR_LEAVE(ercd, pk_rovr)
 #endif /* LOG_REF_OVR_LEAVE */
 
+/*
+ *  スポラディックサーバのタスクのベース優先度の変更
+ *
+ *  ミューテックスをロックしている場合には，現在優先度の変更をミュー
+ *  テックス機能に任せる（chg_priと同様の処理）．
+ */
+Inline void
+change_sporadic_priority(TCB *p_tcb, uint_t newbpri)
+{
+	p_tcb->bpriority = newbpri;
+	if (p_tcb->p_lastmtx == NULL || !((*mtxhook_scan_ceilmtx)(p_tcb))) {
+		change_priority(p_tcb, newbpri, false);
+	}
+}
+
 /*
  *  オーバランタイマの動作開始
  */
@@ -140,6 +156,7 @@ sta_ovr(ID tskid, PRCTIM ovrtim)
 		CHECK_ID(VALID_TSKID(tskid));
 		p_tcb = get_tcb(tskid);
 	}
+	CHECK_ILUSE(p_tcb->p_spscb == NULL);
 	CHECK_PAR(0U < ovrtim && ovrtim <= TMAX_OVRTIM);
 	CHECK_ACPTN(p_tcb->p_tinib->acvct.acptn2);
 
@@ -183,6 +200,7 @@ stp_ovr(ID tskid)
 		CHECK_ID(VALID_TSKID(tskid));
 		p_tcb = get_tcb(tskid);
 	}
+	CHECK_ILUSE(p_tcb->p_spscb == NULL);
 	CHECK_ACPTN(p_tcb->p_tinib->acvct.acptn2);
 
 	lock_cpu();
@@ -259,10 +277,27 @@ call_ovrhdr(void)
 {
 	assert(sense_context());
 	assert(!sense_lock());
-	assert(ovrinib.ovrhdr != NULL);
 
 	lock_cpu();
-	if (p_runtsk != NULL && p_runtsk->staovr && p_runtsk->leftotm == 0U) {
+	if (p_runtsk != NULL && p_runtsk->staovr && p_runtsk->leftotm == 0U
+											&& p_runtsk->p_spscb != NULL) {
+		/*
+		 *  スポラディックサーバのタスクがバジェットを使い切った場合に
+		 *  は，オーバランハンドラを呼び出さずに，低優先度に下げる．
+		 */
+		p_runtsk->staovr = false;
+		p_runtsk->p_spscb->exhausted = true;
+		p_runtsk->p_spscb->hipri = p_runtsk->bpriority;
+		change_sporadic_priority(p_runtsk,
+								p_runtsk->p_spscb->p_spsinib->lowpri);
+		if (p_runtsk != p_schedtsk) {
+			request_dispatch_retint();
+		}
+		unlock_cpu();
+	}
+	else if (p_runtsk != NULL && p_runtsk->staovr
+										&& p_runtsk->leftotm == 0U) {
+		assert(ovrinib.ovrhdr != NULL);
 		p_runtsk->staovr = false;
 		unlock_cpu();
 
@@ -281,4 +316,109 @@ call_ovrhdr(void)
 }
 
 #endif /* TOPPERS_ovrcal */
+
+/*
+ *  スポラディックサーバ機能の初期化
+ */
+#ifdef TOPPERS_spsini
+
+void
+initialize_sporadic(void)
+{
+	uint_t	i;
+	SPSCB	*p_spscb;
+	TCB		*p_tcb;
+
+	for (i = 0; i < tnum_sps; i++) {
+		p_spscb = &(spscb_table[i]);
+		p_spscb->p_spsinib = &(spsinib_table[i]);
+		p_spscb->exhausted = false;
+		p_spscb->tmevtb.callback = (CBACK) call_sporadic;
+		p_spscb->tmevtb.arg = (void *) p_spscb;
+
+		p_tcb = p_spscb->p_spsinib->p_tcb;
+		p_tcb->p_spscb = p_spscb;
+		p_tcb->staovr = true;
+		p_tcb->leftotm = p_spscb->p_spsinib->budget;
+
+		/*
+		 *  TA_ACT属性のタスクは，タスク管理モジュールの初期化時に実行
+		 *  できる状態になっているため，ここで補充周期の計測を開始する．
+		 */
+		if (!TSTAT_DORMANT(p_tcb->tstat)) {
+			p_spscb->repsta = true;
+			p_spscb->tmevtb.evttim = (EVTTIM)(p_spscb->p_spsinib->repprd);
+			tmevtb_register(&(p_spscb->tmevtb), tmevt_heap_kernel);
+		}
+		else {
+			p_spscb->repsta = false;
+		}
+	}
+}
+
+#endif /* TOPPERS_spsini */
+
+/*
+ *  補充周期の計測開始
+ */
+#ifdef TOPPERS_spsrel
+
+void
+sporadic_release(TCB *p_tcb)
+{
+	SPSCB	*p_spscb = p_tcb->p_spscb;
+
+	p_spscb->repsta = true;
+	tmevtb_enqueue_reltim(&(p_spscb->tmevtb), p_spscb->p_spsinib->repprd,
+														tmevt_heap_kernel);
+}
+
+#endif /* TOPPERS_spsrel */
+
+/*
+ *  バジェット補充ルーチン
+ *
+ *  この関数は，高分解能タイマ割込みの処理中で，CPUロック状態で呼び出
+ *  される．ディスパッチの要求は，signal_timeがまとめて行う．
+ */
+#ifdef TOPPERS_spscal
+
+void
+call_sporadic(SPSCB *p_spscb)
+{
+	TCB		*p_tcb = p_spscb->p_spsinib->p_tcb;
+
+	/*
+	 *  バジェットを補充する．対象タスクが実行状態の場合，オーバラン
+	 *  タイマは割込みの入口で停止しており，出口でleftotmから再開され
+	 *  る．
+	 */
+	p_tcb->staovr = true;
+	p_tcb->leftotm = p_spscb->p_spsinib->budget;
+
+	if (p_spscb->exhausted) {
+		p_spscb->exhausted = false;
+		if (TSTAT_DORMANT(p_tcb->tstat)) {
+			p_tcb->bpriority = p_spscb->hipri;
+			p_tcb->priority = p_spscb->hipri;
+		}
+		else {
+			change_sporadic_priority(p_tcb, p_spscb->hipri);
+		}
+	}
+
+	/*
+	 *  対象タスクが実行できる状態であれば，次の補充周期の計測を開始
+	 *  する．そうでなければ，次に実行できる状態になった時に開始する．
+	 */
+	if (TSTAT_RUNNABLE(p_tcb->tstat)) {
+		p_spscb->tmevtb.evttim += p_spscb->p_spsinib->repprd;
+		tmevtb_register(&(p_spscb->tmevtb), tmevt_heap_kernel);
+	}
+	else {
+		p_spscb->repsta = false;
+	}
+}
+
+#endif /* TOPPERS_spscal */
 #endif /* TOPPERS_SUPPORT_OVRHDR */
@@ -47,6 +47,7 @@
 
 #ifdef TOPPERS_SUPPORT_OVRHDR
 #include "target_timer.h"
+#include "time_event.h"
 
 /*
  *  オーバランハンドラ初期化ブロック
@@ -80,5 +81,65 @@ extern void	ovrtimer_stop(void);
  */
 extern void	call_ovrhdr(void);
 
+/*
+ *  スポラディックサーバ初期化ブロック
+ *
+ *  DEF_SPSで定義したタスクは，バジェット（budget）の残りがある間は通
+ *  常の優先度で実行し，バジェットを使い切ると低優先度（lowpri）に下げ
+ *  られる．バジェットは，タスクが実行できる状態になってから補充周期
+ *  （repprd）後に補充され，優先度も元に戻る．
+ */
+typedef struct sporadic_server_initialization_block {
+	TCB			*p_tcb;			/* 対象タスクのTCB */
+	PRCTIM		budget;			/* バジェット */
+	RELTIM		repprd;			/* 補充周期 */
+	uint_t		lowpri;			/* バジェット枯渇時の優先度（内部表現）*/
+} SPSINIB;
+
+/*
+ *  スポラディックサーバ管理ブロック
+ */
+struct sporadic_server_control_block {
+	const SPSINIB *p_spsinib;	/* 初期化ブロックへのポインタ */
+	bool_t		repsta;			/* 補充周期の計測中か */
+	bool_t		exhausted;		/* バジェットを使い切ったか */
+	uint_t		hipri;			/* 補充時に戻すベース優先度（内部表現）*/
+	TMEVTB		tmevtb;			/* 補充のためのタイムイベントブロック */
+};
+
+/*
+ *  スポラディックサーバの数（kernel_cfg.c）
+ */
+extern const uint_t	tnum_sps;
+
+/*
+ *  スポラディックサーバ初期化ブロックのエリア（kernel_cfg.c）
+ */
+extern const SPSINIB	spsinib_table[];
+
+/*
+ *  スポラディックサーバ管理ブロックのエリア（kernel_cfg.c）
+ */
+extern SPSCB	spscb_table[];
+
+/*
+ *  スポラディックサーバ機能の初期化
+ */
+extern void	initialize_sporadic(void);
+
+/*
+ *  補充周期の計測開始
+ *
+ *  p_tcbで指定されるタスクが実行できる状態になった時に，make_runnable
+ *  から呼び出される．補充周期を計測中でない場合に，補充のためのタイム
+ *  イベントを登録する．
+ */
+extern void	sporadic_release(TCB *p_tcb);
+
+/*
+ *  バジェット補充ルーチン
+ */
+extern void	call_sporadic(SPSCB *p_spscb);
+
 #endif /* TOPPERS_SUPPORT_OVRHDR */
 #endif /* TOPPERS_OVERRUN_H */
@@ -199,6 +199,8 @@ rot_rdq(PRI tskpri)
 {
 	uint_t	pri;
 	bool_t	context;
+	SCHEDCB	*p_schedcb;
+	QUEUE	*p_queue;
 	ER		ercd;
 
 	LOG_ROT_RDQ_ENTER(tskpri);
@@ -216,16 +218,28 @@ rot_rdq(PRI tskpri)
 	}
 
 	lock_cpu();
-	rotate_ready_queue(pri, context ? &schedcb_kernel : p_runtsk->p_schedcb);
-	if (p_runtsk != p_schedtsk) {
-		if (!context) {
-			dispatch();
-		}
-		else {
-			request_dispatch_retint();
+	p_schedcb = context ? &schedcb_kernel : p_runtsk->p_schedcb;
+	p_queue = &(p_schedcb->ready_queue[pri]);
+	if (!queue_empty(p_queue) && (((TCB *)(p_queue->p_next))->p_tinib->tskatr
+														& TA_RSTR) != 0U) {
+		/*
+		 *  先頭の制約タスクは実行途中の可能性があり，同じスタック領域
+		 *  を共有するタスクに実行順を譲ることはできない．
+		 */
+		ercd = E_NOSPT;
+	}
+	else {
+		rotate_ready_queue(pri, p_schedcb);
+		if (p_runtsk != p_schedtsk) {
+			if (!context) {
+				dispatch();
+			}
+			else {
+				request_dispatch_retint();
+			}
 		}
+		ercd = E_OK;
 	}
-	ercd = E_OK;
 	unlock_cpu();
 
   error_exit:
@@ -643,7 +657,7 @@ ena_dsp(void)
 		if (p_runtsk->raster && p_runtsk->enater) {
 #ifdef TOPPERS_SUPPORT_OVRHDR
 			if (p_runtsk->staovr) {
-				(void) target_ovrtimer_stop();
+				p_runtsk->leftotm = target_ovrtimer_stop();
 			}
 #endif /* TOPPERS_SUPPORT_OVRHDR */
 			task_terminate(p_runtsk);
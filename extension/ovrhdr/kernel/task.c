@@ -48,6 +48,7 @@
 #include "task.h"
 #include "taskhook.h"
 #include "wait.h"
+#include "overrun.h"
 
 #ifdef TOPPERS_tskini
 
@@ -97,6 +98,9 @@ initialize_task(void)
 		}
 		p_tcb->p_schedcb = p_tcb->p_dominib->p_schedcb;
 		p_tcb->actque = false;
+#ifdef TOPPERS_SUPPORT_OVRHDR
+		p_tcb->p_spscb = NULL;
+#endif /* TOPPERS_SUPPORT_OVRHDR */
 		make_dormant(p_tcb);
 		p_tcb->p_lastmtx = NULL;
 		if ((p_tcb->p_tinib->tskatr & TA_ACT) != 0U) {
@@ -223,6 +227,11 @@ make_runnable(TCB *p_tcb)
 
 	queue_insert_prev(&(p_schedcb->ready_queue[pri]), &(p_tcb->task_queue));
 	primap_set(pri, p_schedcb);
+#ifdef TOPPERS_SUPPORT_OVRHDR
+	if (p_tcb->p_spscb != NULL && !(p_tcb->p_spscb->repsta)) {
+		sporadic_release(p_tcb);
+	}
+#endif /* TOPPERS_SUPPORT_OVRHDR */
 
 	if (p_schedcb->p_predtsk == (TCB *) NULL
 							|| pri < p_schedcb->p_predtsk->priority) {
@@ -292,6 +301,21 @@ make_dormant(TCB *p_tcb)
 	p_tcb->enater = true;
 #ifdef TOPPERS_SUPPORT_OVRHDR
 	p_tcb->staovr = false;
+	if (p_tcb->p_spscb != NULL) {
+		/*
+		 *  スポラディックサーバのタスクは，休止状態になってもバジェッ
+		 *  トの残りを保持し，バジェットを使い切っている場合には，補充
+		 *  されるまで低優先度のままとする．
+		 */
+		if (p_tcb->p_spscb->exhausted) {
+			p_tcb->p_spscb->hipri = p_tcb->p_tinib->ipriority;
+			p_tcb->bpriority = p_tcb->p_spscb->p_spsinib->lowpri;
+			p_tcb->priority = p_tcb->p_spscb->p_spsinib->lowpri;
+		}
+		else {
+			p_tcb->staovr = true;
+		}
+	}
 #endif /* TOPPERS_SUPPORT_OVRHDR */
 	LOG_TSKSTAT(p_tcb);
 }
@@ -179,6 +179,13 @@ typedef union waiting_information {
  */
 typedef struct mutex_control_block MTXCB;
 
+#ifdef TOPPERS_SUPPORT_OVRHDR
+/*
+ *  スポラディックサーバ管理ブロックの型の前方参照
+ */
+typedef struct sporadic_server_control_block SPSCB;
+#endif /* TOPPERS_SUPPORT_OVRHDR */
+
 /*
  *  タスク初期化ブロック
  *
@@ -223,7 +230,8 @@ typedef struct task_initialization_block {
  *  フィールドが有効な値を保持する条件は次の通り．
  *
  *  ・初期化後は常に有効：
- *  		p_tinib，p_dominib，p_schedcb，tstat，actque，staovr，leftotm
+ *  		p_tinib，p_dominib，p_schedcb，tstat，actque，staovr，leftotm，
+ *  		p_spscb
  *  ・休止状態以外で有効（休止状態では初期値になっている）：
  *  		svclevel，bpriority，priority，wupque，raster，enater，p_lastmtx
  *  ・待ち状態（二重待ち状態を含む）で有効：
@@ -232,6 +240,9 @@ typedef struct task_initialization_block {
  *  		task_queue
  *  ・実行可能状態，待ち状態，強制待ち状態，二重待ち状態で有効：
  *  		tskctxb
+ *
+ *  ディスパッチャとスケジューラが参照するフィールドを先頭にまとめ，待
+ *  ち状態やミューテックスに関するフィールドを後ろに置いている．
  */
 struct task_control_block {
 	QUEUE			task_queue;		/* タスクキュー */
@@ -257,13 +268,16 @@ struct task_control_block {
 #ifdef TOPPERS_SUPPORT_OVRHDR
 	BIT_FIELD_BOOL	staovr : 1;		/* オーバランハンドラ動作状態 */
 #endif /* TOPPERS_SUPPORT_OVRHDR */
+	TSKCTXB			tskctxb;		/* タスクコンテキストブロック */
+#ifdef TOPPERS_SUPPORT_OVRHDR
+	PRCTIM			leftotm;		/* 残りプロセッサ時間 */
+#endif /* TOPPERS_SUPPORT_OVRHDR */
 
 	WINFO			*p_winfo;		/* 待ち情報ブロックへのポインタ */
 	MTXCB			*p_lastmtx;		/* 最後にロックしたミューテックス */
 #ifdef TOPPERS_SUPPORT_OVRHDR
-	PRCTIM			leftotm;		/* 残りプロセッサ時間 */
+	SPSCB			*p_spscb;		/* スポラディックサーバ管理ブロック */
 #endif /* TOPPERS_SUPPORT_OVRHDR */
-	TSKCTXB			tskctxb;		/* タスクコンテキストブロック */
 };
 
 /*
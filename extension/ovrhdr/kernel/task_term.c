@@ -142,7 +142,7 @@ ext_tsk(void)
 	}
 #ifdef TOPPERS_SUPPORT_OVRHDR
 	if (p_runtsk->staovr) {
-		(void) target_ovrtimer_stop();
+		p_runtsk->leftotm = target_ovrtimer_stop();
 	}
 #endif /* TOPPERS_SUPPORT_OVRHDR */
 	task_terminate(p_runtsk);				/* ［NGKI3449］*/
@@ -255,7 +255,7 @@ ena_ter(void)
 	if (p_runtsk->raster && dspflg) {
 #ifdef TOPPERS_SUPPORT_OVRHDR
 		if (p_runtsk->staovr) {
-			(void) target_ovrtimer_stop();
+			p_runtsk->leftotm = target_ovrtimer_stop();
 		}
 #endif /* TOPPERS_SUPPORT_OVRHDR */
 		task_terminate(p_runtsk);
@@ -0,0 +1,279 @@
+/*
+ *  TOPPERS Software
+ *      Toyohashi Open Platform for Embedded Real-Time Systems
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		オーバランハンドラ機能のテスト(6)
+ *
+ * 【テストの目的】
+ *
+ *  スポラディックサーバ（DEF_SPS）のタスクについて，バジェットを使い
+ *  切った時の低優先度への変更，補充周期後のバジェットの補充と優先度の
+ *  復帰，休止状態になった時のバジェットの残りの保持を，タイマドライバ
+ *  シミュレータを用いてテストする．
+ *
+ * 【テスト項目】
+ *
+ *	(A) バジェットを使い切ると，ベース優先度がlowpriに下げられる
+ *	(B) 補充周期後にバジェットが補充され，ベース優先度が元に戻る
+ *		(B-1) 実行途中で低優先度に下げられたタスクの場合
+ *		(B-2) 低優先度のまま休止状態を経て起動されたタスクの場合
+ *	(C) 休止状態になっても，バジェットの残りが保持される
+ *	(D) バジェットを使い切ったまま休止状態になったタスクは，補充され
+ *		るまで低優先度で起動される
+ *
+ * 【使用リソース】
+ *
+ *	高分解能タイマモジュールの性質：HRT_CONFIG1
+ *		TCYC_HRTCNT		未定義（2^32の意味）
+ *		TSTEP_HRTCNT	1U
+ *		HRTCNT_BOUND	4000000002U
+ *
+ *	タイマドライバシミュレータのパラメータ
+ *		SIMTIM_INIT_CURRENT		10
+ *		SIMTIM_OVERHEAD_HRTINT	10
+ *		SIMTIM_OVERHEAD_OVRINT	10
+ *
+ *	TASK1: 中優先度タスク，メインタスク，最初から起動
+ *	TASK2: 高優先度タスク，スポラディックサーバ
+ *			バジェット：SPS_BUDGET，補充周期：SPS_REPPRD，
+ *			lowpri：低優先度
+ *
+ * 【補足説明】
+ *
+ *	TASK2の補充周期は，TASK2が最初に起動された時刻から計測を開始し，
+ *	1回目の補充の時点でTASK2が実行できる状態であるため，続けて2回目の
+ *	補充周期の計測が開始される．TASK1がSPS_REPPRDだけ時間を進める間に，
+ *	それぞれの補充が行われる．
+ *
+ * 【テストシーケンス】
+ *
+ *	== TASK1（優先度：中）==
+ *	1:	act_tsk(TASK2)
+ *	== TASK2-1（1回目）==
+ *	2:	get_pri(TSK_SELF, &tskpri)
+ *		assert(tskpri == HIGH_PRIORITY)
+ *		ref_ovr(TSK_SELF, &rovr)
+ *		assert(rovr.ovrstat == TOVR_STA)
+ *		assert(rovr.leftotm == SPS_BUDGET)
+ *		DO(simtim_advance(SPS_BUDGET))
+ *	== TASK1（続き）==
+ *	3:	get_pri(TASK2, &tskpri)
+ *		assert(tskpri == LOW_PRIORITY)						... (A)
+ *		ref_ovr(TASK2, &rovr)
+ *		assert(rovr.ovrstat == TOVR_STP)
+ *		DO(simtim_advance(SPS_REPPRD))
+ *	== TASK2-1（続き）==
+ *	4:	get_pri(TSK_SELF, &tskpri)
+ *		assert(tskpri == HIGH_PRIORITY)						... (B-1)
+ *		ref_ovr(TSK_SELF, &rovr)
+ *		assert(rovr.ovrstat == TOVR_STA)
+ *		assert(rovr.leftotm == SPS_BUDGET)					... (B-1)
+ *		DO(simtim_advance(SPS_USED))
+ *		ext_tsk()
+ *	== TASK1（続き）==
+ *	5:	act_tsk(TASK2)
+ *	== TASK2-2（2回目）==
+ *	6:	ref_ovr(TSK_SELF, &rovr)
+ *		assert(rovr.ovrstat == TOVR_STA)
+ *		assert(rovr.leftotm == SPS_BUDGET - SPS_USED)		... (C)
+ *		DO(simtim_advance(SPS_BUDGET - SPS_USED))
+ *	== TASK1（続き）==
+ *	7:	get_pri(TASK2, &tskpri)
+ *		assert(tskpri == LOW_PRIORITY)						... (A)
+ *		ter_tsk(TASK2)
+ *		act_tsk(TASK2)
+ *		get_pri(TASK2, &tskpri)
+ *		assert(tskpri == LOW_PRIORITY)						... (D)
+ *		DO(simtim_advance(SPS_REPPRD))
+ *	== TASK2-3（3回目）==
+ *	8:	get_pri(TSK_SELF, &tskpri)
+ *		assert(tskpri == HIGH_PRIORITY)						... (B-2)
+ *		ref_ovr(TSK_SELF, &rovr)
+ *		assert(rovr.leftotm == SPS_BUDGET)					... (B-2)
+ *		ext_tsk()
+ *	== TASK1（続き）==
+ *	9:	END
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "arch/simtimer/sim_timer_cntl.h"
+#include "kernel_cfg.h"
+#include "simt_ovrhdr6.h"
+
+#ifndef HRT_CONFIG1
+#error Compiler option "-DHRT_CONFIG1" is missing.
+#endif /* HRT_CONFIG1 */
+
+/* DO NOT DELETE THIS LINE -- gentest depends on it. */
+
+void
+task1(EXINF exinf)
+{
+	ER_UINT	ercd;
+	PRI		tskpri;
+	T_ROVR	rovr;
+
+	test_start(__FILE__);
+
+	check_point(1);
+	ercd = act_tsk(TASK2);
+	check_ercd(ercd, E_OK);
+
+	check_point(3);
+	ercd = get_pri(TASK2, &tskpri);
+	check_ercd(ercd, E_OK);
+
+	check_assert(tskpri == LOW_PRIORITY);
+
+	ercd = ref_ovr(TASK2, &rovr);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rovr.ovrstat == TOVR_STP);
+
+	simtim_advance(SPS_REPPRD);
+
+	check_point(5);
+	ercd = act_tsk(TASK2);
+	check_ercd(ercd, E_OK);
+
+	check_point(7);
+	ercd = get_pri(TASK2, &tskpri);
+	check_ercd(ercd, E_OK);
+
+	check_assert(tskpri == LOW_PRIORITY);
+
+	ercd = ter_tsk(TASK2);
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK2);
+	check_ercd(ercd, E_OK);
+
+	ercd = get_pri(TASK2, &tskpri);
+	check_ercd(ercd, E_OK);
+
+	check_assert(tskpri == LOW_PRIORITY);
+
+	simtim_advance(SPS_REPPRD);
+
+	check_finish(9);
+	check_assert(false);
+}
+
+static uint_t	task2_count = 0;
+
+void
+task2(EXINF exinf)
+{
+	ER_UINT	ercd;
+	PRI		tskpri;
+	T_ROVR	rovr;
+
+	switch (++task2_count) {
+	case 1:
+		check_point(2);
+		ercd = get_pri(TSK_SELF, &tskpri);
+		check_ercd(ercd, E_OK);
+
+		check_assert(tskpri == HIGH_PRIORITY);
+
+		ercd = ref_ovr(TSK_SELF, &rovr);
+		check_ercd(ercd, E_OK);
+
+		check_assert(rovr.ovrstat == TOVR_STA);
+
+		check_assert(rovr.leftotm == SPS_BUDGET);
+
+		simtim_advance(SPS_BUDGET);
+
+		check_point(4);
+		ercd = get_pri(TSK_SELF, &tskpri);
+		check_ercd(ercd, E_OK);
+
+		check_assert(tskpri == HIGH_PRIORITY);
+
+		ercd = ref_ovr(TSK_SELF, &rovr);
+		check_ercd(ercd, E_OK);
+
+		check_assert(rovr.ovrstat == TOVR_STA);
+
+		check_assert(rovr.leftotm == SPS_BUDGET);
+
+		simtim_advance(SPS_USED);
+
+		ercd = ext_tsk();
+		check_ercd(ercd, E_OK);
+
+		check_assert(false);
+
+	case 2:
+		check_point(6);
+		ercd = ref_ovr(TSK_SELF, &rovr);
+		check_ercd(ercd, E_OK);
+
+		check_assert(rovr.ovrstat == TOVR_STA);
+
+		check_assert(rovr.leftotm == SPS_BUDGET - SPS_USED);
+
+		simtim_advance(SPS_BUDGET - SPS_USED);
+
+		check_assert(false);
+
+	case 3:
+		check_point(8);
+		ercd = get_pri(TSK_SELF, &tskpri);
+		check_ercd(ercd, E_OK);
+
+		check_assert(tskpri == HIGH_PRIORITY);
+
+		ercd = ref_ovr(TSK_SELF, &rovr);
+		check_ercd(ercd, E_OK);
+
+		check_assert(rovr.leftotm == SPS_BUDGET);
+
+		ercd = ext_tsk();
+		check_ercd(ercd, E_OK);
+
+		check_assert(false);
+
+	default:
+		check_assert(false);
+	}
+	check_assert(false);
+}
@@ -0,0 +1,194 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		チャネルのブロック操作ライブラリ
+ *
+ *  チャネル（CRE_CHN）のブロックを，サービスコールを呼び出さずに送受
+ *  信するためのライブラリである．送信側は，chn_get_sblkで空きブロック
+ *  を取り出してデータを書き込み，chn_snd_blkで送信する．受信側は，
+ *  chn_get_rblkで受信すべきブロックを取り出してデータを読み出し，
+ *  chn_rel_rblkで受信を終える．カーネルを呼び出すのは，空きブロック
+ *  または受信すべきブロックがなく待ち状態に入る場合と，相手側に待って
+ *  いるタスクがある場合のみである．
+ *
+ *  各関数に渡すチャネル状態のパケットは，ref_chnにより取り出しておく．
+ *  送信側と受信側は，ブロックの番地を自側のブロック数の累計から求め，
+ *  相手側が更新する値は，ブロック数の判定にのみ用いる．
+ *
+ *  1つのチャネルの送信側（または受信側）を複数のタスクから用いる場合
+ *  には，アプリケーションで排他制御を行う必要がある．
+ */
+
+#ifndef TOPPERS_CHNBLK_H
+#define TOPPERS_CHNBLK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <kernel.h>
+
+/*
+ *  メモリアクセスの順序を保証するためのバリア
+ *
+ *  シングルプロセッサでは，コンパイラによる最適化を抑止すれば十分であ
+ *  る．そうでない場合には，ターゲット依存部で定義する．
+ */
+#ifndef CHN_BARRIER
+#define CHN_BARRIER()	Asm("" ::: "memory")
+#endif /* CHN_BARRIER */
+
+/*
+ *  チャネル中のブロック数の取出し
+ */
+Inline uint_t
+chn_blkcnt(const T_RCHN *pk_rchn)
+{
+	return(*((volatile uint_t *) &(pk_rchn->p_chnsnd->sndcnt))
+				- *((volatile uint_t *) &(pk_rchn->p_chnrcv->rcvcnt)));
+}
+
+/*
+ *  ブロックの番地の算出
+ */
+Inline void *
+chn_blk(const T_RCHN *pk_rchn, uint_t count)
+{
+	return((void *)(((char *)(pk_rchn->chn))
+						+ (count % pk_rchn->blkcnt) * pk_rchn->blksz));
+}
+
+/*
+ *  空きブロックの取出し（送信側）
+ */
+Inline ER
+chn_get_sblk(const T_RCHN *pk_rchn, void **p_blk, TMO tmout)
+{
+	uint_t	cnt;
+	ER		ercd;
+
+	while ((cnt = chn_blkcnt(pk_rchn)) >= pk_rchn->blkcnt) {
+		if (cnt > pk_rchn->blkcnt) {
+			return(E_OBJ);
+		}
+		else if (tmout == TMO_POL) {
+			return(E_TMOUT);
+		}
+		else if (tmout == TMO_FEVR) {
+			ercd = wai_chn(pk_rchn->chnid, TCHN_SND);
+		}
+		else {
+			ercd = twai_chn(pk_rchn->chnid, TCHN_SND, tmout);
+		}
+		if (ercd != E_OK) {
+			return(ercd);
+		}
+	}
+	CHN_BARRIER();
+	*p_blk = chn_blk(pk_rchn, pk_rchn->p_chnsnd->sndcnt);
+	return(E_OK);
+}
+
+/*
+ *  ブロックの送信（送信側）
+ */
+Inline ER
+chn_snd_blk(const T_RCHN *pk_rchn)
+{
+	CHN_BARRIER();
+	pk_rchn->p_chnsnd->sndcnt += 1U;
+	CHN_BARRIER();
+	if (*((volatile uint_t *) &(pk_rchn->p_chnsnd->rwait)) != 0U) {
+		return(sig_chn(pk_rchn->chnid, TCHN_SND));
+	}
+	return(E_OK);
+}
+
+/*
+ *  受信すべきブロックの取出し（受信側）
+ */
+Inline ER
+chn_get_rblk(const T_RCHN *pk_rchn, void **p_blk, TMO tmout)
+{
+	uint_t	cnt;
+	ER		ercd;
+
+	while ((cnt = chn_blkcnt(pk_rchn)) == 0U) {
+		if (tmout == TMO_POL) {
+			return(E_TMOUT);
+		}
+		else if (tmout == TMO_FEVR) {
+			ercd = wai_chn(pk_rchn->chnid, TCHN_RCV);
+		}
+		else {
+			ercd = twai_chn(pk_rchn->chnid, TCHN_RCV, tmout);
+		}
+		if (ercd != E_OK) {
+			return(ercd);
+		}
+	}
+	if (cnt > pk_rchn->blkcnt) {
+		return(E_OBJ);
+	}
+	CHN_BARRIER();
+	*p_blk = chn_blk(pk_rchn, pk_rchn->p_chnrcv->rcvcnt);
+	return(E_OK);
+}
+
+/*
+ *  ブロックの受信の終了（受信側）
+ */
+Inline ER
+chn_rel_rblk(const T_RCHN *pk_rchn)
+{
+	CHN_BARRIER();
+	pk_rchn->p_chnrcv->rcvcnt += 1U;
+	CHN_BARRIER();
+	if (*((volatile uint_t *) &(pk_rchn->p_chnrcv->swait)) != 0U) {
+		return(sig_chn(pk_rchn->chnid, TCHN_RCV));
+	}
+	return(E_OK);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOPPERS_CHNBLK_H */
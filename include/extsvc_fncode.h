@@ -103,5 +103,10 @@
 #define TFN_SIMTIM_ADVANCE				(28)
 #define TFN_SIMTIM_ADD					(29)
 
+/*
+ *  割込み処理時間計測サービス
+ */
+#define TFN_REF_INTHIST					(31)
+
 #endif /* TOPPERS_OMIT_TECS */
 #endif /* TOPPERS_EXTSVC_FNCODE_H */
@@ -18,6 +18,8 @@
 #define TFN_WUP_TSK (-15)
 #define TFN_CAN_WUP (-17)
 #define TFN_REL_WAI (-18)
+#define TFN_CHG_DLN (-21)
+#define TFN_REF_STK (-22)
 #define TFN_SUS_TSK (-25)
 #define TFN_RSM_TSK (-26)
 #define TFN_DLY_TSK (-27)
@@ -131,6 +133,8 @@
 #define TFN_REF_ALM (-187)
 #define TFN_REF_ISR (-188)
 #define TFN_REF_SPN (-189)
+#define TFN_REF_OST (-190)
+#define TFN_REF_SNP (-191)
 #define TFN_ACRE_TSK (-193)
 #define TFN_ACRE_SEM (-194)
 #define TFN_ACRE_FLG (-195)
@@ -167,6 +171,10 @@
 #define TFN_SAC_ALM (-235)
 #define TFN_SAC_ISR (-236)
 #define TFN_SAC_SPN (-237)
+#define TFN_SIG_CHN (-241)
+#define TFN_WAI_CHN (-242)
+#define TFN_TWAI_CHN (-243)
+#define TFN_REF_CHN (-244)
 #define TFN_DEF_SVC (-245)
 #define TFN_MACT_TSK (-257)
 #define TFN_MIG_TSK (-259)
@@ -78,6 +78,33 @@ extern void	syslog_print(const SYSLOG *p_syslog, void (*putc)(char)) throw();
  */
 extern void	syslog_lostmsg(uint_t lostlog, void (*putc)(char)) throw();
 
+/*
+ *  バッファへの文字列整形
+ *
+ *  formatで指定されるフォーマット記述とargsで指定される引数列から作成
+ *  したメッセージを，bufで指定される大きさsizeの領域に格納し，格納した
+ *  文字数を返す．入り切らない文字は捨てる．末尾にナル文字は付加しない．
+ */
+extern uint_t	syslog_sprintf(char *buf, uint_t size, const char *format,
+											const LOGPAR args[]) throw();
+
+/*
+ *  バッファへのログ情報の整形
+ *
+ *  p_syslogで指定されるログ情報を文字列に整形してbufに格納し，格納した
+ *  文字数を返す．
+ */
+extern uint_t	syslog_sprint(char *buf, uint_t size,
+											const SYSLOG *p_syslog) throw();
+
+/*
+ *  バッファへのログ情報喪失メッセージの整形
+ *
+ *  lostlog個のログ情報が失われた旨のメッセージをbufに格納し，格納した
+ *  文字数を返す．
+ */
+extern uint_t	syslog_slostmsg(char *buf, uint_t size, uint_t lostlog) throw();
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,6 +18,8 @@ extern ER _kernel_tslp_tsk(TMO tmout) throw();
 extern ER _kernel_wup_tsk(ID tskid) throw();
 extern ER_UINT _kernel_can_wup(ID tskid) throw();
 extern ER _kernel_rel_wai(ID tskid) throw();
+extern ER _kernel_chg_dln(ID tskid, RELTIM reldln) throw();
+extern ER _kernel_ref_stk(ID tskid, T_RSTK *pk_rstk) throw();
 extern ER _kernel_sus_tsk(ID tskid) throw();
 extern ER _kernel_rsm_tsk(ID tskid) throw();
 extern ER _kernel_dly_tsk(RELTIM dlytim) throw();
@@ -138,6 +140,12 @@ extern ER _kernel_ref_mbf(ID mbfid, T_RMBF *pk_rmbf) throw();
 extern ER _kernel_ref_mpf(ID mpfid, T_RMPF *pk_rmpf) throw();
 extern ER _kernel_ref_cyc(ID cycid, T_RCYC *pk_rcyc) throw();
 extern ER _kernel_ref_alm(ID almid, T_RALM *pk_ralm) throw();
+extern ER_UINT _kernel_ref_ost(uint_t objtyp, ID objid, uint_t num, T_ROST *pk_rost) throw();
+extern ER_UINT _kernel_ref_snp(uint_t objtyp, ID objid, uint_t num, void *pk_rsnp, uint_t *p_snpgen) throw();
+extern ER _kernel_sig_chn(ID chnid, MODE chnmode) throw();
+extern ER _kernel_wai_chn(ID chnid, MODE chnmode) throw();
+extern ER _kernel_twai_chn(ID chnid, MODE chnmode, TMO tmout) throw();
+extern ER _kernel_ref_chn(ID chnid, T_RCHN *pk_rchn) throw();
 #ifdef TOPPERS_SUPPORT_SUBPRIO
 extern ER _kernel_chg_spr(ID tskid, uint_t subpri) throw();
 #endif /* TOPPERS_SUPPORT_SUBPRIO */
@@ -162,6 +170,8 @@ extern ER _kernel_mget_nth(ID schedno, PRI tskpri, uint_t nth, ID *p_tskid) thro
 #define wup_tsk _kernel_wup_tsk
 #define can_wup _kernel_can_wup
 #define rel_wai _kernel_rel_wai
+#define chg_dln _kernel_chg_dln
+#define ref_stk _kernel_ref_stk
 #define sus_tsk _kernel_sus_tsk
 #define rsm_tsk _kernel_rsm_tsk
 #define dly_tsk _kernel_dly_tsk
@@ -282,6 +292,12 @@ extern ER _kernel_mget_nth(ID schedno, PRI tskpri, uint_t nth, ID *p_tskid) thro
 #define ref_mpf _kernel_ref_mpf
 #define ref_cyc _kernel_ref_cyc
 #define ref_alm _kernel_ref_alm
+#define ref_ost _kernel_ref_ost
+#define ref_snp _kernel_ref_snp
+#define sig_chn _kernel_sig_chn
+#define wai_chn _kernel_wai_chn
+#define twai_chn _kernel_twai_chn
+#define ref_chn _kernel_ref_chn
 #ifdef TOPPERS_SUPPORT_SUBPRIO
 #define chg_spr _kernel_chg_spr
 #endif /* TOPPERS_SUPPORT_SUBPRIO */
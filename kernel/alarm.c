@@ -234,6 +234,17 @@ call_alarm(ALMCB *p_almcb)
 	 */
 	p_almcb->almsta = false;
 
+	if ((p_almcb->p_alminib->almatr & TA_NFYLOCK) != 0U) {
+		/*
+		 *  コンフィギュレータがカーネル内部の処理で生成した通知ハンド
+		 *  ラは，CPUロック状態のまま呼び出す．
+		 */
+		LOG_ALM_ENTER(p_almcb);
+		(*(p_almcb->p_alminib->nfyhdr))(p_almcb->p_alminib->exinf);
+		LOG_ALM_LEAVE(p_almcb);
+		return;
+	}
+
 	/*
 	 *  通知ハンドラを，CPUロック解除状態で呼び出す．
 	 */
@@ -58,7 +58,9 @@
 #define TOPPERS_scycswitch
 #define TOPPERS_twdstart
 #define TOPPERS_twdswitch
+#define TOPPERS_slktsk
 #define TOPPERS_setdspflg
+#define TOPPERS_rlsdsphld
 #define TOPPERS_chg_som
 #define TOPPERS_get_som
 
@@ -71,6 +73,8 @@
 #define TOPPERS_tskact
 #define TOPPERS_tskpri
 #define TOPPERS_tskrot
+#define TOPPERS_tskdln
+#define TOPPERS_tskstk
 #define TOPPERS_tskterm
 
 /* taskhook.c */
@@ -93,6 +97,7 @@
 #define TOPPERS_memprbw
 #define TOPPERS_memprbr
 #define TOPPERS_secini
+#define TOPPERS_lzsecini
 
 /* time_event.c */
 #define TOPPERS_tmeini
@@ -111,19 +116,24 @@
 
 /* task_manage.c */
 #define TOPPERS_act_tsk
+#define TOPPERS_nfyact
 #define TOPPERS_can_act
 #define TOPPERS_get_tst
 #define TOPPERS_chg_pri
 #define TOPPERS_get_pri
 #define TOPPERS_get_inf
+#define TOPPERS_chg_dln
 
 /* task_refer.c */
+#define TOPPERS_tskref
 #define TOPPERS_ref_tsk
+#define TOPPERS_ref_stk
 
 /* task_sync.c */
 #define TOPPERS_slp_tsk
 #define TOPPERS_tslp_tsk
 #define TOPPERS_wup_tsk
+#define TOPPERS_nfywup
 #define TOPPERS_can_wup
 #define TOPPERS_rel_wai
 #define TOPPERS_sus_tsk
@@ -141,6 +151,7 @@
 /* semaphore.c */
 #define TOPPERS_semini
 #define TOPPERS_sig_sem
+#define TOPPERS_nfysig
 #define TOPPERS_wai_sem
 #define TOPPERS_pol_sem
 #define TOPPERS_twai_sem
@@ -151,6 +162,7 @@
 #define TOPPERS_flgini
 #define TOPPERS_flgcnd
 #define TOPPERS_set_flg
+#define TOPPERS_nfyset
 #define TOPPERS_clr_flg
 #define TOPPERS_wai_flg
 #define TOPPERS_pol_flg
@@ -233,6 +245,24 @@
 #define TOPPERS_ini_mpf
 #define TOPPERS_ref_mpf
 
+/* channel.c */
+#define TOPPERS_chnini
+#define TOPPERS_chnwup
+#define TOPPERS_sig_chn
+#define TOPPERS_wai_chn
+#define TOPPERS_twai_chn
+#define TOPPERS_ref_chn
+
+/* objstat.c */
+#define TOPPERS_ostini
+#define TOPPERS_ostwai
+#define TOPPERS_ostchg
+#define TOPPERS_ref_ost
+
+/* snapshot.c */
+#define TOPPERS_snpgen
+#define TOPPERS_ref_snp
+
 /* time_manage.c */
 #define TOPPERS_set_tim
 #define TOPPERS_get_tim
@@ -245,6 +275,7 @@
 #define TOPPERS_stp_cyc
 #define TOPPERS_ref_cyc
 #define TOPPERS_cyccal
+#define TOPPERS_cycgcal
 
 /* alarm.c */
 #define TOPPERS_almini
@@ -278,6 +309,9 @@
 
 /* interrupt.c */
 #define TOPPERS_intini
+#define TOPPERS_disrini
+#define TOPPERS_disrreq
+#define TOPPERS_disrtsk
 #define TOPPERS_dis_int
 #define TOPPERS_ena_int
 #define TOPPERS_clr_int
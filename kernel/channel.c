@@ -0,0 +1,407 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		チャネル機能
+ */
+
+#include "kernel_impl.h"
+#include "check.h"
+#include "task.h"
+#include "wait.h"
+#include "channel.h"
+
+/*
+ *  トレースログマクロのデフォルト定義
+ */
+#ifndef LOG_SIG_CHN_ENTER
+#define LOG_SIG_CHN_ENTER(chnid, chnmode)
+#endif /* LOG_SIG_CHN_ENTER */
+
+#ifndef LOG_SIG_CHN_LEAVE
+#define LOG_SIG_CHN_LEAVE(ercd)
+#endif /* LOG_SIG_CHN_LEAVE */
+
+#ifndef LOG_WAI_CHN_ENTER
+#define LOG_WAI_CHN_ENTER(chnid, chnmode)
+#endif /* LOG_WAI_CHN_ENTER */
+
+#ifndef LOG_WAI_CHN_LEAVE
+#define LOG_WAI_CHN_LEAVE(ercd)
+#endif /* LOG_WAI_CHN_LEAVE */
+
+#ifndef LOG_TWAI_CHN_ENTER
+#define LOG_TWAI_CHN_ENTER(chnid, chnmode, tmout)
+#endif /* LOG_TWAI_CHN_ENTER */
+
+#ifndef LOG_TWAI_CHN_LEAVE
+#define LOG_TWAI_CHN_LEAVE(ercd)
+#endif /* LOG_TWAI_CHN_LEAVE */
+
+#ifndef LOG_REF_CHN_ENTER
+#define LOG_REF_CHN_ENTER(chnid, pk_rchn)
+#endif /* LOG_REF_CHN_ENTER */
+
+#ifndef LOG_REF_CHN_LEAVE
+#define LOG_REF_CHN_LEAVE(ercd, pk_rchn)
+#endif /* LOG_REF_CHN_LEAVE */
+
+/*
+ *  チャネルの数
+ */
+#define tnum_chn	((uint_t)(tmax_chnid - TMIN_CHNID + 1))
+
+/*
+ *  チャネルIDからチャネル管理ブロックを取り出すためのマクロ
+ */
+#define INDEX_CHN(chnid)	((uint_t)((chnid) - TMIN_CHNID))
+#define get_chncb(chnid)	(&(chncb_table[INDEX_CHN(chnid)]))
+
+/*
+ *  動作モードの判定とアクセス許可パターンの選択
+ *
+ *  送信側（TCHN_SND）の操作は通常操作1，受信側（TCHN_RCV）の操作は通
+ *  常操作2として，アクセス許可の検査を行う．
+ */
+#define VALID_CHNMODE(chnmode)	((chnmode) == TCHN_SND || (chnmode) == TCHN_RCV)
+#define CHN_ACPTN(p_chncb, chnmode)	((chnmode) == TCHN_SND					\
+								? (p_chncb)->p_chninib->acvct.acptn1		\
+								: (p_chncb)->p_chninib->acvct.acptn2)
+
+/*
+ *  チャネル中のブロック数
+ *
+ *  送信したブロック数の累計と受信を終えたブロック数の累計は，アプリケー
+ *  ションが更新するため，その差がブロック数を超える場合がある．その場
+ *  合には，チャネルの状態が不正であるとみなす．
+ */
+Inline uint_t
+channel_count(CHNCB *p_chncb)
+{
+	return(p_chncb->p_chninib->p_chnsnd->sndcnt
+								- p_chncb->p_chninib->p_chnrcv->rcvcnt);
+}
+
+#define CHANNEL_BROKEN(p_chncb, cnt)	((cnt) > (p_chncb)->p_chninib->blkcnt)
+
+/*
+ *  待ち解除の条件の判定
+ *
+ *  送信側は空きブロックがある場合，受信側は受信すべきブロックがある場
+ *  合に，待ち解除の条件が成立する．
+ */
+Inline bool_t
+channel_ready(CHNCB *p_chncb, uint_t cnt, MODE chnmode)
+{
+	if (chnmode == TCHN_SND) {
+		return(cnt < p_chncb->p_chninib->blkcnt);
+	}
+	else {
+		return(cnt > 0U);
+	}
+}
+
+/*
+ *  チャネルの待ちキューへの挿入
+ *
+ *  待ち状態に入ったことを，相手側が参照する管理領域に記録する．相手側
+ *  は，ブロック数の累計を更新した後にこれを参照し，待っているタスクが
+ *  ある場合にのみsig_chnを呼び出す．
+ */
+Inline void
+channel_enqueue(CHNCB *p_chncb, MODE chnmode, WINFO_CHN *p_winfo_chn)
+{
+	if (chnmode == TCHN_SND) {
+		p_chncb->p_chninib->p_chnrcv->swait = 1U;
+		queue_insert_prev(&(p_chncb->swait_queue), &(p_runtsk->task_queue));
+	}
+	else {
+		p_chncb->p_chninib->p_chnsnd->rwait = 1U;
+		queue_insert_prev(&(p_chncb->rwait_queue), &(p_runtsk->task_queue));
+	}
+	p_winfo_chn->p_chncb = p_chncb;
+	LOG_TSKSTAT(p_runtsk);
+}
+
+#define TS_WAITING_CHN(chnmode)	((chnmode) == TCHN_SND					\
+										? TS_WAITING_SCHN : TS_WAITING_RCHN)
+
+/*
+ *  チャネル機能の初期化
+ */
+#ifdef TOPPERS_chnini
+
+void
+initialize_channel(void)
+{
+	uint_t	i;
+	CHNCB	*p_chncb;
+	const CHNINIB *p_chninib;
+
+	for (i = 0; i < tnum_chn; i++) {
+		p_chncb = &(chncb_table[i]);
+		queue_initialize(&(p_chncb->swait_queue));
+		queue_initialize(&(p_chncb->rwait_queue));
+		p_chninib = &(chninib_table[i]);
+		p_chncb->p_chninib = p_chninib;
+		p_chninib->p_chnsnd->sndcnt = 0U;
+		p_chninib->p_chnsnd->rwait = 0U;
+		p_chninib->p_chnrcv->rcvcnt = 0U;
+		p_chninib->p_chnrcv->swait = 0U;
+	}
+}
+
+#endif /* TOPPERS_chnini */
+
+/*
+ *  チャネルの待ち解除
+ */
+#ifdef TOPPERS_chnwup
+
+void
+channel_wakeup(CHNCB *p_chncb, MODE chnmode)
+{
+	uint_t	cnt;
+	QUEUE	*p_wait_queue;
+	TCB		*p_tcb;
+
+	cnt = channel_count(p_chncb);
+	if (CHANNEL_BROKEN(p_chncb, cnt) || !channel_ready(p_chncb, cnt, chnmode)) {
+		return;
+	}
+
+	if (chnmode == TCHN_SND) {
+		p_chncb->p_chninib->p_chnrcv->swait = 0U;
+		p_wait_queue = &(p_chncb->swait_queue);
+	}
+	else {
+		p_chncb->p_chninib->p_chnsnd->rwait = 0U;
+		p_wait_queue = &(p_chncb->rwait_queue);
+	}
+	while (!queue_empty(p_wait_queue)) {
+		p_tcb = (TCB *) queue_delete_next(p_wait_queue);
+		wait_complete(p_tcb);
+	}
+}
+
+#endif /* TOPPERS_chnwup */
+
+/*
+ *  チャネルの相手側への通知
+ *
+ *  送信側（TCHN_SND）はブロックを送信したことを，受信側（TCHN_RCV）
+ *  はブロックの受信を終えたことを通知し，相手側の待ちタスクを待ち解除
+ *  する．
+ */
+#ifdef TOPPERS_sig_chn
+
+ER
+sig_chn(ID chnid, MODE chnmode)
+{
+	CHNCB	*p_chncb;
+	ER		ercd;
+
+	LOG_SIG_CHN_ENTER(chnid, chnmode);
+	CHECK_UNL();
+	CHECK_ID(VALID_CHNID(chnid));
+	CHECK_PAR(VALID_CHNMODE(chnmode));
+	p_chncb = get_chncb(chnid);
+	CHECK_ACPTN(CHN_ACPTN(p_chncb, chnmode));
+
+	lock_cpu();
+	channel_wakeup(p_chncb, (chnmode == TCHN_SND) ? TCHN_RCV : TCHN_SND);
+	if (p_runtsk != p_schedtsk) {
+		if (!sense_context()) {
+			dispatch();
+		}
+		else {
+			request_dispatch_retint();
+		}
+	}
+	ercd = E_OK;
+	unlock_cpu();
+
+  error_exit:
+	LOG_SIG_CHN_LEAVE(ercd);
+	return(ercd);
+}
+
+#endif /* TOPPERS_sig_chn */
+
+/*
+ *  チャネルの待ち
+ *
+ *  送信側（TCHN_SND）は空きブロックができるまで，受信側（TCHN_RCV）は
+ *  受信すべきブロックができるまで待つ．
+ */
+#ifdef TOPPERS_wai_chn
+
+ER
+wai_chn(ID chnid, MODE chnmode)
+{
+	CHNCB		*p_chncb;
+	WINFO_CHN	winfo_chn;
+	uint_t		cnt;
+	ER			ercd;
+
+	LOG_WAI_CHN_ENTER(chnid, chnmode);
+	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
+	CHECK_ID(VALID_CHNID(chnid));
+	CHECK_PAR(VALID_CHNMODE(chnmode));
+	p_chncb = get_chncb(chnid);
+	CHECK_ACPTN(CHN_ACPTN(p_chncb, chnmode));
+
+	lock_cpu_dsp();
+	cnt = channel_count(p_chncb);
+	if (p_runtsk->raster) {
+		ercd = E_RASTER;
+	}
+	else if (CHANNEL_BROKEN(p_chncb, cnt)) {
+		ercd = E_OBJ;
+	}
+	else if (channel_ready(p_chncb, cnt, chnmode)) {
+		ercd = E_OK;
+	}
+	else {
+		make_wait(TS_WAITING_CHN(chnmode), &(winfo_chn.winfo));
+		channel_enqueue(p_chncb, chnmode, &winfo_chn);
+		dispatch();
+		ercd = winfo_chn.winfo.wercd;
+	}
+	unlock_cpu_dsp();
+
+  error_exit:
+	LOG_WAI_CHN_LEAVE(ercd);
+	return(ercd);
+}
+
+#endif /* TOPPERS_wai_chn */
+
+/*
+ *  チャネルの待ち（タイムアウトあり）
+ */
+#ifdef TOPPERS_twai_chn
+
+ER
+twai_chn(ID chnid, MODE chnmode, TMO tmout)
+{
+	CHNCB		*p_chncb;
+	WINFO_CHN	winfo_chn;
+	TMEVTB		tmevtb;
+	uint_t		cnt;
+	ER			ercd;
+
+	LOG_TWAI_CHN_ENTER(chnid, chnmode, tmout);
+	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
+	CHECK_ID(VALID_CHNID(chnid));
+	CHECK_PAR(VALID_CHNMODE(chnmode));
+	CHECK_PAR(VALID_TMOUT(tmout));
+	p_chncb = get_chncb(chnid);
+	CHECK_ACPTN(CHN_ACPTN(p_chncb, chnmode));
+
+	lock_cpu_dsp();
+	cnt = channel_count(p_chncb);
+	if (p_runtsk->raster) {
+		ercd = E_RASTER;
+	}
+	else if (CHANNEL_BROKEN(p_chncb, cnt)) {
+		ercd = E_OBJ;
+	}
+	else if (channel_ready(p_chncb, cnt, chnmode)) {
+		ercd = E_OK;
+	}
+	else if (tmout == TMO_POL) {
+		ercd = E_TMOUT;
+	}
+	else {
+		make_wait_tmout(TS_WAITING_CHN(chnmode), &(winfo_chn.winfo),
+														&tmevtb, tmout);
+		channel_enqueue(p_chncb, chnmode, &winfo_chn);
+		dispatch();
+		ercd = winfo_chn.winfo.wercd;
+	}
+	unlock_cpu_dsp();
+
+  error_exit:
+	LOG_TWAI_CHN_LEAVE(ercd);
+	return(ercd);
+}
+
+#endif /* TOPPERS_twai_chn */
+
+/*
+ *  チャネルの状態参照
+ */
+#ifdef TOPPERS_ref_chn
+
+ER
+ref_chn(ID chnid, T_RCHN *pk_rchn)
+{
+	CHNCB	*p_chncb;
+	const CHNINIB *p_chninib;
+	ER		ercd;
+
+	LOG_REF_CHN_ENTER(chnid, pk_rchn);
+	CHECK_TSKCTX_UNL();
+	CHECK_ID(VALID_CHNID(chnid));
+	CHECK_MACV_WRITE(pk_rchn, T_RCHN);
+	p_chncb = get_chncb(chnid);
+	p_chninib = p_chncb->p_chninib;
+	CHECK_ACPTN(p_chninib->acvct.acptn4);
+
+	lock_cpu();
+	pk_rchn->stskid = wait_tskid(&(p_chncb->swait_queue));
+	pk_rchn->rtskid = wait_tskid(&(p_chncb->rwait_queue));
+	pk_rchn->chnid = chnid;
+	pk_rchn->blkcnt = p_chninib->blkcnt;
+	pk_rchn->blksz = p_chninib->blksz;
+	pk_rchn->chn = p_chninib->chn;
+	pk_rchn->p_chnsnd = p_chninib->p_chnsnd;
+	pk_rchn->p_chnrcv = p_chninib->p_chnrcv;
+	ercd = E_OK;
+	unlock_cpu();
+
+  error_exit:
+	LOG_REF_CHN_LEAVE(ercd, pk_rchn);
+	return(ercd);
+}
+
+#endif /* TOPPERS_ref_chn */
@@ -0,0 +1,123 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		チャネル機能
+ *
+ *  チャネルは，送信側と受信側の保護ドメインの間で，固定長のブロック
+ *  をリングバッファで受け渡すためのオブジェクトである．チャネル領域
+ *  と送信側管理領域は送信側の保護ドメインから書込み可能，受信側の保
+ *  護ドメインから読出し可能なメモリオブジェクトに，受信側管理領域は
+ *  その逆のメモリオブジェクトに，コンフィギュレータが配置する．ブロッ
+ *  クの書込みと読出し，送信・受信したブロック数の更新はアプリケーショ
+ *  ンが直接行い（chnblk.h），カーネルは待ち状態への遷移と待ち解除のみ
+ *  を行う．
+ */
+
+#ifndef TOPPERS_CHANNEL_H
+#define TOPPERS_CHANNEL_H
+
+#include "kernel_impl.h"
+#include <queue.h>
+#include "wait.h"
+
+/*
+ *  チャネル初期化ブロック
+ */
+typedef struct channel_initialization_block {
+	ATR			chnatr;			/* チャネル属性 */
+	uint_t		blkcnt;			/* ブロック数 */
+	uint_t		blksz;			/* ブロックのサイズ（丸めた値） */
+	void		*chn;			/* チャネル領域の先頭番地 */
+	T_CHNSND	*p_chnsnd;		/* 送信側管理領域の先頭番地 */
+	T_CHNRCV	*p_chnrcv;		/* 受信側管理領域の先頭番地 */
+	ACVCT		acvct;			/* アクセス許可ベクタ */
+} CHNINIB;
+
+/*
+ *  チャネル管理ブロック
+ */
+typedef struct channel_control_block {
+	QUEUE		swait_queue;	/* 空きブロック待ちキュー */
+	QUEUE		rwait_queue;	/* 受信ブロック待ちキュー */
+	const CHNINIB *p_chninib;	/* 初期化ブロックへのポインタ */
+} CHNCB;
+
+/*
+ *  チャネル待ち情報ブロックの定義
+ */
+typedef struct channel_waiting_information {
+	WINFO		winfo;			/* 標準の待ち情報ブロック */
+	CHNCB		*p_chncb;		/* 待っているチャネルの管理ブロック */
+} WINFO_CHN;
+
+/*
+ *  チャネルIDの最大値（kernel_cfg.c）
+ */
+extern const ID	tmax_chnid;
+
+/*
+ *  チャネル初期化ブロックのエリア（kernel_cfg.c）
+ */
+extern const CHNINIB	chninib_table[];
+
+/*
+ *  チャネル管理ブロックのエリア（kernel_cfg.c）
+ */
+extern CHNCB	chncb_table[];
+
+/*
+ *  チャネル管理ブロックからチャネルIDを取り出すためのマクロ
+ */
+#define	CHNID(p_chncb)	((ID)(((p_chncb) - chncb_table) + TMIN_CHNID))
+
+/*
+ *  チャネル機能の初期化
+ */
+extern void	initialize_channel(void);
+
+/*
+ *  チャネルの待ち解除
+ *
+ *  chnmodeで指定した側の待ち解除の条件が成立していれば，待ちキュー中
+ *  のすべてのタスクを待ち解除する．
+ */
+extern void	channel_wakeup(CHNCB *p_chncb, MODE chnmode);
+
+#endif /* TOPPERS_CHANNEL_H */
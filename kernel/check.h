@@ -63,6 +63,7 @@
 #define VALID_MTXID(mtxid)	(TMIN_MTXID <= (mtxid) && (mtxid) <= tmax_mtxid)
 #define VALID_MBFID(mbfid)	(TMIN_MBFID <= (mbfid) && (mbfid) <= tmax_mbfid)
 #define VALID_MPFID(mpfid)	(TMIN_MPFID <= (mpfid) && (mpfid) <= tmax_mpfid)
+#define VALID_CHNID(chnid)	(TMIN_CHNID <= (chnid) && (chnid) <= tmax_chnid)
 #define VALID_CYCID(cycid)	(TMIN_CYCID <= (cycid) && (cycid) <= tmax_cycid)
 #define VALID_ALMID(almid)	(TMIN_ALMID <= (almid) && (almid) <= tmax_almid)
 
@@ -127,6 +128,26 @@
 	}														\
 } while (false)
 
+/*
+ *  制約タスクからの呼出しでないかのチェック（E_NOSPT）
+ */
+#define CHECK_NONRSTR_CALLER() do {							\
+	if ((p_runtsk->p_tinib->tskatr & TA_RSTR) != 0U) {		\
+		ercd = E_NOSPT;										\
+		goto error_exit;									\
+	}														\
+} while (false)
+
+/*
+ *  対象タスクが制約タスクでないかのチェック（E_NOSPT）
+ */
+#define CHECK_NONRSTR(p_tcb) do {							\
+	if (((p_tcb)->p_tinib->tskatr & TA_RSTR) != 0U) {		\
+		ercd = E_NOSPT;										\
+		goto error_exit;									\
+	}														\
+} while (false)
+
 /*
  *  その他のコンテキストエラーのチェック（E_CTX）
  */
@@ -94,6 +94,60 @@
 #define INDEX_CYC(cycid)	((uint_t)((cycid) - TMIN_CYCID))
 #define get_cyccb(cycid)	(&(cyccb_table[INDEX_CYC(cycid)]))
 
+/*
+ *  周期通知グループからの離脱
+ *
+ *  周期通知グループにより起動される周期通知を，グループから外す．グ
+ *  ループにより起動される周期通知がなくなった場合には，グループのタイ
+ *  ムイベントをタイムイベントヒープから削除する．CPUロック状態で呼び
+ *  出さなければならない．
+ */
+Inline void
+leave_cycgrp(CYCCB *p_cyccb)
+{
+	CYCGCB	*p_cycgcb = p_cyccb->p_cycinib->p_cycgcb;
+
+	p_cyccb->ingrp = false;
+	p_cycgcb->actcnt -= 1U;
+	if (p_cycgcb->actcnt == 0U) {
+		tmevtb_dequeue(&(p_cycgcb->tmevtb),
+							p_cycgcb->p_cycginib->p_tmevt_heap);
+	}
+}
+
+/*
+ *  周期通知の通知ハンドラの呼出し
+ *
+ *  CPUロック状態で呼び出され，CPUロック状態でリターンする．
+ */
+Inline void
+invoke_cyclic(CYCCB *p_cyccb)
+{
+	if ((p_cyccb->p_cycinib->cycatr & TA_NFYLOCK) != 0U) {
+		/*
+		 *  コンフィギュレータがカーネル内部の処理で生成した通知ハンド
+		 *  ラは，CPUロック状態のまま呼び出す．
+		 */
+		LOG_CYC_ENTER(p_cyccb);
+		(*(p_cyccb->p_cycinib->nfyhdr))(p_cyccb->p_cycinib->exinf);
+		LOG_CYC_LEAVE(p_cyccb);
+		return;
+	}
+
+	/*
+	 *  通知ハンドラを，CPUロック解除状態で呼び出す．
+	 */
+	unlock_cpu();
+
+	LOG_CYC_ENTER(p_cyccb);
+	(*(p_cyccb->p_cycinib->nfyhdr))(p_cyccb->p_cycinib->exinf);
+	LOG_CYC_LEAVE(p_cyccb);
+
+	if (!sense_lock()) {
+		lock_cpu();
+	}
+}
+
 /*
  *  周期通知機能の初期化
  */
@@ -104,13 +158,23 @@ initialize_cyclic(void)
 {
 	uint_t	i;
 	CYCCB	*p_cyccb;
+	CYCGCB	*p_cycgcb;
 
 	for (i = 0; i < tnum_cyc; i++) {
 		p_cyccb = &(cyccb_table[i]);
 		p_cyccb->p_cycinib = &(cycinib_table[i]);
 		p_cyccb->tmevtb.callback = (CBACK) call_cyclic;
 		p_cyccb->tmevtb.arg = (void *) p_cyccb;
-		if ((p_cyccb->p_cycinib->cycatr & TA_STA) != 0U) {
+		p_cyccb->ingrp = false;
+		if (p_cyccb->p_cycinib->p_cycgcb != NULL) {
+			/*
+			 *  周期通知グループに属する周期通知は，グループのタイムイベ
+			 *  ントにより起動する．
+			 */
+			p_cyccb->cycsta = true;
+			p_cyccb->ingrp = true;
+		}
+		else if ((p_cyccb->p_cycinib->cycatr & TA_STA) != 0U) {
 			/*
 			 *  初回の起動のためのタイムイベントを登録する［ASPD1035］
 			 *  ［ASPD1062］．
@@ -124,6 +188,21 @@ initialize_cyclic(void)
 			p_cyccb->cycsta = false;
 		}
 	}
+
+	for (i = 0; i < tnum_cycgrp; i++) {
+		p_cycgcb = &(cycgcb_table[i]);
+		p_cycgcb->p_cycginib = &(cycginib_table[i]);
+		p_cycgcb->actcnt = p_cycgcb->p_cycginib->tnum_member;
+		p_cycgcb->tmevtb.callback = (CBACK) call_cycgrp;
+		p_cycgcb->tmevtb.arg = (void *) p_cycgcb;
+
+		/*
+		 *  初回の起動のためのタイムイベントを登録する．
+		 */
+		p_cycgcb->tmevtb.evttim = (EVTTIM)(p_cycgcb->p_cycginib->cycphs);
+		tmevtb_register(&(p_cycgcb->tmevtb),
+									p_cycgcb->p_cycginib->p_tmevt_heap);
+	}
 }
 
 #endif /* TOPPERS_cycini */
@@ -147,7 +226,17 @@ sta_cyc(ID cycid)
 
 	lock_cpu();
 	if (p_cyccb->cycsta) {
-		tmevtb_dequeue(&(p_cyccb->tmevtb), p_cyccb->p_cycinib->p_tmevt_heap);
+		if (p_cyccb->ingrp) {
+			/*
+			 *  動作開始された周期通知は，周期通知グループから外れ，自
+			 *  身のタイムイベントにより起動する．
+			 */
+			leave_cycgrp(p_cyccb);
+		}
+		else {
+			tmevtb_dequeue(&(p_cyccb->tmevtb),
+									p_cyccb->p_cycinib->p_tmevt_heap);
+		}
 	}
 	else {
 		p_cyccb->cycsta = true;
@@ -187,7 +276,13 @@ stp_cyc(ID cycid)
 	lock_cpu();
 	if (p_cyccb->cycsta) {
 		p_cyccb->cycsta = false;
-		tmevtb_dequeue(&(p_cyccb->tmevtb), p_cyccb->p_cycinib->p_tmevt_heap);
+		if (p_cyccb->ingrp) {
+			leave_cycgrp(p_cyccb);
+		}
+		else {
+			tmevtb_dequeue(&(p_cyccb->tmevtb),
+									p_cyccb->p_cycinib->p_tmevt_heap);
+		}
 	}
 	ercd = E_OK;
 	unlock_cpu();
@@ -220,7 +315,13 @@ ref_cyc(ID cycid, T_RCYC *pk_rcyc)
 	lock_cpu();
 	if (p_cyccb->cycsta) {
 		pk_rcyc->cycstat = TCYC_STA;
-		pk_rcyc->lefttim = tmevt_lefttim(&(p_cyccb->tmevtb));
+		if (p_cyccb->ingrp) {
+			pk_rcyc->lefttim
+				= tmevt_lefttim(&(p_cyccb->p_cycinib->p_cycgcb->tmevtb));
+		}
+		else {
+			pk_rcyc->lefttim = tmevt_lefttim(&(p_cyccb->tmevtb));
+		}
 	}
 	else {
 		pk_rcyc->cycstat = TCYC_STP;
@@ -253,18 +354,39 @@ call_cyclic(CYCCB *p_cyccb)
 	p_cyccb->tmevtb.evttim += p_cyccb->p_cycinib->cyctim;	/*［ASPD1038］*/
 	tmevtb_register(&(p_cyccb->tmevtb), p_cyccb->p_cycinib->p_tmevt_heap);
 
+	invoke_cyclic(p_cyccb);
+}
+
+#endif /* TOPPERS_cyccal */
+
+/*
+ *  周期通知グループ起動ルーチン
+ */
+#ifdef TOPPERS_cycgcal
+
+void
+call_cycgrp(CYCGCB *p_cycgcb)
+{
+	const CYCGINIB	*p_cycginib = p_cycgcb->p_cycginib;
+	CYCCB			*p_cyccb;
+	uint_t			i;
+
 	/*
-	 *  通知ハンドラを，CPUロック解除状態で呼び出す．
+	 *  次回の起動のためのタイムイベントを登録する．
 	 */
-	unlock_cpu();
-
-	LOG_CYC_ENTER(p_cyccb);
-	(*(p_cyccb->p_cycinib->nfyhdr))(p_cyccb->p_cycinib->exinf);
-	LOG_CYC_LEAVE(p_cyccb);
+	p_cycgcb->tmevtb.evttim += p_cycginib->cyctim;
+	tmevtb_register(&(p_cycgcb->tmevtb), p_cycginib->p_tmevt_heap);
 
-	if (!sense_lock()) {
-		lock_cpu();
+	/*
+	 *  グループにより起動される周期通知を，周期通知ID順に呼び出す．通
+	 *  知ハンドラの中でグループから外れた周期通知は呼び出さない．
+	 */
+	for (i = 0; i < p_cycginib->tnum_member; i++) {
+		p_cyccb = p_cycginib->p_member[i];
+		if (p_cyccb->ingrp) {
+			invoke_cyclic(p_cyccb);
+		}
 	}
 }
 
-#endif /* TOPPERS_cyccal */
+#endif /* TOPPERS_cycgcal */
@@ -61,6 +61,8 @@ typedef struct cyclic_handler_initialization_block {
 	RELTIM		cyctim;			/* 周期通知の起動周期 */
 	RELTIM		cycphs;			/* 周期通知の起動位相 */
 	ACVCT		acvct;			/* アクセス許可ベクタ */
+	struct cyclic_group_control_block *p_cycgcb;
+								/* 周期通知グループ（属さない場合はNULL）*/
 } CYCINIB;
 
 /*
@@ -72,9 +74,40 @@ typedef struct cyclic_handler_initialization_block {
 typedef struct cyclic_handler_control_block {
 	const CYCINIB *p_cycinib;	/* 初期化ブロックへのポインタ */
 	bool_t		cycsta;			/* 周期通知の動作状態 */
+	bool_t		ingrp;			/* 周期通知グループにより起動されるか */
 	TMEVTB		tmevtb;			/* タイムイベントブロック */
 } CYCCB;
 
+/*
+ *  周期通知グループ初期化ブロック
+ *
+ *  TA_STA属性を持ち，起動周期と起動位相が同じで，同じタイムイベント
+ *  ヒープを用いる周期通知は，コンフィギュレータが周期通知グループにま
+ *  とめる．周期通知グループに属する周期通知は，グループの1つのタイム
+ *  イベントにより，周期通知ID順に起動される．sta_cycにより動作開始さ
+ *  れた周期通知は，周期通知グループから外れ，自身のタイムイベントによ
+ *  り起動される．
+ */
+typedef struct cyclic_group_initialization_block {
+	TMEVTN		*p_tmevt_heap;	/* タイムイベントヒープ */
+	RELTIM		cyctim;			/* 起動周期 */
+	RELTIM		cycphs;			/* 起動位相 */
+	uint_t		tnum_member;	/* 属する周期通知の数 */
+	CYCCB *const *p_member;		/* 属する周期通知のリスト */
+} CYCGINIB;
+
+/*
+ *  周期通知グループ管理ブロック
+ *
+ *  actcntが0でない間，タイムイベントブロック（tmevtb）をタイムイベン
+ *  トヒープに登録しておく．
+ */
+typedef struct cyclic_group_control_block {
+	const CYCGINIB *p_cycginib;	/* 初期化ブロックへのポインタ */
+	uint_t		actcnt;			/* グループにより起動される周期通知の数 */
+	TMEVTB		tmevtb;			/* タイムイベントブロック */
+} CYCGCB;
+
 /*
  *  周期通知IDの最大値（kernel_cfg.c）
  */
@@ -90,6 +123,21 @@ extern const CYCINIB	cycinib_table[];
  */
 extern CYCCB	cyccb_table[];
 
+/*
+ *  周期通知グループの数（kernel_cfg.c）
+ */
+extern const uint_t	tnum_cycgrp;
+
+/*
+ *  周期通知グループ初期化ブロックのエリア（kernel_cfg.c）
+ */
+extern const CYCGINIB	cycginib_table[];
+
+/*
+ *  周期通知グループ管理ブロックのエリア（kernel_cfg.c）
+ */
+extern CYCGCB	cycgcb_table[];
+
 /*
  *  周期通知機能の初期化
  */
@@ -100,4 +148,9 @@ extern void	initialize_cyclic(void);
  */
 extern void	call_cyclic(CYCCB *p_cyccb);
 
+/*
+ *  周期通知グループ起動ルーチン
+ */
+extern void	call_cycgrp(CYCGCB *p_cycgcb);
+
 #endif /* TOPPERS_CYCLIC_H */
@@ -136,6 +136,73 @@
 #define INDEX_DTQ(dtqid)	((uint_t)((dtqid) - TMIN_DTQID))
 #define get_dtqcb(dtqid)	(&(dtqcb_table[INDEX_DTQ(dtqid)]))
 
+/*
+ *  データキューの使用量（格納されているデータの数）の記録
+ */
+#define DTQ_OCCUPANCY(p_dtqcb)										\
+		OBJSTAT_OCCUPANCY(&((p_dtqcb)->objstat), (p_dtqcb)->count,	\
+					(p_dtqcb)->count == (p_dtqcb)->p_dtqinib->dtqcnt)
+
+#ifdef USE_LOCK_ELISION
+/*
+ *  CPUロック状態にしないデータキューへの送信
+ *
+ *  TA_TSKCTX属性のデータキューに対して，タスク切換えを保留してデータ
+ *  を格納する．受信待ち行列にタスクがある場合と，データキュー管理領域
+ *  に空きがない場合にはfalseを返す．forceがtrueの場合には，データキュー
+ *  管理領域に空きがなくても強制的に格納する．
+ */
+Inline bool_t
+snd_dtq_held(DTQCB *p_dtqcb, intptr_t data, bool_t force)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if (!queue_empty(&(p_dtqcb->rwait_queue))) {
+		done = false;
+	}
+	else if (p_dtqcb->count < p_dtqcb->p_dtqinib->dtqcnt) {
+		enqueue_data(p_dtqcb, data);
+		done = true;
+	}
+	else if (force) {
+		force_enqueue_data(p_dtqcb, data);
+		done = true;
+	}
+	else {
+		done = false;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+/*
+ *  CPUロック状態にしないデータキューからの受信
+ *
+ *  TA_TSKCTX属性のデータキューに対して，タスク切換えを保留してデータ
+ *  を取り出す．送信待ち行列にタスクがある場合と，データキュー管理領域
+ *  にデータがない場合にはfalseを返す．
+ */
+Inline bool_t
+rcv_dtq_held(DTQCB *p_dtqcb, intptr_t *p_data)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if (p_dtqcb->count > 0U && queue_empty(&(p_dtqcb->swait_queue))) {
+		dequeue_data(p_dtqcb, p_data);
+		OBJSTAT_ACQUIRE(&(p_dtqcb->objstat), E_OK);
+		done = true;
+	}
+	else {
+		done = false;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+#endif /* USE_LOCK_ELISION */
+
 /*
  *  データキュー機能の初期化
  */
@@ -155,6 +222,8 @@ initialize_dataqueue(void)
 		p_dtqcb->count = 0U;
 		p_dtqcb->head = 0U;
 		p_dtqcb->tail = 0U;
+		OBJSTAT_INIT(&(p_dtqcb->objstat), 0U,
+								p_dtqcb->p_dtqinib->dtqcnt == 0U);
 	}
 }
 
@@ -174,6 +243,8 @@ enqueue_data(DTQCB *p_dtqcb, intptr_t data)
 	if (p_dtqcb->tail >= p_dtqcb->p_dtqinib->dtqcnt) {
 		p_dtqcb->tail = 0U;
 	}
+	UPDATE_SNPGEN();
+	DTQ_OCCUPANCY(p_dtqcb);
 }
 
 #endif /* TOPPERS_dtqenq */
@@ -197,6 +268,8 @@ force_enqueue_data(DTQCB *p_dtqcb, intptr_t data)
 	else {
 		p_dtqcb->head = p_dtqcb->tail;
 	}
+	UPDATE_SNPGEN();
+	DTQ_OCCUPANCY(p_dtqcb);
 }
 
 #endif /* TOPPERS_dtqfenq */
@@ -215,6 +288,8 @@ dequeue_data(DTQCB *p_dtqcb, intptr_t *p_data)
 	if (p_dtqcb->head >= p_dtqcb->p_dtqinib->dtqcnt) {
 		p_dtqcb->head = 0U;
 	}
+	UPDATE_SNPGEN();
+	DTQ_OCCUPANCY(p_dtqcb);
 }
 
 #endif /* TOPPERS_dtqdeq */
@@ -316,10 +391,18 @@ snd_dtq(ID dtqid, intptr_t data)
 
 	LOG_SND_DTQ_ENTER(dtqid, data);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_DTQID(dtqid));
 	p_dtqcb = get_dtqcb(dtqid);
 	CHECK_ACPTN(p_dtqcb->p_dtqinib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_dtqcb->p_dtqinib->dtqatr) && !p_runtsk->raster
+							&& snd_dtq_held(p_dtqcb, data, false)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -334,8 +417,10 @@ snd_dtq(ID dtqid, intptr_t data)
 		winfo_sdtq.data = data;
 		wobj_make_wait((WOBJCB *) p_dtqcb, TS_WAITING_SDTQ,
 											(WINFO_WOBJ *) &winfo_sdtq);
+		OBJSTAT_WAIT(&(p_dtqcb->objstat), &(p_dtqcb->swait_queue));
 		dispatch();
 		ercd = winfo_sdtq.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_dtqcb->objstat), ercd);
 	}
 	unlock_cpu_dsp();
 
@@ -361,8 +446,18 @@ psnd_dtq(ID dtqid, intptr_t data)
 	CHECK_UNL();
 	CHECK_ID(VALID_DTQID(dtqid));
 	p_dtqcb = get_dtqcb(dtqid);
+#ifdef USE_LOCK_ELISION
+	CHECK_CTX(!(sense_context() && TSKCTX_OBJ(p_dtqcb->p_dtqinib->dtqatr)));
+#endif /* USE_LOCK_ELISION */
 	CHECK_ACPTN(p_dtqcb->p_dtqinib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_dtqcb->p_dtqinib->dtqatr)
+							&& snd_dtq_held(p_dtqcb, data, false)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (send_data(p_dtqcb, data)) {
 		if (p_runtsk != p_schedtsk) {
@@ -402,11 +497,19 @@ tsnd_dtq(ID dtqid, intptr_t data, TMO tmout)
 
 	LOG_TSND_DTQ_ENTER(dtqid, data, tmout);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_DTQID(dtqid));
 	CHECK_PAR(VALID_TMOUT(tmout));
 	p_dtqcb = get_dtqcb(dtqid);
 	CHECK_ACPTN(p_dtqcb->p_dtqinib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_dtqcb->p_dtqinib->dtqatr) && !p_runtsk->raster
+							&& snd_dtq_held(p_dtqcb, data, false)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -424,8 +527,10 @@ tsnd_dtq(ID dtqid, intptr_t data, TMO tmout)
 		winfo_sdtq.data = data;
 		wobj_make_wait_tmout((WOBJCB *) p_dtqcb, TS_WAITING_SDTQ,
 								(WINFO_WOBJ *) &winfo_sdtq, &tmevtb, tmout);
+		OBJSTAT_WAIT(&(p_dtqcb->objstat), &(p_dtqcb->swait_queue));
 		dispatch();
 		ercd = winfo_sdtq.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_dtqcb->objstat), ercd);
 	}
 	unlock_cpu_dsp();
 
@@ -451,9 +556,19 @@ fsnd_dtq(ID dtqid, intptr_t data)
 	CHECK_UNL();
 	CHECK_ID(VALID_DTQID(dtqid));
 	p_dtqcb = get_dtqcb(dtqid);
+#ifdef USE_LOCK_ELISION
+	CHECK_CTX(!(sense_context() && TSKCTX_OBJ(p_dtqcb->p_dtqinib->dtqatr)));
+#endif /* USE_LOCK_ELISION */
 	CHECK_ACPTN(p_dtqcb->p_dtqinib->acvct.acptn1);
 	CHECK_ILUSE(p_dtqcb->p_dtqinib->dtqcnt > 0U);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_dtqcb->p_dtqinib->dtqatr)
+							&& snd_dtq_held(p_dtqcb, data, true)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	force_send_data(p_dtqcb, data);
 	if (p_runtsk != p_schedtsk) {
@@ -488,11 +603,19 @@ rcv_dtq(ID dtqid, intptr_t *p_data)
 
 	LOG_RCV_DTQ_ENTER(dtqid, p_data);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_DTQID(dtqid));
 	CHECK_MACV_WRITE(p_data, intptr_t);
 	p_dtqcb = get_dtqcb(dtqid);
 	CHECK_ACPTN(p_dtqcb->p_dtqinib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_dtqcb->p_dtqinib->dtqatr) && !p_runtsk->raster
+							&& rcv_dtq_held(p_dtqcb, p_data)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -508,12 +631,15 @@ rcv_dtq(ID dtqid, intptr_t *p_data)
 		queue_insert_prev(&(p_dtqcb->rwait_queue), &(p_runtsk->task_queue));
 		winfo_rdtq.p_dtqcb = p_dtqcb;
 		LOG_TSKSTAT(p_runtsk);
+		OBJSTAT_WAIT(&(p_dtqcb->objstat), &(p_dtqcb->rwait_queue));
 		dispatch();
 		ercd = winfo_rdtq.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_dtqcb->objstat), ercd);
 		if (ercd == E_OK) {
 			*p_data = winfo_rdtq.data;
 		}
 	}
+	OBJSTAT_ACQUIRE(&(p_dtqcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -541,6 +667,13 @@ prcv_dtq(ID dtqid, intptr_t *p_data)
 	p_dtqcb = get_dtqcb(dtqid);
 	CHECK_ACPTN(p_dtqcb->p_dtqinib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_dtqcb->p_dtqinib->dtqatr)
+							&& rcv_dtq_held(p_dtqcb, p_data)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (receive_data(p_dtqcb, p_data)) {
 		if (p_runtsk != p_schedtsk) {
@@ -551,6 +684,7 @@ prcv_dtq(ID dtqid, intptr_t *p_data)
 	else {
 		ercd = E_TMOUT;
 	}
+	OBJSTAT_ACQUIRE(&(p_dtqcb->objstat), ercd);
 	unlock_cpu();
 
   error_exit:
@@ -575,12 +709,20 @@ trcv_dtq(ID dtqid, intptr_t *p_data, TMO tmout)
 
 	LOG_TRCV_DTQ_ENTER(dtqid, p_data, tmout);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_DTQID(dtqid));
 	CHECK_MACV_WRITE(p_data, intptr_t);
 	CHECK_PAR(VALID_TMOUT(tmout));
 	p_dtqcb = get_dtqcb(dtqid);
 	CHECK_ACPTN(p_dtqcb->p_dtqinib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_dtqcb->p_dtqinib->dtqatr) && !p_runtsk->raster
+							&& rcv_dtq_held(p_dtqcb, p_data)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -599,12 +741,15 @@ trcv_dtq(ID dtqid, intptr_t *p_data, TMO tmout)
 		queue_insert_prev(&(p_dtqcb->rwait_queue), &(p_runtsk->task_queue));
 		winfo_rdtq.p_dtqcb = p_dtqcb;
 		LOG_TSKSTAT(p_runtsk);
+		OBJSTAT_WAIT(&(p_dtqcb->objstat), &(p_dtqcb->rwait_queue));
 		dispatch();
 		ercd = winfo_rdtq.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_dtqcb->objstat), ercd);
 		if (ercd == E_OK) {
 			*p_data = winfo_rdtq.data;
 		}
 	}
+	OBJSTAT_ACQUIRE(&(p_dtqcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -637,6 +782,8 @@ ini_dtq(ID dtqid)
 	p_dtqcb->count = 0U;
 	p_dtqcb->head = 0U;
 	p_dtqcb->tail = 0U;
+	UPDATE_SNPGEN();
+	DTQ_OCCUPANCY(p_dtqcb);
 	if (p_runtsk != p_schedtsk) {
 		dispatch();
 	}
@@ -50,6 +50,7 @@
 #include "kernel_impl.h"
 #include <queue.h>
 #include "wait.h"
+#include "objstat.h"
 
 /*
  *  データ管理ブロック
@@ -86,6 +87,9 @@ typedef struct dataqueue_control_block {
 	uint_t		count;			/* データキュー中のデータの数 */
 	uint_t		head;			/* 最初のデータの格納場所 */
 	uint_t		tail;			/* 最後のデータの格納場所の次 */
+#ifdef USE_OBJSTAT
+	OBJSTAT		objstat;		/* 統計情報ブロック */
+#endif /* USE_OBJSTAT */
 } DTQCB;
 
 /*
@@ -74,6 +74,84 @@
 #define LOG_GET_SOM_LEAVE(ercd)
 #endif /* LOG_GET_SOM_LEAVE */
 
+#ifdef USE_SLACK_RECLAIM
+/*
+ *  タイムウィンドウタイマの動作時間の計上先の決定
+ *
+ *  実行状態のタスクが属する保護ドメインから，動作時間の計上先を決める．
+ */
+Inline PRCTIM *
+twdstat_select(void)
+{
+	if (p_runtsk == NULL || p_runtsk->p_dominib == &dominib_kernel) {
+		return(NULL);
+	}
+	else if (p_runtsk->p_dominib == p_runtwd->p_dominib) {
+		return(&(twdstat_cur.usedtim));
+	}
+	else {
+		return(&(twdstat_cur.slktim));
+	}
+}
+
+/*
+ *  タイムウィンドウタイマの動作時間の計上の開始
+ *
+ *  タイムウィンドウタイマを動作開始する時に呼び出す．
+ */
+Inline void
+twdstat_start(void)
+{
+	twdstat_sttim = left_twdtim;
+	p_twdstat_acc = twdstat_select();
+}
+
+/*
+ *  タイムウィンドウタイマの動作時間の計上
+ *
+ *  タイムウィンドウタイマを停止した時に呼び出す．
+ */
+Inline void
+twdstat_stop(void)
+{
+	if (p_twdstat_acc != NULL) {
+		*p_twdstat_acc += twdstat_sttim - left_twdtim;
+	}
+}
+
+/*
+ *  タイムウィンドウタイマの動作時間の計上先の切換え
+ *
+ *  タイムウィンドウタイマを動作させたままディスパッチした時に呼び出
+ *  す．実行状態のタスクが，タイムウィンドウを割り当てられた保護ドメ
+ *  インと余剰時間を割り当てた保護ドメインの間で切り換わった場合や，
+ *  実行すべきタスクがなくなった場合には，それまでの動作時間を計上し
+ *  た上で，計上先を切り換える．
+ */
+Inline void
+twdstat_update(void)
+{
+	PRCTIM	*p_acc = twdstat_select();
+	PRCTIM	curtim;
+
+	if (p_acc != p_twdstat_acc) {
+		curtim = target_twdtimer_get_current();
+		if (p_twdstat_acc != NULL) {
+			*p_twdstat_acc += twdstat_sttim - curtim;
+		}
+		twdstat_sttim = curtim;
+		p_twdstat_acc = p_acc;
+	}
+}
+
+#else /* USE_SLACK_RECLAIM */
+
+#define twdstat_start()
+#define twdstat_stop()
+#define twdstat_update()
+
+#endif /* USE_SLACK_RECLAIM */
+
 #ifdef TOPPERS_domini
 
 /*
@@ -151,6 +229,28 @@ ACPTN	rundom;
  */
 const DOMINIB	*p_ctxdom;
 
+#ifdef USE_SLACK_RECLAIM
+/*
+ *  実行中のタイムウィンドウの使用時間の統計情報
+ */
+TWDSTAT		twdstat_cur;
+
+/*
+ *  実行中のタイムウィンドウの統計情報の格納先
+ */
+TWDSTAT		*p_twdstat;
+
+/*
+ *  タイムウィンドウタイマの動作時間の計上先
+ */
+PRCTIM		*p_twdstat_acc;
+
+/*
+ *  タイムウィンドウタイマを動作開始した時点の残り時間
+ */
+PRCTIM		twdstat_sttim;
+#endif /* USE_SLACK_RECLAIM */
+
 /*
  *  スケジューリング単位管理ブロックの初期化
  */
@@ -164,6 +264,9 @@ initialize_schedcb(SCHEDCB *p_schedcb)
 		queue_initialize(&(p_schedcb->ready_queue[i]));
 	}
 	p_schedcb->ready_primap = 0U;
+#ifdef USE_EDF_SCHED
+	p_schedcb->edf = false;
+#endif /* USE_EDF_SCHED */
 }
 
 /*
@@ -179,6 +282,11 @@ initialize_domain(void)
 	for (i = 0; i < tnum_schedcb; i++) {
 		initialize_schedcb(&(schedcb_table[i]));
 	}
+#ifdef USE_EDF_SCHED
+	for (i = 0; i < tnum_edfsched; i++) {
+		edfsched_table[i]->edf = true;
+	}
+#endif /* USE_EDF_SCHED */
 
 	p_cursom = NULL;
 	pending_scycswitch = false;
@@ -188,6 +296,10 @@ initialize_domain(void)
 	twdtimer_flag = false;
 	rundom = TACP_KERNEL;
 	p_ctxdom = NULL;
+#ifdef USE_SLACK_RECLAIM
+	p_twdstat = NULL;
+	p_twdstat_acc = NULL;
+#endif /* USE_SLACK_RECLAIM */
 
 	if (system_cyctim == 0U) {
 		/*
@@ -229,9 +341,13 @@ void
 twdtimer_start(void)
 {
 	if (!twdtimer_flag) {
+		twdstat_start();
 		target_twdtimer_start(left_twdtim);
 		twdtimer_flag = true;
 	}
+	else {
+		twdstat_update();
+	}
 }
 
 #endif /* OMIT_TWDTIMER_START */
@@ -249,6 +365,7 @@ twdtimer_stop(void)
 	if (twdtimer_flag) {
 		left_twdtim = target_twdtimer_stop();
 		twdtimer_flag = false;
+		twdstat_stop();
 	}
 }
 
@@ -270,9 +387,13 @@ twdtimer_control(void)
 		 *  に属する場合，タイムウィンドウタイマを動作開始する．
 		 */
 		if (!twdtimer_flag) {
+			twdstat_start();
 			target_twdtimer_start(left_twdtim);
 			twdtimer_flag = true;
 		}
+		else {
+			twdstat_update();
+		}
 	}
 	else {
 		/*
@@ -282,6 +403,7 @@ twdtimer_control(void)
 		if (twdtimer_flag) {
 			left_twdtim = target_twdtimer_stop();
 			twdtimer_flag = false;
+			twdstat_stop();
 		}
 	}
 }
@@ -406,10 +528,25 @@ twd_start(void)
 {
 	TMEVTN	*p_tmevt_heap;
 
+#ifdef USE_SLACK_RECLAIM
+	/*
+	 *  終了したタイムウィンドウの統計情報を格納する．
+	 */
+	if (p_twdstat != NULL) {
+		*p_twdstat = twdstat_cur;
+	}
+	twdstat_cur.usedtim = 0U;
+	twdstat_cur.slktim = 0U;
+	p_twdstat = NULL;
+#endif /* USE_SLACK_RECLAIM */
+
 	if (p_runtwd < (p_cursom + 1)->p_twdinib) {
 		/*
 		 *  実行すべきタイムウィンドウがある場合
 		 */
+#ifdef USE_SLACK_RECLAIM
+		p_twdstat = &(twdstat_table[p_runtwd - twdinib_table]);
+#endif /* USE_SLACK_RECLAIM */
 		p_twdsched = p_runtwd->p_dominib->p_schedcb;
 		p_idlesched = &schedcb_idle;
 		p_tmevt_heap = p_runtwd->p_dominib->p_tmevt_heap;
@@ -495,6 +632,28 @@ twd_switch(void)
 
 #endif /* TOPPERS_twdswitch */
 
+/*
+ *  余剰時間に実行すべきタスクのサーチ
+ */
+#ifdef TOPPERS_slktsk
+#ifdef USE_SLACK_RECLAIM
+
+TCB *
+search_slktsk(void)
+{
+	uint_t	i;
+
+	for (i = 0; i < tnum_slksched; i++) {
+		if (slksched_table[i]->p_predtsk != NULL) {
+			return(slksched_table[i]->p_predtsk);
+		}
+	}
+	return(p_idlesched->p_predtsk);
+}
+
+#endif /* USE_SLACK_RECLAIM */
+#endif /* TOPPERS_slktsk */
+
 /*
  *  タスクディスパッチ可能状態への遷移
  *
@@ -560,6 +719,35 @@ set_dspflg(void)
 
 #endif /* TOPPERS_setdspflg */
 
+/*
+ *  タスク切換えの保留の解除
+ *
+ *  保留中にシステム周期／タイムウィンドウの切換えが保留された場合には，
+ *  set_dspflgで実行する．
+ */
+#ifdef TOPPERS_rlsdsphld
+#ifdef USE_LOCK_ELISION
+
+void
+release_dsp_hold(void)
+{
+	lock_cpu();
+	if (pending_scycswitch || pending_twdswitch) {
+		set_dspflg();
+	}
+	else {
+		dspflg = true;
+		update_schedtsk();
+	}
+	if (p_runtsk != p_schedtsk) {
+		dispatch();
+	}
+	unlock_cpu();
+}
+
+#endif /* USE_LOCK_ELISION */
+#endif /* TOPPERS_rlsdsphld */
+
 /*
  *  システム動作モードの変更［NGKI5030］
  */
@@ -80,11 +80,18 @@ typedef struct domain_initialization_block DOMINIB;
  *  度の段階数が少ない場合には，ビットマップ操作のオーバーヘッドのため
  *  に，逆に効率が落ちる可能性もある．優先度が16段階であることを仮定し
  *  ているため，uint16_t型としている．
+ *
+ *  edfは，スケジューリング単位がEDFスケジューリングを行うかを示す．
+ *  EDFスケジューリングを行うスケジューリング単位では，優先度ごとのタ
+ *  スクキューを，タスクの絶対デッドラインの早い順に並べる．
  */
 typedef struct scheduing_unit_control_block {
 	TCB			*p_predtsk;					/* 優先順位が最も高いタスク */
 	QUEUE		ready_queue[TNUM_TPRI];		/* レディキュー */
 	uint16_t	ready_primap;	/* レディキューサーチのためのビットマップ */
+#ifdef USE_EDF_SCHED
+	bool_t		edf;			/* EDFスケジューリングを行うか */
+#endif /* USE_EDF_SCHED */
 } SCHEDCB;
 
 /*
@@ -194,6 +201,92 @@ extern bool_t	pending_twdswitch;
  */
 extern const TWDINIB	twdinib_table[];
 
+#ifdef USE_SLACK_RECLAIM
+/*
+ *  余剰時間を割り当てるスケジューリング単位の数（kernel_cfg.c）
+ */
+extern const uint_t	tnum_slksched;
+
+/*
+ *  余剰時間を割り当てるスケジューリング単位のテーブル（kernel_cfg.c）
+ *
+ *  ATT_SLKで指定したユーザドメインに対応するスケジューリング単位管理
+ *  ブロックを，記述した順に並べたもの．
+ */
+extern SCHEDCB *const	slksched_table[];
+
+/*
+ *  タイムウィンドウの使用時間の統計情報
+ *
+ *  usedtimは，タイムウィンドウを割り当てられたユーザドメインのタスク
+ *  が実行された時間，slktimは，それ以外のユーザドメイン（アイドルドメ
+ *  インを含む）のタスクに割り当てられた時間である．タイムウィンドウ長
+ *  からこれらを引いた残りが，実行すべきタスクがなかった時間である．
+ */
+typedef struct time_window_statistics {
+	PRCTIM		usedtim;		/* 割り当てられたドメインの使用時間 */
+	PRCTIM		slktim;			/* 他のドメインに割り当てた時間 */
+} TWDSTAT;
+
+/*
+ *  タイムウィンドウの使用時間の統計情報のエリア（kernel_cfg.c）
+ *
+ *  タイムウィンドウ毎に，最後に終了した時の統計情報を保持する．
+ */
+extern TWDSTAT	twdstat_table[];
+
+/*
+ *  実行中のタイムウィンドウの使用時間の統計情報
+ */
+extern TWDSTAT	twdstat_cur;
+
+/*
+ *  実行中のタイムウィンドウの統計情報の格納先
+ *
+ *  アイドルウィンドウの実行中とシステム周期停止モードの間は，NULLに
+ *  する．
+ */
+extern TWDSTAT	*p_twdstat;
+
+/*
+ *  タイムウィンドウタイマの動作時間の計上先
+ *
+ *  twdstat_curのいずれかのメンバを指すポインタ．実行すべきタスクがな
+ *  い場合には，NULLにする．
+ */
+extern PRCTIM	*p_twdstat_acc;
+
+/*
+ *  タイムウィンドウタイマを動作開始した時点の残り時間
+ */
+extern PRCTIM	twdstat_sttim;
+
+/*
+ *  余剰時間に実行すべきタスクのサーチ
+ *
+ *  タイムウィンドウの実行中に，そのタイムウィンドウを割り当てられた
+ *  ユーザドメインとカーネルドメインに実行できるタスクがない場合に，
+ *  余剰時間を割り当てるユーザドメイン，アイドルドメインの順に，実行
+ *  すべきタスクをサーチする．
+ */
+extern TCB	*search_slktsk(void);
+#endif /* USE_SLACK_RECLAIM */
+
+#ifdef USE_EDF_SCHED
+/*
+ *  EDFスケジューリングを行うスケジューリング単位の数（kernel_cfg.c）
+ */
+extern const uint_t	tnum_edfsched;
+
+/*
+ *  EDFスケジューリングを行うスケジューリング単位のテーブル（kernel_cfg.c）
+ *
+ *  ATT_EDFで指定したユーザドメインに対応するスケジューリング単位管理
+ *  ブロックを並べたもの．
+ */
+extern SCHEDCB *const	edfsched_table[];
+#endif /* USE_EDF_SCHED */
+
 /*
  *  タイムウィンドウタイマを動作させるべき状態であることを示すフラグ
  */
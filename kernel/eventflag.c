@@ -120,6 +120,70 @@
 #define INDEX_FLG(flgid)	((uint_t)((flgid) - TMIN_FLGID))
 #define get_flgcb(flgid)	(&(flgcb_table[INDEX_FLG(flgid)]))
 
+/*
+ *  イベントフラグの使用量（ビットパターンが0でなければ1）の記録
+ */
+#define FLG_OCCUPANCY(p_flgcb)										\
+		OBJSTAT_OCCUPANCY(&((p_flgcb)->objstat),					\
+					((p_flgcb)->flgptn != 0U) ? 1U : 0U, false)
+
+#ifdef USE_LOCK_ELISION
+/*
+ *  CPUロック状態にしないイベントフラグのセット
+ *
+ *  TA_TSKCTX属性のイベントフラグに対して，タスク切換えを保留してビッ
+ *  トパターンをセットする．待ち行列にタスクがある場合にはfalseを返し，
+ *  呼出し元は，CPUロック状態で待ち解除を行う．
+ */
+Inline bool_t
+set_flg_held(FLGCB *p_flgcb, FLGPTN setptn)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if (queue_empty(&(p_flgcb->wait_queue))) {
+		p_flgcb->flgptn |= setptn;
+		UPDATE_SNPGEN();
+		FLG_OCCUPANCY(p_flgcb);
+		done = true;
+	}
+	else {
+		done = false;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+/*
+ *  CPUロック状態にしないイベントフラグ待ち
+ *
+ *  TA_TSKCTX属性のイベントフラグに対して，タスク切換えを保留して待ち
+ *  解除条件をチェックする．待ち解除条件を満たさない場合と，E_ILUSEエ
+ *  ラーとなる場合にはfalseを返す．
+ */
+Inline bool_t
+wai_flg_held(FLGCB *p_flgcb, FLGPTN waiptn, MODE wfmode, FLGPTN *p_flgptn)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if ((p_flgcb->p_flginib->flgatr & TA_WMUL) == 0U
+					&& !queue_empty(&(p_flgcb->wait_queue))) {
+		done = false;
+	}
+	else if (check_flg_cond(p_flgcb, waiptn, wfmode, p_flgptn)) {
+		OBJSTAT_ACQUIRE(&(p_flgcb->objstat), E_OK);
+		done = true;
+	}
+	else {
+		done = false;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+#endif /* USE_LOCK_ELISION */
+
 /*
  *  イベントフラグ機能の初期化
  */
@@ -136,6 +200,8 @@ initialize_eventflag(void)
 		queue_initialize(&(p_flgcb->wait_queue));
 		p_flgcb->p_flginib = &(flginib_table[i]);
 		p_flgcb->flgptn = p_flgcb->p_flginib->iflgptn;
+		OBJSTAT_INIT(&(p_flgcb->objstat),
+					(p_flgcb->flgptn != 0U) ? 1U : 0U, false);
 	}
 }
 
@@ -154,6 +220,8 @@ check_flg_cond(FLGCB *p_flgcb, FLGPTN waiptn, MODE wfmode, FLGPTN *p_flgptn)
 		*p_flgptn = p_flgcb->flgptn;
 		if ((p_flgcb->p_flginib->flgatr & TA_CLR) != 0U) {
 			p_flgcb->flgptn = 0U;
+			UPDATE_SNPGEN();
+			FLG_OCCUPANCY(p_flgcb);
 		}
 		return(true);
 	}
@@ -180,10 +248,22 @@ set_flg(ID flgid, FLGPTN setptn)
 	CHECK_UNL();
 	CHECK_ID(VALID_FLGID(flgid));
 	p_flgcb = get_flgcb(flgid);
+#ifdef USE_LOCK_ELISION
+	CHECK_CTX(!(sense_context() && TSKCTX_OBJ(p_flgcb->p_flginib->flgatr)));
+#endif /* USE_LOCK_ELISION */
 	CHECK_ACPTN(p_flgcb->p_flginib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_flgcb->p_flginib->flgatr)
+								&& set_flg_held(p_flgcb, setptn)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	p_flgcb->flgptn |= setptn;
+	UPDATE_SNPGEN();
+	FLG_OCCUPANCY(p_flgcb);
 	p_queue = p_flgcb->wait_queue.p_next;
 	while (p_queue != &(p_flgcb->wait_queue)) {
 		p_tcb = (TCB *) p_queue;
@@ -216,6 +296,40 @@ set_flg(ID flgid, FLGPTN setptn)
 
 #endif /* TOPPERS_set_flg */
 
+/*
+ *  タイムイベントの通知処理によるイベントフラグのセット
+ */
+#ifdef TOPPERS_nfyset
+
+ER
+nfy_set_flg(FLGCB *p_flgcb, FLGPTN setptn)
+{
+	QUEUE		*p_queue;
+	TCB			*p_tcb;
+	WINFO_FLG	*p_winfo_flg;
+
+	p_flgcb->flgptn |= setptn;
+	UPDATE_SNPGEN();
+	FLG_OCCUPANCY(p_flgcb);
+	p_queue = p_flgcb->wait_queue.p_next;
+	while (p_queue != &(p_flgcb->wait_queue)) {
+		p_tcb = (TCB *) p_queue;
+		p_queue = p_queue->p_next;
+		p_winfo_flg = (WINFO_FLG *)(p_tcb->p_winfo);
+		if (check_flg_cond(p_flgcb, p_winfo_flg->waiptn,
+							p_winfo_flg->wfmode, &(p_winfo_flg->waiptn))) {
+			queue_delete(&(p_tcb->task_queue));
+			wait_complete(p_tcb);
+			if ((p_flgcb->p_flginib->flgatr & TA_CLR) != 0U) {
+				break;
+			}
+		}
+	}
+	return(E_OK);
+}
+
+#endif /* TOPPERS_nfyset */
+
 /*
  *  イベントフラグのクリア
  */
@@ -226,6 +340,9 @@ clr_flg(ID flgid, FLGPTN clrptn)
 {
 	FLGCB	*p_flgcb;
 	ER		ercd;
+#ifdef USE_LOCK_ELISION
+	bool_t	held;
+#endif /* USE_LOCK_ELISION */
 
 	LOG_CLR_FLG_ENTER(flgid, clrptn);
 	CHECK_TSKCTX_UNL();
@@ -233,8 +350,25 @@ clr_flg(ID flgid, FLGPTN clrptn)
 	p_flgcb = get_flgcb(flgid);
 	CHECK_ACPTN(p_flgcb->p_flginib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_flgcb->p_flginib->flgatr)) {
+		/*
+		 *  ビットパターンのクリアは待ち状態のタスクに関わらないため，
+		 *  常にタスク切換えを保留して行う．
+		 */
+		held = begin_dsp_hold();
+		p_flgcb->flgptn &= clrptn;
+		UPDATE_SNPGEN();
+		FLG_OCCUPANCY(p_flgcb);
+		end_dsp_hold(held);
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	p_flgcb->flgptn &= clrptn; 
+	UPDATE_SNPGEN();
+	FLG_OCCUPANCY(p_flgcb);
 	ercd = E_OK;
 	unlock_cpu();
 
@@ -259,6 +393,7 @@ wai_flg(ID flgid, FLGPTN waiptn, MODE wfmode, FLGPTN *p_flgptn)
 
 	LOG_WAI_FLG_ENTER(flgid, waiptn, wfmode, p_flgptn);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_FLGID(flgid));
 	CHECK_PAR(waiptn != 0U);
 	CHECK_PAR(wfmode == TWF_ORW || wfmode == TWF_ANDW);
@@ -266,6 +401,13 @@ wai_flg(ID flgid, FLGPTN waiptn, MODE wfmode, FLGPTN *p_flgptn)
 	p_flgcb = get_flgcb(flgid);
 	CHECK_ACPTN(p_flgcb->p_flginib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_flgcb->p_flginib->flgatr) && !p_runtsk->raster
+				&& wai_flg_held(p_flgcb, waiptn, wfmode, p_flgptn)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -282,12 +424,15 @@ wai_flg(ID flgid, FLGPTN waiptn, MODE wfmode, FLGPTN *p_flgptn)
 		winfo_flg.wfmode = wfmode;
 		wobj_make_wait((WOBJCB *) p_flgcb, TS_WAITING_FLG,
 											(WINFO_WOBJ *) &winfo_flg);
+		OBJSTAT_WAIT(&(p_flgcb->objstat), &(p_flgcb->wait_queue));
 		dispatch();
 		ercd = winfo_flg.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_flgcb->objstat), ercd);
 		if (ercd == E_OK) {
 			*p_flgptn = winfo_flg.waiptn;
 		}
 	}
+	OBJSTAT_ACQUIRE(&(p_flgcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -317,6 +462,13 @@ pol_flg(ID flgid, FLGPTN waiptn, MODE wfmode, FLGPTN *p_flgptn)
 	p_flgcb = get_flgcb(flgid);
 	CHECK_ACPTN(p_flgcb->p_flginib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_flgcb->p_flginib->flgatr)
+				&& wai_flg_held(p_flgcb, waiptn, wfmode, p_flgptn)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if ((p_flgcb->p_flginib->flgatr & TA_WMUL) == 0U
 					&& !queue_empty(&(p_flgcb->wait_queue))) {
@@ -328,6 +480,7 @@ pol_flg(ID flgid, FLGPTN waiptn, MODE wfmode, FLGPTN *p_flgptn)
 	else {
 		ercd = E_TMOUT;
 	}
+	OBJSTAT_ACQUIRE(&(p_flgcb->objstat), ercd);
 	unlock_cpu();
 
   error_exit:
@@ -352,6 +505,7 @@ twai_flg(ID flgid, FLGPTN waiptn, MODE wfmode, FLGPTN *p_flgptn, TMO tmout)
 
 	LOG_TWAI_FLG_ENTER(flgid, waiptn, wfmode, p_flgptn, tmout);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_FLGID(flgid));
 	CHECK_PAR(waiptn != 0U);
 	CHECK_PAR(wfmode == TWF_ORW || wfmode == TWF_ANDW);
@@ -360,6 +514,13 @@ twai_flg(ID flgid, FLGPTN waiptn, MODE wfmode, FLGPTN *p_flgptn, TMO tmout)
 	p_flgcb = get_flgcb(flgid);
 	CHECK_ACPTN(p_flgcb->p_flginib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_flgcb->p_flginib->flgatr) && !p_runtsk->raster
+				&& wai_flg_held(p_flgcb, waiptn, wfmode, p_flgptn)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -379,12 +540,15 @@ twai_flg(ID flgid, FLGPTN waiptn, MODE wfmode, FLGPTN *p_flgptn, TMO tmout)
 		winfo_flg.wfmode = wfmode;
 		wobj_make_wait_tmout((WOBJCB *) p_flgcb, TS_WAITING_FLG,
 								(WINFO_WOBJ *) &winfo_flg, &tmevtb, tmout);
+		OBJSTAT_WAIT(&(p_flgcb->objstat), &(p_flgcb->wait_queue));
 		dispatch();
 		ercd = winfo_flg.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_flgcb->objstat), ercd);
 		if (ercd == E_OK) {
 			*p_flgptn = winfo_flg.waiptn;
 		}
 	}
+	OBJSTAT_ACQUIRE(&(p_flgcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -414,6 +578,8 @@ ini_flg(ID flgid)
 	lock_cpu();
 	init_wait_queue(&(p_flgcb->wait_queue));
 	p_flgcb->flgptn = p_flgcb->p_flginib->iflgptn;
+	UPDATE_SNPGEN();
+	FLG_OCCUPANCY(p_flgcb);
 	if (p_runtsk != p_schedtsk) {
 		dispatch();
 	}
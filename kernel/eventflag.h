@@ -50,6 +50,7 @@
 #include "kernel_impl.h"
 #include <queue.h>
 #include "wait.h"
+#include "objstat.h"
 
 /*
  *  イベントフラグ初期化ブロック
@@ -75,6 +76,9 @@ typedef struct eventflag_control_block {
 	QUEUE		wait_queue;		/* イベントフラグ待ちキュー */
 	const FLGINIB *p_flginib;	/* 初期化ブロックへのポインタ */
 	FLGPTN		flgptn;			/* イベントフラグ現在パターン */
+#ifdef USE_OBJSTAT
+	OBJSTAT		objstat;		/* 統計情報ブロック */
+#endif /* USE_OBJSTAT */
 } FLGCB;
 
 /*
@@ -125,4 +129,12 @@ extern void	initialize_eventflag(void);
 extern bool_t	check_flg_cond(FLGCB *p_flgcb, FLGPTN waiptn,
 								MODE wfmode, FLGPTN *p_flgptn);
 
+/*
+ *  タイムイベントの通知処理によるイベントフラグのセット
+ *
+ *  コンフィギュレータが生成する通知ハンドラから，CPUロック状態で呼び
+ *  出される．
+ */
+extern ER	nfy_set_flg(FLGCB *p_flgcb, FLGPTN setptn);
+
 #endif /* TOPPERS_EVENTFLAG_H */
@@ -161,6 +161,136 @@ initialize_interrupt(void)
 #endif /* OMIT_INITIALIZE_INTERRUPT */
 #endif /* TOPPERS_intini */
 
+/*
+ *  遅延実行する割込みサービスルーチンの管理ブロックの初期化
+ */
+#ifdef TOPPERS_disrini
+
+void
+initialize_deferred_isr(void)
+{
+	uint_t	i;
+	DISRCB	*p_disrcb;
+
+	for (i = 0; i < tnum_disr; i++) {
+		p_disrcb = &(disrcb_table[i]);
+		p_disrcb->pending = false;
+		p_disrcb->quecnt = 0U;
+		p_disrcb->coalcnt = 0U;
+		p_disrcb->maxdly = 0U;
+		p_disrcb->maskcnt = 0U;
+	}
+}
+
+#endif /* TOPPERS_disrini */
+
+/*
+ *  遅延実行する割込みサービスルーチンの実行要求（上半部）
+ *
+ *  実行要求が登録済みの場合には，新たに登録せずにまとめる．p_maskcbが
+ *  NULLでない場合（レベルトリガの割込み）には，同じ割込み番号に対する
+ *  すべての下半部の実行が終わるまで，割込み要求禁止フラグをセットして
+ *  おく．
+ */
+#ifdef TOPPERS_disrreq
+
+void
+request_deferred_isr(uint_t idx)
+{
+	const DISRINIB	*p_disrinib = &(disrinib_table[idx]);
+	DISRCB			*p_disrcb = &(disrcb_table[idx]);
+
+	lock_cpu();
+	if (p_disrcb->pending) {
+		p_disrcb->coalcnt += 1U;
+	}
+	else {
+		p_disrcb->pending = true;
+		p_disrcb->reqtim = target_hrt_get_current();
+		p_disrcb->quecnt += 1U;
+#ifdef TOPPERS_SUPPORT_DIS_INT
+		if (p_disrinib->p_maskcb != NULL) {
+			if (p_disrinib->p_maskcb->maskcnt == 0U) {
+				disable_int(p_disrinib->intno);
+			}
+			p_disrinib->p_maskcb->maskcnt += 1U;
+		}
+#endif /* TOPPERS_SUPPORT_DIS_INT */
+		(void) nfy_wup_tsk(p_disrinib->p_tcb);
+		if (p_runtsk != p_schedtsk) {
+			request_dispatch_retint();
+		}
+	}
+	unlock_cpu();
+}
+
+#endif /* TOPPERS_disrreq */
+
+/*
+ *  遅延ISR実行タスクの本体（下半部）
+ *
+ *  実行要求が登録されているISRを，ISR優先度の高い順に実行する．1つの
+ *  ISRを実行する度に先頭から探し直すことで，その間に実行要求が登録さ
+ *  れたISR優先度の高いISRを先に実行する．
+ */
+#ifdef TOPPERS_disrtsk
+
+void
+deferred_isr_task(EXINF exinf)
+{
+	const DISRTINIB	*p_disrtinib = (const DISRTINIB *) exinf;
+	const DISRINIB	*p_disrinib;
+	DISRCB			*p_disrcb;
+	uint_t			i;
+	HRTCNT			hrtcnt, delay;
+
+	while (true) {
+		(void) slp_tsk();
+
+		i = 0U;
+		while (i < p_disrtinib->num) {
+			p_disrinib = &(disrinib_table[p_disrtinib->first + i]);
+			p_disrcb = &(disrcb_table[p_disrtinib->first + i]);
+
+			lock_cpu();
+			if (p_disrcb->pending) {
+				p_disrcb->pending = false;
+				hrtcnt = target_hrt_get_current();
+				delay = hrtcnt - p_disrcb->reqtim;
+#ifdef TCYC_HRTCNT
+				if (hrtcnt < p_disrcb->reqtim) {
+					delay += TCYC_HRTCNT;
+				}
+#endif /* TCYC_HRTCNT */
+				if (delay > p_disrcb->maxdly) {
+					p_disrcb->maxdly = delay;
+				}
+				unlock_cpu();
+
+				(*(p_disrinib->isr))(p_disrinib->exinf);
+
+				lock_cpu();
+#ifdef TOPPERS_SUPPORT_ENA_INT
+				if (p_disrinib->p_maskcb != NULL) {
+					p_disrinib->p_maskcb->maskcnt -= 1U;
+					if (p_disrinib->p_maskcb->maskcnt == 0U) {
+						enable_int(p_disrinib->intno);
+					}
+				}
+#endif /* TOPPERS_SUPPORT_ENA_INT */
+				unlock_cpu();
+				i = 0U;
+			}
+			else {
+				unlock_cpu();
+				i++;
+			}
+		}
+	}
+}
+
+#endif /* TOPPERS_disrtsk */
+
 /*
  *  割込みの禁止［NGKI3555］
  */
@@ -48,6 +48,7 @@
 #define TOPPERS_INTERRUPT_H
 
 #include "kernel_impl.h"
+#include "task.h"
 
 #if !defined(OMIT_INITIALIZE_INTERRUPT) || defined(USE_INHINIB_TABLE)
 
@@ -95,9 +96,94 @@ extern const INTINIB	intinib_table[];
 
 #endif /* !defined(OMIT_INITIALIZE_INTERRUPT) || defined(USE_INTINIB_TABLE) */
 
+/*
+ *  遅延実行する割込みサービスルーチン初期化ブロック
+ *
+ *  TA_DEFER属性の割込みサービスルーチン（ISR）は，割込み処理の中では実
+ *  行要求の登録のみを行い（上半部），ISR本体は割込み優先度毎に用意され
+ *  るカーネル管理のタスク（遅延ISR実行タスク）が実行する（下半部）．
+ */
+typedef struct deferred_isr_control_block DISRCB;
+
+typedef struct deferred_isr_initialization_block {
+	INTNO		intno;			/* 割込み番号 */
+	DISRCB		*p_maskcb;		/* 割込み要求禁止フラグを管理するブロック */
+	TCB			*p_tcb;			/* 遅延ISR実行タスクのTCB */
+	EXINF		exinf;			/* ISRの拡張情報 */
+	ISR			isr;			/* ISRの先頭番地 */
+} DISRINIB;
+
+/*
+ *  遅延実行する割込みサービスルーチン管理ブロック
+ *
+ *  下半部の実行が終わるまで割込みを禁止する場合（レベルトリガの割込み）
+ *  には，DISRINIBのp_maskcbが，同じ割込み番号に対する最初のTA_DEFER属
+ *  性のISRの管理ブロックを指す．その管理ブロックのmaskcntで，割込み要
+ *  求禁止フラグをセットしている間に実行要求が登録されているISRの数を
+ *  数え，それが0になった時点で割込み要求禁止フラグをクリアする．割込
+ *  みを禁止しない場合には，p_maskcbはNULLとする．
+ */
+struct deferred_isr_control_block {
+	bool_t		pending;		/* 実行要求が登録されているか */
+	HRTCNT		reqtim;			/* 実行要求が登録された時刻 */
+	uint_t		quecnt;			/* 実行要求を登録した回数 */
+	uint_t		coalcnt;		/* 実行要求をまとめた回数 */
+	HRTCNT		maxdly;			/* 下半部の実行開始までの最大遅延時間 */
+	uint_t		maskcnt;		/* 割込みを禁止しているISRの数 */
+};
+
+/*
+ *  遅延ISR実行タスク初期化ブロック
+ *
+ *  遅延ISR実行タスクの拡張情報として，このブロックへのポインタを渡す．
+ *  1つのタスクが担当するISRは，DISRINIBのテーブル中で連続して，ISR優
+ *  先度順に並んでいる．
+ */
+typedef struct deferred_isr_task_initialization_block {
+	uint_t		first;			/* 担当するISRの先頭のインデックス */
+	uint_t		num;			/* 担当するISRの数 */
+} DISRTINIB;
+
+/*
+ *  遅延実行する割込みサービスルーチンの数（kernel_cfg.c）
+ */
+extern const uint_t	tnum_disr;
+
+/*
+ *  遅延実行する割込みサービスルーチン初期化ブロックのエリア（kernel_cfg.c）
+ */
+extern const DISRINIB	disrinib_table[];
+
+/*
+ *  遅延実行する割込みサービスルーチン管理ブロックのエリア（kernel_cfg.c）
+ */
+extern DISRCB	disrcb_table[];
+
+/*
+ *  遅延ISR実行タスク初期化ブロックのエリア（kernel_cfg.c）
+ */
+extern const DISRTINIB	disrtinib_table[];
+
 /*
  *  割込み管理機能の初期化
  */
 extern void	initialize_interrupt(void);
 
+/*
+ *  遅延実行する割込みサービスルーチンの管理ブロックの初期化
+ */
+extern void	initialize_deferred_isr(void);
+
+/*
+ *  遅延実行する割込みサービスルーチンの実行要求（上半部）
+ *
+ *  コンフィギュレータが生成する割込みハンドラから呼び出す．
+ */
+extern void	request_deferred_isr(uint_t idx);
+
+/*
+ *  遅延ISR実行タスクの本体（下半部）
+ */
+extern void	deferred_isr_task(EXINF exinf);
+
 #endif /* TOPPERS_INTERRUPT_H */
@@ -134,6 +134,7 @@
 #define TMIN_MTXID		1		/* ミューテックスIDの最小値 */
 #define TMIN_MBFID		1		/* メッセージバッファIDの最小値 */
 #define TMIN_MPFID		1		/* 固定長メモリプールIDの最小値 */
+#define TMIN_CHNID		1		/* チャネルIDの最小値 */
 #define TMIN_CYCID		1		/* 周期通知IDの最小値 */
 #define TMIN_ALMID		1		/* アラーム通知IDの最小値 */
 
@@ -144,10 +145,27 @@
 #define TNUM_DPRI		(TMAX_DPRI - TMIN_DPRI + 1)
 #define TNUM_INTPRI		(TMAX_INTPRI - TMIN_INTPRI + 1)
 
+/*
+ *  遅延ISR実行タスクの優先度とスタックサイズ
+ *
+ *  TPRI_DISRTSKは，最も割込み優先度の高い割込みを担当する遅延ISR実行
+ *  タスクの優先度である．それ以外の遅延ISR実行タスクには，担当する割
+ *  込み優先度の高い順に，1ずつ低いタスク優先度を割り当てる．
+ */
+#ifndef TPRI_DISRTSK
+#define TPRI_DISRTSK	TMIN_TPRI
+#endif /* TPRI_DISRTSK */
+
+#ifndef STKSZ_DISRTSK
+#define STKSZ_DISRTSK	DEFAULT_SSTKSZ
+#endif /* STKSZ_DISRTSK */
+
 /*
  *  カーネル内部で使用する属性の定義
  */
 #define TA_NOEXS		((ATR)(-1))			/* 未登録状態 */
+#define TA_NFYLOCK		UINT_C(0x8000)		/* 通知ハンドラをCPUロック状態
+											   で呼び出す */
 
 #ifndef TOPPERS_MACRO_ONLY
 
@@ -223,6 +241,68 @@ extern void	sta_ker(void);
  */
 extern void	exit_kernel(void);
 
+#ifdef TOPPERS_BOOT_PROFILE
+/*
+ *  カーネル起動時間の計測（startup.c）
+ *
+ *  TOPPERS_BOOT_PROFILEをマクロ定義すると，カーネルの起動処理の各段階
+ *  を通過した時刻を，ターゲット依存部が用意するTARGET_BOOT_PROFILE_TIME
+ *  を用いて，bootprof_tableに記録する．時刻の単位はターゲット依存であ
+ *  る．初期化ルーチンについては，最初のTNUM_BOOTPROF_INIRTN個について，
+ *  それぞれの実行を終了した時刻を記録する．
+ */
+#ifndef TNUM_BOOTPROF_INIRTN
+#define TNUM_BOOTPROF_INIRTN	16U
+#endif /* TNUM_BOOTPROF_INIRTN */
+
+#define BOOTPROF_STA_KER		0U		/* sta_kerの呼出し */
+#define BOOTPROF_TECS			1U		/* TECSの初期化の終了 */
+#define BOOTPROF_TARGET			2U		/* ターゲット依存の初期化の終了 */
+#define BOOTPROF_MEMORY			3U		/* メモリ管理の初期化の終了 */
+#define BOOTPROF_TMEVT			4U		/* タイムイベント管理の初期化の終了 */
+#define BOOTPROF_DOMAIN			5U		/* 保護ドメイン管理の初期化の終了 */
+#define BOOTPROF_OBJECT			6U		/* オブジェクトの初期化の終了 */
+#define BOOTPROF_START			7U		/* カーネル動作の開始 */
+
+/*
+ *  オブジェクトの初期化（initialize_object）の内訳
+ *
+ *  initialize_objectの中で，各種オブジェクトの初期化を終了した時刻を記
+ *  録する．オブジェクトが1つもない種類については記録しない．
+ */
+#define BOOTPROF_INI_TASK			8U		/* タスク */
+#define BOOTPROF_INI_SEMAPHORE		9U		/* セマフォ */
+#define BOOTPROF_INI_EVENTFLAG		10U		/* イベントフラグ */
+#define BOOTPROF_INI_DATAQUEUE		11U		/* データキュー */
+#define BOOTPROF_INI_PRIDATAQ		12U		/* 優先度データキュー */
+#define BOOTPROF_INI_MUTEX			13U		/* ミューテックス */
+#define BOOTPROF_INI_MESSAGEBUF		14U		/* メッセージバッファ */
+#define BOOTPROF_INI_MEMPFIX		15U		/* 固定長メモリプール */
+#define BOOTPROF_INI_CHANNEL		16U		/* チャネル */
+#define BOOTPROF_INI_CYCLIC			17U		/* 周期通知 */
+#define BOOTPROF_INI_ALARM			18U		/* アラーム通知 */
+#define BOOTPROF_INI_SPORADIC		19U		/* スポラディックサーバ */
+#define BOOTPROF_INI_DEFERRED_ISR	20U		/* 遅延ISR */
+#define BOOTPROF_INI_INTERRUPT		21U		/* 割込み管理機能 */
+#define BOOTPROF_INI_EXCEPTION		22U		/* CPU例外管理機能 */
+
+#define BOOTPROF_INIRTN(i)		(23U + (i))	/* 初期化ルーチンの終了 */
+#define TNUM_BOOTPROF			(23U + TNUM_BOOTPROF_INIRTN)
+
+extern uint32_t	bootprof_table[TNUM_BOOTPROF];
+
+/*
+ *  カーネル起動時間の記録
+ *
+ *  startup.cに加えて，コンフィギュレータが生成するinitialize_objectか
+ *  らも用いる．
+ */
+#define BOOT_PROFILE(phase) \
+				(bootprof_table[phase] = (uint32_t) TARGET_BOOT_PROFILE_TIME())
+#else /* TOPPERS_BOOT_PROFILE */
+#define BOOT_PROFILE(phase)
+#endif /* TOPPERS_BOOT_PROFILE */
+
 /*
  *  通知ハンドラの型定義
  */
@@ -65,6 +65,7 @@
 #include "mutex.h"
 #include "messagebuf.h"
 #include "mempfix.h"
+#include "channel.h"
 #include "cyclic.h"
 #include "alarm.h"
 #include "interrupt.h"
@@ -8,6 +8,7 @@
  */
 #define kerflg						_kernel_kerflg
 #define exit_kernel					_kernel_exit_kernel
+#define bootprof_table				_kernel_bootprof_table
 
 /*
  *  domain.c
@@ -25,6 +26,10 @@
 #define twdtimer_enable				_kernel_twdtimer_enable
 #define twdtimer_flag				_kernel_twdtimer_flag
 #define left_twdtim					_kernel_left_twdtim
+#define twdstat_cur					_kernel_twdstat_cur
+#define p_twdstat					_kernel_p_twdstat
+#define p_twdstat_acc				_kernel_p_twdstat_acc
+#define twdstat_sttim				_kernel_twdstat_sttim
 #define rundom						_kernel_rundom
 #define p_ctxdom					_kernel_p_ctxdom
 #define initialize_domain			_kernel_initialize_domain
@@ -35,7 +40,9 @@
 #define scyc_switch					_kernel_scyc_switch
 #define twd_start					_kernel_twd_start
 #define twd_switch					_kernel_twd_switch
+#define search_slktsk				_kernel_search_slktsk
 #define set_dspflg					_kernel_set_dspflg
+#define release_dsp_hold			_kernel_release_dsp_hold
 
 /*
  *  task.c
@@ -52,8 +59,26 @@
 #define make_active					_kernel_make_active
 #define change_priority				_kernel_change_priority
 #define rotate_ready_queue			_kernel_rotate_ready_queue
+#define change_deadline				_kernel_change_deadline
+#define stack_fill					_kernel_stack_fill
+#define stack_usage					_kernel_stack_usage
 #define task_terminate				_kernel_task_terminate
 
+/*
+ *  task_manage.c
+ */
+#define nfy_act_tsk					_kernel_nfy_act_tsk
+
+/*
+ *  task_refer.c
+ */
+#define refer_task					_kernel_refer_task
+
+/*
+ *  task_sync.c
+ */
+#define nfy_wup_tsk					_kernel_nfy_wup_tsk
+
 /*
  *  taskhook.c
  */
@@ -82,6 +107,8 @@
 #define probe_mem_write				_kernel_probe_mem_write
 #define probe_mem_read				_kernel_probe_mem_read
 #define initialize_sections			_kernel_initialize_sections
+#define lzsecini_pending			_kernel_lzsecini_pending
+#define initialize_domain_sections	_kernel_initialize_domain_sections
 
 /*
  *  time_event.c
@@ -110,12 +137,14 @@
  *  semaphore.c
  */
 #define initialize_semaphore		_kernel_initialize_semaphore
+#define nfy_sig_sem					_kernel_nfy_sig_sem
 
 /*
  *  eventflag.c
  */
 #define initialize_eventflag		_kernel_initialize_eventflag
 #define check_flg_cond				_kernel_check_flg_cond
+#define nfy_set_flg					_kernel_nfy_set_flg
 
 /*
  *  dataqueue.c
@@ -165,11 +194,30 @@
 #define initialize_mempfix			_kernel_initialize_mempfix
 #define get_mpf_block				_kernel_get_mpf_block
 
+/*
+ *  channel.c
+ */
+#define initialize_channel			_kernel_initialize_channel
+#define channel_wakeup				_kernel_channel_wakeup
+
+/*
+ *  objstat.c
+ */
+#define objstat_initialize			_kernel_objstat_initialize
+#define objstat_wait_end			_kernel_objstat_wait_end
+#define objstat_change				_kernel_objstat_change
+
+/*
+ *  snapshot.c
+ */
+#define snpgen						_kernel_snpgen
+
 /*
  *  cyclic.c
  */
 #define initialize_cyclic			_kernel_initialize_cyclic
 #define call_cyclic					_kernel_call_cyclic
+#define call_cycgrp					_kernel_call_cycgrp
 
 /*
  *  alarm.c
@@ -181,6 +229,9 @@
  *  interrupt.c
  */
 #define initialize_interrupt		_kernel_initialize_interrupt
+#define initialize_deferred_isr		_kernel_initialize_deferred_isr
+#define request_deferred_isr		_kernel_request_deferred_isr
+#define deferred_isr_task			_kernel_deferred_isr_task
 
 /*
  *  exception.c
@@ -220,9 +271,15 @@
 #define tmax_mpfid					_kernel_tmax_mpfid
 #define mpfinib_table				_kernel_mpfinib_table
 #define mpfcb_table					_kernel_mpfcb_table
+#define tmax_chnid					_kernel_tmax_chnid
+#define chninib_table				_kernel_chninib_table
+#define chncb_table					_kernel_chncb_table
 #define tmax_cycid					_kernel_tmax_cycid
 #define cycinib_table				_kernel_cycinib_table
 #define cyccb_table					_kernel_cyccb_table
+#define tnum_cycgrp					_kernel_tnum_cycgrp
+#define cycginib_table				_kernel_cycginib_table
+#define cycgcb_table				_kernel_cycgcb_table
 #define tmax_almid					_kernel_tmax_almid
 #define alminib_table				_kernel_alminib_table
 #define almcb_table					_kernel_almcb_table
@@ -230,6 +287,10 @@
 #define inhinib_table				_kernel_inhinib_table
 #define tnum_cfg_intno				_kernel_tnum_cfg_intno
 #define intinib_table				_kernel_intinib_table
+#define tnum_disr					_kernel_tnum_disr
+#define disrinib_table				_kernel_disrinib_table
+#define disrcb_table				_kernel_disrcb_table
+#define disrtinib_table				_kernel_disrtinib_table
 #define tnum_def_excno				_kernel_tnum_def_excno
 #define excinib_table				_kernel_excinib_table
 #define tmax_fncd					_kernel_tmax_fncd
@@ -249,6 +310,11 @@
 #define tnum_schedcb				_kernel_tnum_schedcb
 #define schedcb_table				_kernel_schedcb_table
 #define twdinib_table				_kernel_twdinib_table
+#define tnum_slksched				_kernel_tnum_slksched
+#define slksched_table				_kernel_slksched_table
+#define tnum_edfsched				_kernel_tnum_edfsched
+#define edfsched_table				_kernel_edfsched_table
+#define twdstat_table				_kernel_twdstat_table
 #define tmax_somid					_kernel_tmax_somid
 #define p_inisom					_kernel_p_inisom
 #define sominib_table				_kernel_sominib_table
@@ -266,6 +332,8 @@
 #define datasecinib_table			_kernel_datasecinib_table
 #define tnum_bsssec					_kernel_tnum_bsssec
 #define bsssecinib_table			_kernel_bsssecinib_table
+#define tnum_lzsec					_kernel_tnum_lzsec
+#define lzsecinib_table				_kernel_lzsecinib_table
 
 /*
  *  tTraceLog.c
@@ -9,6 +9,7 @@
  */
 #undef kerflg
 #undef exit_kernel
+#undef bootprof_table
 
 /*
  *  domain.c
@@ -26,6 +27,10 @@
 #undef twdtimer_enable
 #undef twdtimer_flag
 #undef left_twdtim
+#undef twdstat_cur
+#undef p_twdstat
+#undef p_twdstat_acc
+#undef twdstat_sttim
 #undef rundom
 #undef p_ctxdom
 #undef initialize_domain
@@ -36,7 +41,9 @@
 #undef scyc_switch
 #undef twd_start
 #undef twd_switch
+#undef search_slktsk
 #undef set_dspflg
+#undef release_dsp_hold
 
 /*
  *  task.c
@@ -53,8 +60,26 @@
 #undef make_active
 #undef change_priority
 #undef rotate_ready_queue
+#undef change_deadline
+#undef stack_fill
+#undef stack_usage
 #undef task_terminate
 
+/*
+ *  task_manage.c
+ */
+#undef nfy_act_tsk
+
+/*
+ *  task_refer.c
+ */
+#undef refer_task
+
+/*
+ *  task_sync.c
+ */
+#undef nfy_wup_tsk
+
 /*
  *  taskhook.c
  */
@@ -83,6 +108,8 @@
 #undef probe_mem_write
 #undef probe_mem_read
 #undef initialize_sections
+#undef lzsecini_pending
+#undef initialize_domain_sections
 
 /*
  *  time_event.c
@@ -111,12 +138,14 @@
  *  semaphore.c
  */
 #undef initialize_semaphore
+#undef nfy_sig_sem
 
 /*
  *  eventflag.c
  */
 #undef initialize_eventflag
 #undef check_flg_cond
+#undef nfy_set_flg
 
 /*
  *  dataqueue.c
@@ -166,11 +195,30 @@
 #undef initialize_mempfix
 #undef get_mpf_block
 
+/*
+ *  channel.c
+ */
+#undef initialize_channel
+#undef channel_wakeup
+
+/*
+ *  objstat.c
+ */
+#undef objstat_initialize
+#undef objstat_wait_end
+#undef objstat_change
+
+/*
+ *  snapshot.c
+ */
+#undef snpgen
+
 /*
  *  cyclic.c
  */
 #undef initialize_cyclic
 #undef call_cyclic
+#undef call_cycgrp
 
 /*
  *  alarm.c
@@ -182,6 +230,9 @@
  *  interrupt.c
  */
 #undef initialize_interrupt
+#undef initialize_deferred_isr
+#undef request_deferred_isr
+#undef deferred_isr_task
 
 /*
  *  exception.c
@@ -221,9 +272,15 @@
 #undef tmax_mpfid
 #undef mpfinib_table
 #undef mpfcb_table
+#undef tmax_chnid
+#undef chninib_table
+#undef chncb_table
 #undef tmax_cycid
 #undef cycinib_table
 #undef cyccb_table
+#undef tnum_cycgrp
+#undef cycginib_table
+#undef cycgcb_table
 #undef tmax_almid
 #undef alminib_table
 #undef almcb_table
@@ -231,6 +288,10 @@
 #undef inhinib_table
 #undef tnum_cfg_intno
 #undef intinib_table
+#undef tnum_disr
+#undef disrinib_table
+#undef disrcb_table
+#undef disrtinib_table
 #undef tnum_def_excno
 #undef excinib_table
 #undef tmax_fncd
@@ -250,6 +311,11 @@
 #undef tnum_schedcb
 #undef schedcb_table
 #undef twdinib_table
+#undef tnum_slksched
+#undef slksched_table
+#undef tnum_edfsched
+#undef edfsched_table
+#undef twdstat_table
 #undef tmax_somid
 #undef p_inisom
 #undef sominib_table
@@ -267,6 +333,8 @@
 #undef datasecinib_table
 #undef tnum_bsssec
 #undef bsssecinib_table
+#undef tnum_lzsec
+#undef lzsecinib_table
 
 /*
  *  tTraceLog.c
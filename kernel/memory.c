@@ -196,7 +196,7 @@ initialize_sections(void)
 #ifndef OMIT_IDATA
 	for (i = 0; i < tnum_datasec; i++) {
 		p_datasecinib = &(datasecinib_table[i]);
-		memcpy(p_datasecinib->start_data, p_datasecinib->start_idata,
+		copy_section(p_datasecinib->start_data, p_datasecinib->start_idata,
 							((char *) p_datasecinib->end_data)
 									- ((char *) p_datasecinib->start_data));
 	}
@@ -204,7 +204,7 @@ initialize_sections(void)
 
 	for (i = 0; i < tnum_bsssec; i++) {
 		p_bsssecinib = &(bsssecinib_table[i]);
-		memset(p_bsssecinib->start_bss, 0,
+		zero_section(p_bsssecinib->start_bss,
 							((char *) p_bsssecinib->end_bss)
 									- ((char *) p_bsssecinib->start_bss));
 	}
@@ -212,3 +212,63 @@ initialize_sections(void)
 
 #endif /* OMIT_INITIALIZE_SECTIONS */
 #endif /* TOPPERS_secini */
+
+/*
+ *  保護ドメインに属するセクションの遅延初期化
+ */
+#ifdef TOPPERS_lzsecini
+#ifdef USE_LAZY_SECINI
+
+/*
+ *  セクションの初期化が済んでいない保護ドメインのビットパターン
+ *
+ *  カーネルのdataセクションの初期化により，すべての保護ドメインを初期
+ *  化が済んでいない状態にする．initialize_memoryで初期化すると，
+ *  OMIT_INITIALIZE_MEMORYによって初期化が省略されてしまうため，初期値
+ *  を与える方法を用いている．遅延初期化するセクションを持たない保護ド
+ *  メインは，initialize_domain_sectionsが最初に呼ばれた時点でビットが
+ *  クリアされる．
+ */
+ACPTN	lzsecini_pending = ~((ACPTN) 0U);
+
+void
+initialize_domain_sections(ACPTN domptn)
+{
+	uint_t				i, j;
+	const LZSECINIB		*p_lzsecinib;
+#ifndef OMIT_IDATA
+	const DATASECINIB	*p_datasecinib;
+#endif /* OMIT_IDATA */
+	const BSSSECINIB	*p_bsssecinib;
+
+	if ((lzsecini_pending & domptn) == 0U) {
+		return;
+	}
+
+	for (i = 0; i < tnum_lzsec; i++) {
+		p_lzsecinib = &(lzsecinib_table[i]);
+		if (p_lzsecinib->domptn == domptn) {
+#ifndef OMIT_IDATA
+			p_datasecinib = &(datasecinib_table[p_lzsecinib->idx_datasec]);
+			for (j = 0; j < p_lzsecinib->num_datasec; j++, p_datasecinib++) {
+				copy_section(p_datasecinib->start_data,
+							p_datasecinib->start_idata,
+							((char *) p_datasecinib->end_data)
+									- ((char *) p_datasecinib->start_data));
+			}
+#endif /* OMIT_IDATA */
+
+			p_bsssecinib = &(bsssecinib_table[p_lzsecinib->idx_bsssec]);
+			for (j = 0; j < p_lzsecinib->num_bsssec; j++, p_bsssecinib++) {
+				zero_section(p_bsssecinib->start_bss,
+							((char *) p_bsssecinib->end_bss)
+									- ((char *) p_bsssecinib->start_bss));
+			}
+			break;
+		}
+	}
+	lzsecini_pending &= ~domptn;
+}
+
+#endif /* USE_LAZY_SECINI */
+#endif /* TOPPERS_lzsecini */
@@ -209,4 +209,63 @@ typedef struct {
 extern const uint_t	tnum_bsssec;
 extern const BSSSECINIB	bsssecinib_table[];
 
+/*
+ *  セクションの初期化処理
+ *
+ *  dataセクションの初期化（copy_section）とbssセクションのクリア
+ *  （zero_section）に用いる関数．ターゲット依存部でより効率の良い関数
+ *  を用意する場合には，OMIT_COPY_SECTIONとOMIT_ZERO_SECTIONをマクロ定義
+ *  すればよい．
+ */
+#ifndef OMIT_COPY_SECTION
+#define copy_section(dst, src, size)	memcpy(dst, src, size)
+#endif /* OMIT_COPY_SECTION */
+
+#ifndef OMIT_ZERO_SECTION
+#define zero_section(dst, size)			memset(dst, 0, size)
+#endif /* OMIT_ZERO_SECTION */
+
+#ifdef USE_LAZY_SECINI
+
+/*
+ *  遅延初期化するセクションの初期化ブロック
+ *
+ *  ユーザドメインに属するdataセクションとbssセクションは，その保護ド
+ *  メインに属するタスクが最初に実行される直前に初期化する．dataセクショ
+ *  ン初期化ブロックとbssセクション初期化ブロックでは，tnum_datasec個
+ *  （tnum_bsssec個）のエントリの後に，保護ドメイン毎にまとめて置かれ
+ *  ており，その位置と数を保持する．
+ */
+typedef struct {
+	ACPTN	domptn;				/* 保護ドメインのビットパターン */
+	uint_t	idx_datasec;		/* dataセクション初期化ブロックの位置 */
+	uint_t	num_datasec;		/* dataセクションの数 */
+	uint_t	idx_bsssec;			/* bssセクション初期化ブロックの位置 */
+	uint_t	num_bsssec;			/* bssセクションの数 */
+} LZSECINIB;
+
+/*
+ *  遅延初期化するセクションを持つ保護ドメインの数と初期化ブロックのエ
+ *  リア（kernel_mem.c）
+ */
+extern const uint_t		tnum_lzsec;
+extern const LZSECINIB	lzsecinib_table[];
+
+/*
+ *  セクションの初期化が済んでいない保護ドメインのビットパターン
+ */
+extern ACPTN	lzsecini_pending;
+
+/*
+ *  保護ドメインに属するセクションの初期化
+ *
+ *  domptnで指定される保護ドメインに属するセクションの初期化が済んでい
+ *  ない場合に，それを初期化する．ユーザタスクの実行開始時処理から，
+ *  CPUロック状態で呼び出される．それまでにカーネルや他の保護ドメイン
+ *  がこれらのセクションに書き込んだ内容は，初期化によって上書きされる．
+ */
+extern void	initialize_domain_sections(ACPTN domptn);
+
+#endif /* USE_LAZY_SECINI */
+
 #endif /* TOPPERS_MEMORY_H */
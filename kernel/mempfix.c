@@ -119,6 +119,42 @@
 #define INDEX_NULL		(~0U)		/* 空きブロックリストの最後 */
 #define INDEX_ALLOC		(~1U)		/* 割当て済みのブロック */
 
+/*
+ *  固定長メモリプールの使用量（割り付けられているブロックの数）の記録
+ */
+#define MPF_OCCUPANCY(p_mpfcb)										\
+		OBJSTAT_OCCUPANCY(&((p_mpfcb)->objstat),					\
+					(p_mpfcb)->p_mpfinib->blkcnt - (p_mpfcb)->fblkcnt,	\
+					(p_mpfcb)->fblkcnt == 0U)
+
+#ifdef USE_LOCK_ELISION
+/*
+ *  CPUロック状態にしない固定長メモリブロックの獲得
+ *
+ *  固定長メモリプールはタスクコンテキスト専用であるため，タスク切換え
+ *  を保留してブロックを獲得する．空きブロックがない場合にはfalseを返
+ *  す．
+ */
+Inline bool_t
+get_mpf_held(MPFCB *p_mpfcb, void **p_blk)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if (p_mpfcb->fblkcnt > 0) {
+		get_mpf_block(p_mpfcb, p_blk);
+		OBJSTAT_ACQUIRE(&(p_mpfcb->objstat), E_OK);
+		done = true;
+	}
+	else {
+		done = false;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+#endif /* USE_LOCK_ELISION */
+
 /*
  *  固定長メモリプール機能の初期化
  */
@@ -137,6 +173,7 @@ initialize_mempfix(void)
 		p_mpfcb->fblkcnt = p_mpfcb->p_mpfinib->blkcnt;
 		p_mpfcb->unused = 0U;
 		p_mpfcb->freelist = INDEX_NULL;
+		OBJSTAT_INIT(&(p_mpfcb->objstat), 0U, p_mpfcb->fblkcnt == 0U);
 	}
 }
 
@@ -164,6 +201,8 @@ get_mpf_block(MPFCB *p_mpfcb, void **p_blk)
 								+ p_mpfcb->p_mpfinib->blksz * blkidx);
 	p_mpfcb->fblkcnt--;
 	(p_mpfcb->p_mpfinib->p_mpfmb + blkidx)->next = INDEX_ALLOC;
+	UPDATE_SNPGEN();
+	MPF_OCCUPANCY(p_mpfcb);
 }
 
 #endif /* TOPPERS_mpfget */
@@ -182,11 +221,18 @@ get_mpf(ID mpfid, void **p_blk)
 
 	LOG_GET_MPF_ENTER(mpfid, p_blk);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_MPFID(mpfid));
 	CHECK_MACV_WRITE(p_blk, void *);
 	p_mpfcb = get_mpfcb(mpfid);
 	CHECK_ACPTN(p_mpfcb->p_mpfinib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (!p_runtsk->raster && get_mpf_held(p_mpfcb, p_blk)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -198,12 +244,15 @@ get_mpf(ID mpfid, void **p_blk)
 	else {
 		wobj_make_wait((WOBJCB *) p_mpfcb, TS_WAITING_MPF,
 											(WINFO_WOBJ *) &winfo_mpf);
+		OBJSTAT_WAIT(&(p_mpfcb->objstat), &(p_mpfcb->wait_queue));
 		dispatch();
 		ercd = winfo_mpf.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_mpfcb->objstat), ercd);
 		if (ercd == E_OK) {
 			*p_blk = winfo_mpf.blk;
 		}
 	}
+	OBJSTAT_ACQUIRE(&(p_mpfcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -231,6 +280,12 @@ pget_mpf(ID mpfid, void **p_blk)
 	p_mpfcb = get_mpfcb(mpfid);
 	CHECK_ACPTN(p_mpfcb->p_mpfinib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (get_mpf_held(p_mpfcb, p_blk)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (p_mpfcb->fblkcnt > 0) {
 		get_mpf_block(p_mpfcb, p_blk);
@@ -239,6 +294,7 @@ pget_mpf(ID mpfid, void **p_blk)
 	else {
 		ercd = E_TMOUT;
 	}
+	OBJSTAT_ACQUIRE(&(p_mpfcb->objstat), ercd);
 	unlock_cpu();
 
   error_exit:
@@ -263,12 +319,19 @@ tget_mpf(ID mpfid, void **p_blk, TMO tmout)
 
 	LOG_TGET_MPF_ENTER(mpfid, p_blk, tmout);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_MPFID(mpfid));
 	CHECK_MACV_WRITE(p_blk, void *);
 	CHECK_PAR(VALID_TMOUT(tmout));
 	p_mpfcb = get_mpfcb(mpfid);
 	CHECK_ACPTN(p_mpfcb->p_mpfinib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (!p_runtsk->raster && get_mpf_held(p_mpfcb, p_blk)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -283,12 +346,15 @@ tget_mpf(ID mpfid, void **p_blk, TMO tmout)
 	else {
 		wobj_make_wait_tmout((WOBJCB *) p_mpfcb, TS_WAITING_MPF,
 								(WINFO_WOBJ *) &winfo_mpf, &tmevtb, tmout);
+		OBJSTAT_WAIT(&(p_mpfcb->objstat), &(p_mpfcb->wait_queue));
 		dispatch();
 		ercd = winfo_mpf.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_mpfcb->objstat), ercd);
 		if (ercd == E_OK) {
 			*p_blk = winfo_mpf.blk;
 		}
 	}
+	OBJSTAT_ACQUIRE(&(p_mpfcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -311,6 +377,9 @@ rel_mpf(ID mpfid, void *blk)
 	uint_t	blkidx;
 	TCB		*p_tcb;
 	ER		ercd;
+#ifdef USE_LOCK_ELISION
+	bool_t	held;
+#endif /* USE_LOCK_ELISION */
     
 	LOG_REL_MPF_ENTER(mpfid, blk);
 	CHECK_TSKCTX_UNL();
@@ -324,6 +393,24 @@ rel_mpf(ID mpfid, void *blk)
 	blkidx = (uint_t)(blkoffset / p_mpfcb->p_mpfinib->blksz);
 	CHECK_PAR((p_mpfcb->p_mpfinib->p_mpfmb + blkidx)->next == INDEX_ALLOC);
 
+#ifdef USE_LOCK_ELISION
+	/*
+	 *  待ち行列にタスクがなければ，タスク切換えを保留してブロックを
+	 *  返却する．
+	 */
+	held = begin_dsp_hold();
+	if (queue_empty(&(p_mpfcb->wait_queue))) {
+		p_mpfcb->fblkcnt++;
+		(p_mpfcb->p_mpfinib->p_mpfmb + blkidx)->next = p_mpfcb->freelist;
+		p_mpfcb->freelist = blkidx;
+		UPDATE_SNPGEN();
+		MPF_OCCUPANCY(p_mpfcb);
+		end_dsp_hold(held);
+		ercd = E_OK;
+		goto error_exit;
+	}
+	end_dsp_hold(held);
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (!queue_empty(&(p_mpfcb->wait_queue))) {
 		p_tcb = (TCB *) queue_delete_next(&(p_mpfcb->wait_queue));
@@ -338,6 +425,8 @@ rel_mpf(ID mpfid, void *blk)
 		p_mpfcb->fblkcnt++;
 		(p_mpfcb->p_mpfinib->p_mpfmb + blkidx)->next = p_mpfcb->freelist;
 		p_mpfcb->freelist = blkidx;
+		UPDATE_SNPGEN();
+		MPF_OCCUPANCY(p_mpfcb);
 		ercd = E_OK;
 	}
 	unlock_cpu();
@@ -371,6 +460,8 @@ ini_mpf(ID mpfid)
 	p_mpfcb->fblkcnt = p_mpfcb->p_mpfinib->blkcnt;
 	p_mpfcb->unused = 0U;
 	p_mpfcb->freelist = INDEX_NULL;
+	UPDATE_SNPGEN();
+	MPF_OCCUPANCY(p_mpfcb);
 	if (p_runtsk != p_schedtsk) {
 		dispatch();
 	}
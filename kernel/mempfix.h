@@ -50,6 +50,7 @@
 #include "kernel_impl.h"
 #include <queue.h>
 #include "wait.h"
+#include "objstat.h"
 
 /*
  *  固定長メモリブロック管理ブロック
@@ -91,6 +92,9 @@ typedef struct fixed_memorypool_control_block {
 	uint_t		fblkcnt;		/* 未割当てブロック数 */
 	uint_t		unused;			/* 未使用ブロックの先頭 */
 	uint_t		freelist;		/* 未割当てブロックのリスト */
+#ifdef USE_OBJSTAT
+	OBJSTAT		objstat;		/* 統計情報ブロック */
+#endif /* USE_OBJSTAT */
 } MPFCB;
 
 /*
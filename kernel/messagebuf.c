@@ -131,6 +131,66 @@
 #define INDEX_MBF(mbfid)	((uint_t)((mbfid) - TMIN_MBFID))
 #define get_mbfcb(mbfid)	(&(mbfcb_table[INDEX_MBF(mbfid)]))
 
+/*
+ *  メッセージバッファの使用量（使用中の管理領域のサイズ）の記録
+ *
+ *  最大サイズのメッセージを格納できない場合を満杯とする．
+ */
+#define MBF_OCCUPANCY(p_mbfcb)										\
+		OBJSTAT_OCCUPANCY(&((p_mbfcb)->objstat),					\
+			(uint_t)((p_mbfcb)->p_mbfinib->mbfsz - (p_mbfcb)->fmbfsz),	\
+			(p_mbfcb)->fmbfsz < sizeof(uint_t)							\
+				+ TOPPERS_ROUND_SZ((p_mbfcb)->p_mbfinib->maxmsz, sizeof(uint_t)))
+
+#ifdef USE_LOCK_ELISION
+/*
+ *  CPUロック状態にしないメッセージバッファへの送信
+ *
+ *  メッセージバッファはタスクコンテキスト専用であるため，タスク切換え
+ *  を保留してメッセージを格納する．受信待ち行列または送信待ち行列にタ
+ *  スクがある場合と，メッセージバッファ管理領域に格納できない場合には
+ *  falseを返す．
+ */
+Inline bool_t
+snd_mbf_held(MBFCB *p_mbfcb, const void *msg, uint_t msgsz)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	done = (queue_empty(&(p_mbfcb->rwait_queue))
+				&& queue_empty(&(p_mbfcb->swait_queue))
+				&& enqueue_message(p_mbfcb, msg, msgsz));
+	end_dsp_hold(held);
+	return(done);
+}
+
+/*
+ *  CPUロック状態にしないメッセージバッファからの受信
+ *
+ *  タスク切換えを保留してメッセージを取り出し，そのサイズを返す．送信
+ *  待ち行列にタスクがある場合と，メッセージバッファ管理領域にメッセー
+ *  ジがない場合には0を返す．
+ */
+Inline uint_t
+rcv_mbf_held(MBFCB *p_mbfcb, void *msg)
+{
+	bool_t	held;
+	uint_t	msgsz;
+
+	held = begin_dsp_hold();
+	if (p_mbfcb->smbfcnt > 0U && queue_empty(&(p_mbfcb->swait_queue))) {
+		msgsz = dequeue_message(p_mbfcb, msg);
+		OBJSTAT_ACQUIRE(&(p_mbfcb->objstat), (ER_UINT) msgsz);
+	}
+	else {
+		msgsz = 0U;
+	}
+	end_dsp_hold(held);
+	return(msgsz);
+}
+
+#endif /* USE_LOCK_ELISION */
+
 /*
  *  メッセージバッファ機能の初期化
  */
@@ -153,6 +213,8 @@ initialize_messagebuf(void)
 		p_mbfcb->head = 0U;
 		p_mbfcb->tail = 0U;
 		p_mbfcb->smbfcnt = 0U;
+		OBJSTAT_INIT(&(p_mbfcb->objstat), 0U, false);
+		MBF_OCCUPANCY(p_mbfcb);
 	}
 }
 
@@ -194,6 +256,8 @@ enqueue_message(MBFCB *p_mbfcb, const void *msg, uint_t msgsz)
 
 		p_mbfcb->fmbfsz -= allocsz;
 		p_mbfcb->smbfcnt++;
+		UPDATE_SNPGEN();
+		MBF_OCCUPANCY(p_mbfcb);
 		return(true);
 	}
 	return(false);
@@ -237,6 +301,8 @@ dequeue_message(MBFCB *p_mbfcb, void *msg)
 
 	p_mbfcb->fmbfsz += sizeof(uint_t) + TOPPERS_ROUND_SZ(msgsz, sizeof(uint_t));
 	p_mbfcb->smbfcnt--;
+	UPDATE_SNPGEN();
+	MBF_OCCUPANCY(p_mbfcb);
 	return(msgsz);
 }
 
@@ -358,12 +424,19 @@ snd_mbf(ID mbfid, const void *msg, uint_t msgsz)
 
 	LOG_SND_MBF_ENTER(mbfid, msg, msgsz);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_MBFID(mbfid));
 	CHECK_MACV_BUF_READ(msg, msgsz);
 	p_mbfcb = get_mbfcb(mbfid);
 	CHECK_ACPTN(p_mbfcb->p_mbfinib->acvct.acptn1);
 	CHECK_PAR(0 < msgsz && msgsz <= p_mbfcb->p_mbfinib->maxmsz);
 
+#ifdef USE_LOCK_ELISION
+	if (!p_runtsk->raster && snd_mbf_held(p_mbfcb, msg, msgsz)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -379,8 +452,10 @@ snd_mbf(ID mbfid, const void *msg, uint_t msgsz)
 		winfo_smbf.msgsz = msgsz;
 		wobj_make_wait((WOBJCB *) p_mbfcb, TS_WAITING_SMBF,
 											(WINFO_WOBJ *) &winfo_smbf);
+		OBJSTAT_WAIT(&(p_mbfcb->objstat), &(p_mbfcb->swait_queue));
 		dispatch();
 		ercd = winfo_smbf.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_mbfcb->objstat), ercd);
 	}
 	unlock_cpu_dsp();
 
@@ -410,6 +485,12 @@ psnd_mbf(ID mbfid, const void *msg, uint_t msgsz)
 	CHECK_ACPTN(p_mbfcb->p_mbfinib->acvct.acptn1);
 	CHECK_PAR(0 < msgsz && msgsz <= p_mbfcb->p_mbfinib->maxmsz);
 
+#ifdef USE_LOCK_ELISION
+	if (snd_mbf_held(p_mbfcb, msg, msgsz)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (send_message(p_mbfcb, msg, msgsz)) {
 		if (p_runtsk != p_schedtsk) {
@@ -444,6 +525,7 @@ tsnd_mbf(ID mbfid, const void *msg, uint_t msgsz, TMO tmout)
 
 	LOG_TSND_MBF_ENTER(mbfid, msg, msgsz, tmout);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_MBFID(mbfid));
 	CHECK_PAR(VALID_TMOUT(tmout));
 	CHECK_MACV_BUF_READ(msg, msgsz);
@@ -451,6 +533,12 @@ tsnd_mbf(ID mbfid, const void *msg, uint_t msgsz, TMO tmout)
 	CHECK_ACPTN(p_mbfcb->p_mbfinib->acvct.acptn1);
 	CHECK_PAR(0 < msgsz && msgsz <= p_mbfcb->p_mbfinib->maxmsz);
 
+#ifdef USE_LOCK_ELISION
+	if (!p_runtsk->raster && snd_mbf_held(p_mbfcb, msg, msgsz)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -469,8 +557,10 @@ tsnd_mbf(ID mbfid, const void *msg, uint_t msgsz, TMO tmout)
 		winfo_smbf.msgsz = msgsz;
 		wobj_make_wait_tmout((WOBJCB *) p_mbfcb, TS_WAITING_SMBF,
 								(WINFO_WOBJ *) &winfo_smbf, &tmevtb, tmout);
+		OBJSTAT_WAIT(&(p_mbfcb->objstat), &(p_mbfcb->swait_queue));
 		dispatch();
 		ercd = winfo_smbf.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_mbfcb->objstat), ercd);
 	}
 	unlock_cpu_dsp();
 
@@ -496,11 +586,18 @@ rcv_mbf(ID mbfid, void *msg)
 
 	LOG_RCV_MBF_ENTER(mbfid, msg);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_MBFID(mbfid));
 	p_mbfcb = get_mbfcb(mbfid);
 	CHECK_ACPTN(p_mbfcb->p_mbfinib->acvct.acptn2);
 	CHECK_MACV_BUF_WRITE(msg, p_mbfcb->p_mbfinib->maxmsz);
 
+#ifdef USE_LOCK_ELISION
+	if (!p_runtsk->raster && (msgsz = rcv_mbf_held(p_mbfcb, msg)) > 0U) {
+		ercd = (ER_UINT) msgsz;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -517,9 +614,12 @@ rcv_mbf(ID mbfid, void *msg)
 		winfo_rmbf.p_mbfcb = p_mbfcb;
 		winfo_rmbf.msg = msg;
 		LOG_TSKSTAT(p_runtsk);
+		OBJSTAT_WAIT(&(p_mbfcb->objstat), &(p_mbfcb->rwait_queue));
 		dispatch();
 		ercd = winfo_rmbf.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_mbfcb->objstat), ercd);
 	}
+	OBJSTAT_ACQUIRE(&(p_mbfcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -548,6 +648,12 @@ prcv_mbf(ID mbfid, void *msg)
 	CHECK_ACPTN(p_mbfcb->p_mbfinib->acvct.acptn2);
 	CHECK_MACV_BUF_WRITE(msg, p_mbfcb->p_mbfinib->maxmsz);
 
+#ifdef USE_LOCK_ELISION
+	if ((msgsz = rcv_mbf_held(p_mbfcb, msg)) > 0U) {
+		ercd = (ER_UINT) msgsz;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if ((msgsz = receive_message(p_mbfcb, msg)) > 0U) {
 		if (p_runtsk != p_schedtsk) {
@@ -558,6 +664,7 @@ prcv_mbf(ID mbfid, void *msg)
 	else {
 		ercd = E_TMOUT;
 	}
+	OBJSTAT_ACQUIRE(&(p_mbfcb->objstat), ercd);
 	unlock_cpu();
 
   error_exit:
@@ -583,12 +690,19 @@ trcv_mbf(ID mbfid, void *msg, TMO tmout)
 
 	LOG_TRCV_MBF_ENTER(mbfid, msg, tmout);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_MBFID(mbfid));
 	CHECK_PAR(VALID_TMOUT(tmout));
 	p_mbfcb = get_mbfcb(mbfid);
 	CHECK_ACPTN(p_mbfcb->p_mbfinib->acvct.acptn2);
 	CHECK_MACV_BUF_WRITE(msg, p_mbfcb->p_mbfinib->maxmsz);
 
+#ifdef USE_LOCK_ELISION
+	if (!p_runtsk->raster && (msgsz = rcv_mbf_held(p_mbfcb, msg)) > 0U) {
+		ercd = (ER_UINT) msgsz;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -608,9 +722,12 @@ trcv_mbf(ID mbfid, void *msg, TMO tmout)
 		winfo_rmbf.p_mbfcb = p_mbfcb;
 		winfo_rmbf.msg = msg;
 		LOG_TSKSTAT(p_runtsk);
+		OBJSTAT_WAIT(&(p_mbfcb->objstat), &(p_mbfcb->rwait_queue));
 		dispatch();
 		ercd = winfo_rmbf.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_mbfcb->objstat), ercd);
 	}
+	OBJSTAT_ACQUIRE(&(p_mbfcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -644,6 +761,8 @@ ini_mbf(ID mbfid)
 	p_mbfcb->head = 0U;
 	p_mbfcb->tail = 0U;
 	p_mbfcb->smbfcnt = 0U;
+	UPDATE_SNPGEN();
+	MBF_OCCUPANCY(p_mbfcb);
 	if (p_runtsk != p_schedtsk) {
 		dispatch();
 	}
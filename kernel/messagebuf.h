@@ -50,6 +50,7 @@
 #include "kernel_impl.h"
 #include <queue.h>
 #include "wait.h"
+#include "objstat.h"
 
 /*
  *  メッセージバッファ初期化ブロック
@@ -81,6 +82,9 @@ typedef struct messagebuf_control_block {
 	size_t		head;			/* 最初のメッセージの格納場所 */
 	size_t		tail;			/* 最後のメッセージの格納場所の次 */
 	uint_t		smbfcnt;		/* 管理領域に格納されているメッセージの数 */
+#ifdef USE_OBJSTAT
+	OBJSTAT		objstat;		/* 統計情報ブロック */
+#endif /* USE_OBJSTAT */
 } MBFCB;
 
 /*
@@ -118,6 +118,62 @@
 #define MTXPROTO(p_mtxcb)		((p_mtxcb)->p_mtxinib->mtxatr & MTXPROTO_MASK)
 #define MTX_CEILING(p_mtxcb)	(MTXPROTO(p_mtxcb) == TA_CEILING)
 
+#ifdef USE_LOCK_ELISION
+/*
+ *  CPUロック状態にしないミューテックスのロック
+ *
+ *  優先度上限ミューテックスでないミューテックスに対して，タスク切換え
+ *  を保留してロックする．ミューテックスがロックされている場合には
+ *  falseを返し，呼出し元は，CPUロック状態で処理を行う．
+ */
+Inline bool_t
+loc_mtx_held(MTXCB *p_mtxcb)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if (p_mtxcb->p_loctsk == NULL) {
+		mutex_acquire(p_runtsk, p_mtxcb);
+		OBJSTAT_ACQUIRE(&(p_mtxcb->objstat), E_OK);
+		done = true;
+	}
+	else {
+		done = false;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+/*
+ *  CPUロック状態にしないミューテックスのロック解除
+ *
+ *  優先度上限ミューテックスでないミューテックスに対して，タスク切換え
+ *  を保留してロックを解除する．ロック解除の順序が誤っている場合と，待
+ *  ち行列にタスクがある場合にはfalseを返す．
+ */
+Inline bool_t
+unl_mtx_held(MTXCB *p_mtxcb)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if (p_mtxcb == p_runtsk->p_lastmtx
+						&& queue_empty(&(p_mtxcb->wait_queue))) {
+		p_runtsk->p_lastmtx = p_mtxcb->p_prevmtx;
+		p_mtxcb->p_loctsk = NULL;
+		UPDATE_SNPGEN();
+		OBJSTAT_OCCUPANCY(&(p_mtxcb->objstat), 0U, false);
+		done = true;
+	}
+	else {
+		done = false;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+#endif /* USE_LOCK_ELISION */
+
 /* 
  *  ミューテックス機能の初期化
  */
@@ -138,6 +194,7 @@ initialize_mutex(void)
 		queue_initialize(&(p_mtxcb->wait_queue));
 		p_mtxcb->p_mtxinib = &(mtxinib_table[i]);
 		p_mtxcb->p_loctsk = NULL;
+		OBJSTAT_INIT(&(p_mtxcb->objstat), 0U, false);
 	}
 }
 
@@ -260,6 +317,8 @@ mutex_acquire(TCB *p_tcb, MTXCB *p_mtxcb)
 	p_mtxcb->p_loctsk = p_tcb;
 	p_mtxcb->p_prevmtx = p_tcb->p_lastmtx;
 	p_tcb->p_lastmtx = p_mtxcb;
+	UPDATE_SNPGEN();
+	OBJSTAT_OCCUPANCY(&(p_mtxcb->objstat), 1U, true);
 	if (MTX_CEILING(p_mtxcb)
 					&& p_mtxcb->p_mtxinib->ceilpri < p_tcb->priority) {
 		change_priority(p_tcb, p_mtxcb->p_mtxinib->ceilpri, true);
@@ -280,6 +339,8 @@ mutex_release(MTXCB *p_mtxcb)
 
 	if (queue_empty(&(p_mtxcb->wait_queue))) {
 		p_mtxcb->p_loctsk = NULL;
+		UPDATE_SNPGEN();
+		OBJSTAT_OCCUPANCY(&(p_mtxcb->objstat), 0U, false);
 	}
 	else {
 		/*
@@ -336,10 +397,18 @@ loc_mtx(ID mtxid)
 
 	LOG_LOC_MTX_ENTER(mtxid);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_MTXID(mtxid));
 	p_mtxcb = get_mtxcb(mtxid);
 	CHECK_ACPTN(p_mtxcb->p_mtxinib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (!MTX_CEILING(p_mtxcb) && !p_runtsk->raster
+										&& loc_mtx_held(p_mtxcb)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -363,9 +432,12 @@ loc_mtx(ID mtxid)
 	else {
 		wobj_make_wait((WOBJCB *) p_mtxcb, TS_WAITING_MTX,
 											(WINFO_WOBJ *) &winfo_mtx);
+		OBJSTAT_WAIT(&(p_mtxcb->objstat), &(p_mtxcb->wait_queue));
 		dispatch();
 		ercd = winfo_mtx.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_mtxcb->objstat), ercd);
 	}
+	OBJSTAT_ACQUIRE(&(p_mtxcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -392,6 +464,12 @@ ploc_mtx(ID mtxid)
 	p_mtxcb = get_mtxcb(mtxid);
 	CHECK_ACPTN(p_mtxcb->p_mtxinib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (!MTX_CEILING(p_mtxcb) && loc_mtx_held(p_mtxcb)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (MTX_CEILING(p_mtxcb)
 				&& p_runtsk->bpriority < p_mtxcb->p_mtxinib->ceilpri) {
@@ -412,6 +490,7 @@ ploc_mtx(ID mtxid)
 	else {
 		ercd = E_TMOUT;
 	}
+	OBJSTAT_ACQUIRE(&(p_mtxcb->objstat), ercd);
 	unlock_cpu();
 
   error_exit:
@@ -436,11 +515,19 @@ tloc_mtx(ID mtxid, TMO tmout)
 
 	LOG_TLOC_MTX_ENTER(mtxid, tmout);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_MTXID(mtxid));
 	CHECK_PAR(VALID_TMOUT(tmout));
 	p_mtxcb = get_mtxcb(mtxid);
 	CHECK_ACPTN(p_mtxcb->p_mtxinib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (!MTX_CEILING(p_mtxcb) && !p_runtsk->raster
+										&& loc_mtx_held(p_mtxcb)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -467,9 +554,12 @@ tloc_mtx(ID mtxid, TMO tmout)
 	else {
 		wobj_make_wait_tmout((WOBJCB *) p_mtxcb, TS_WAITING_MTX,
 								(WINFO_WOBJ *) &winfo_mtx, &tmevtb, tmout);
+		OBJSTAT_WAIT(&(p_mtxcb->objstat), &(p_mtxcb->wait_queue));
 		dispatch();
 		ercd = winfo_mtx.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_mtxcb->objstat), ercd);
 	}
+	OBJSTAT_ACQUIRE(&(p_mtxcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -496,6 +586,12 @@ unl_mtx(ID mtxid)
 	p_mtxcb = get_mtxcb(mtxid);
 	CHECK_ACPTN(p_mtxcb->p_mtxinib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (!MTX_CEILING(p_mtxcb) && unl_mtx_held(p_mtxcb)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (p_mtxcb != p_runtsk->p_lastmtx) {
 		ercd = E_OBJ;
@@ -541,6 +637,8 @@ ini_mtx(ID mtxid)
 	p_loctsk = p_mtxcb->p_loctsk;
 	if (p_loctsk != NULL) {
 		p_mtxcb->p_loctsk = NULL;
+		UPDATE_SNPGEN();
+		OBJSTAT_OCCUPANCY(&(p_mtxcb->objstat), 0U, false);
 		pp_prevmtx = &(p_loctsk->p_lastmtx);
 		while (*pp_prevmtx != NULL) {
 			if (*pp_prevmtx == p_mtxcb) {
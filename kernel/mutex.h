@@ -48,6 +48,7 @@
 #include "kernel_impl.h"
 #include <queue.h>
 #include "wait.h"
+#include "objstat.h"
 
 /*
  *  ミューテックス初期化ブロック
@@ -74,6 +75,9 @@ struct mutex_control_block {
 	const MTXINIB *p_mtxinib;	/* 初期化ブロックへのポインタ */
 	TCB			*p_loctsk;		/* ミューテックスをロックしているタスク */
 	MTXCB		*p_prevmtx;		/* この前にロックしたミューテックス */
+#ifdef USE_OBJSTAT
+	OBJSTAT		objstat;		/* 統計情報ブロック */
+#endif /* USE_OBJSTAT */
 };
 
 /*
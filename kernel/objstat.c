@@ -0,0 +1,267 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		同期・通信オブジェクトの統計情報
+ */
+
+#include "kernel_impl.h"
+#include "check.h"
+#include "task.h"
+#include "objstat.h"
+#include "semaphore.h"
+#include "eventflag.h"
+#include "dataqueue.h"
+#include "mutex.h"
+#include "messagebuf.h"
+#include "mempfix.h"
+
+/*
+ *  トレースログマクロのデフォルト定義
+ */
+#ifndef LOG_REF_OST_ENTER
+#define LOG_REF_OST_ENTER(objtyp, objid, num, pk_rost)
+#endif /* LOG_REF_OST_ENTER */
+
+#ifndef LOG_REF_OST_LEAVE
+#define LOG_REF_OST_LEAVE(ercd, pk_rost)
+#endif /* LOG_REF_OST_LEAVE */
+
+#ifdef USE_OBJSTAT
+
+/*
+ *  統計情報ブロックの初期化
+ */
+#ifdef TOPPERS_ostini
+
+void
+objstat_initialize(OBJSTAT *p_objstat, uint_t occ, bool_t full)
+{
+	p_objstat->acqcnt = 0U;
+	p_objstat->wtcnt = 0U;
+	p_objstat->tmocnt = 0U;
+	p_objstat->maxwtcnt = 0U;
+	p_objstat->maxwttim = 0U;
+	p_objstat->ttlwttim = 0U;
+	p_objstat->maxocc = occ;
+	p_objstat->occstat = full ? OCCSTAT_FULL
+					: ((occ == 0U) ? OCCSTAT_EMPTY : OCCSTAT_NORMAL);
+	p_objstat->occtim = target_hrt_get_current();
+	p_objstat->ttlfultim = 0U;
+	p_objstat->ttlemptim = 0U;
+}
+
+#endif /* TOPPERS_ostini */
+
+/*
+ *  待ち解除された時の記録
+ */
+#ifdef TOPPERS_ostwai
+
+void
+objstat_wait_end(OBJSTAT *p_objstat, ER ercd)
+{
+	RELTIM	wttim;
+
+	wttim = (RELTIM) objstat_elapsed(p_runtsk->wsttim,
+										target_hrt_get_current());
+	p_objstat->ttlwttim += wttim;
+	if (wttim > p_objstat->maxwttim) {
+		p_objstat->maxwttim = wttim;
+	}
+	if (ercd == E_TMOUT) {
+		p_objstat->tmocnt += 1U;
+	}
+}
+
+#endif /* TOPPERS_ostwai */
+
+/*
+ *  使用量の状態の変化の記録
+ */
+#ifdef TOPPERS_ostchg
+
+void
+objstat_change(OBJSTAT *p_objstat, uint_t occstat)
+{
+	HRTCNT	hrtcnt = target_hrt_get_current();
+
+	if (p_objstat->occstat == OCCSTAT_FULL) {
+		p_objstat->ttlfultim += objstat_elapsed(p_objstat->occtim, hrtcnt);
+	}
+	else if (p_objstat->occstat == OCCSTAT_EMPTY) {
+		p_objstat->ttlemptim += objstat_elapsed(p_objstat->occtim, hrtcnt);
+	}
+	p_objstat->occstat = occstat;
+	p_objstat->occtim = hrtcnt;
+}
+
+#endif /* TOPPERS_ostchg */
+#endif /* USE_OBJSTAT */
+
+/*
+ *  統計情報の参照
+ *
+ *  objtypで指定される種類の，objidからnum個のオブジェクトの統計情報を，
+ *  pk_rostから始まる配列に格納し，格納した数を返す．IDの最大値を超え
+ *  る分は格納しない．満杯または空である時間は，参照した時点までを含め
+ *  る．そのため，高分解能タイマが一周するより短い間隔で参照すれば，そ
+ *  れより長く満杯または空の状態が続いても正しく累計される．
+ *
+ *  オブジェクト毎にCPUロック状態とするため，複数のオブジェクトの統計
+ *  情報は同じ時点のものとは限らない．
+ */
+#ifdef TOPPERS_ref_ost
+#ifdef USE_OBJSTAT
+
+/*
+ *  統計情報ブロックとアクセス許可ベクタの取出し
+ *
+ *  objidが範囲外の場合はNULLを返す．
+ */
+static OBJSTAT *
+get_objstat(uint_t objtyp, ID objid, const ACVCT **pp_acvct)
+{
+	SEMCB	*p_semcb;
+	FLGCB	*p_flgcb;
+	DTQCB	*p_dtqcb;
+	MTXCB	*p_mtxcb;
+	MBFCB	*p_mbfcb;
+	MPFCB	*p_mpfcb;
+
+	switch (objtyp) {
+	case TOBJ_SEM:
+		if (!VALID_SEMID(objid)) {
+			return(NULL);
+		}
+		p_semcb = &(semcb_table[objid - TMIN_SEMID]);
+		*pp_acvct = &(p_semcb->p_seminib->acvct);
+		return(&(p_semcb->objstat));
+	case TOBJ_FLG:
+		if (!VALID_FLGID(objid)) {
+			return(NULL);
+		}
+		p_flgcb = &(flgcb_table[objid - TMIN_FLGID]);
+		*pp_acvct = &(p_flgcb->p_flginib->acvct);
+		return(&(p_flgcb->objstat));
+	case TOBJ_DTQ:
+		if (!VALID_DTQID(objid)) {
+			return(NULL);
+		}
+		p_dtqcb = &(dtqcb_table[objid - TMIN_DTQID]);
+		*pp_acvct = &(p_dtqcb->p_dtqinib->acvct);
+		return(&(p_dtqcb->objstat));
+	case TOBJ_MTX:
+		if (!VALID_MTXID(objid)) {
+			return(NULL);
+		}
+		p_mtxcb = &(mtxcb_table[objid - TMIN_MTXID]);
+		*pp_acvct = &(p_mtxcb->p_mtxinib->acvct);
+		return(&(p_mtxcb->objstat));
+	case TOBJ_MBF:
+		if (!VALID_MBFID(objid)) {
+			return(NULL);
+		}
+		p_mbfcb = &(mbfcb_table[objid - TMIN_MBFID]);
+		*pp_acvct = &(p_mbfcb->p_mbfinib->acvct);
+		return(&(p_mbfcb->objstat));
+	case TOBJ_MPF:
+		if (!VALID_MPFID(objid)) {
+			return(NULL);
+		}
+		p_mpfcb = &(mpfcb_table[objid - TMIN_MPFID]);
+		*pp_acvct = &(p_mpfcb->p_mpfinib->acvct);
+		return(&(p_mpfcb->objstat));
+	default:
+		return(NULL);
+	}
+}
+
+#endif /* USE_OBJSTAT */
+
+ER_UINT
+ref_ost(uint_t objtyp, ID objid, uint_t num, T_ROST *pk_rost)
+{
+#ifdef USE_OBJSTAT
+	OBJSTAT		*p_objstat;
+	const ACVCT	*p_acvct;
+	uint_t		cnt, i;
+#endif /* USE_OBJSTAT */
+	ER_UINT		ercd;
+
+	LOG_REF_OST_ENTER(objtyp, objid, num, pk_rost);
+	CHECK_TSKCTX_UNL();
+#ifdef USE_OBJSTAT
+	CHECK_PAR(TOBJ_SEM <= objtyp && objtyp <= TOBJ_MPF && num > 0U);
+	CHECK_ID(get_objstat(objtyp, objid, &p_acvct) != NULL);
+	for (cnt = 0U; cnt < num; cnt++) {
+		p_objstat = get_objstat(objtyp, objid + (ID) cnt, &p_acvct);
+		if (p_objstat == NULL) {
+			break;
+		}
+		CHECK_ACPTN(p_acvct->acptn4);
+	}
+	CHECK_MACV_BUF_WRITE(pk_rost, sizeof(T_ROST) * cnt);
+
+	for (i = 0U; i < cnt; i++) {
+		p_objstat = get_objstat(objtyp, objid + (ID) i, &p_acvct);
+		lock_cpu();
+		objstat_change(p_objstat, p_objstat->occstat);
+		pk_rost[i].acqcnt = p_objstat->acqcnt;
+		pk_rost[i].wtcnt = p_objstat->wtcnt;
+		pk_rost[i].tmocnt = p_objstat->tmocnt;
+		pk_rost[i].maxwtcnt = p_objstat->maxwtcnt;
+		pk_rost[i].maxwttim = p_objstat->maxwttim;
+		pk_rost[i].ttlwttim = p_objstat->ttlwttim;
+		pk_rost[i].maxocc = p_objstat->maxocc;
+		pk_rost[i].ttlfultim = p_objstat->ttlfultim;
+		pk_rost[i].ttlemptim = p_objstat->ttlemptim;
+		unlock_cpu();
+	}
+	ercd = (ER_UINT) cnt;
+#else /* USE_OBJSTAT */
+	ercd = E_NOSPT;
+#endif /* USE_OBJSTAT */
+
+  error_exit:
+	LOG_REF_OST_LEAVE(ercd, pk_rost);
+	return(ercd);
+}
+
+#endif /* TOPPERS_ref_ost */
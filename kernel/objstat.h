@@ -0,0 +1,210 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		同期・通信オブジェクトの統計情報
+ *
+ *  USE_OBJSTATをマクロ定義すると，セマフォ，イベントフラグ，データキュー，
+ *  ミューテックス，メッセージバッファ，固定長メモリプールの管理ブロッ
+ *  クに統計情報ブロック（OBJSTAT）を追加し，競合と使用量に関する統計
+ *  情報を記録する．統計情報の更新は，すべてCPUロック状態で行う．時間
+ *  は高分解能タイマで計測する．
+ *
+ *  USE_OBJSTATをマクロ定義しない場合，OBJSTAT_で始まるマクロは何もし
+ *  ない．
+ */
+
+#ifndef TOPPERS_OBJSTAT_H
+#define TOPPERS_OBJSTAT_H
+
+#include "kernel_impl.h"
+#include <queue.h>
+#include "task.h"
+#include "time_event.h"
+
+#ifdef USE_OBJSTAT
+
+/*
+ *  使用量の状態
+ */
+#define OCCSTAT_NORMAL	0U			/* 満杯でも空でもない */
+#define OCCSTAT_FULL	1U			/* 満杯 */
+#define OCCSTAT_EMPTY	2U			/* 空 */
+
+/*
+ *  統計情報ブロック
+ *
+ *  acqcntは，資源の獲得，ミューテックスのロック，イベントフラグ待ち，
+ *  データの受信，メッセージの受信，メモリブロックの獲得に成功した回数
+ *  である．wtcntとtmocntは，待ち状態に入った回数と，そのうちタイムア
+ *  ウトした回数である．データキューとメッセージバッファでは，送信待ち
+ *  と受信待ちの両方を数える．
+ *
+ *  使用量は，セマフォでは獲得されている資源の数，データキューでは格
+ *  納されているデータの数，メッセージバッファでは使用中の管理領域のバ
+ *  イト数，固定長メモリプールでは割り付けられているメモリブロックの数
+ *  とする．使用量の状態が変化した時点で，それまでの状態にあった時間を
+ *  ttlfultimかttlemptimに加える．
+ */
+typedef struct object_statistics_block {
+	ulong_t		acqcnt;			/* 獲得に成功した回数 */
+	ulong_t		wtcnt;			/* 待ち状態に入った回数 */
+	ulong_t		tmocnt;			/* 待ちがタイムアウトした回数 */
+	uint_t		maxwtcnt;		/* 待ちタスク数の最大値 */
+	RELTIM		maxwttim;		/* 待ち時間の最大値 */
+	SYSTIM		ttlwttim;		/* 待ち時間の累計 */
+	uint_t		maxocc;			/* 使用量の最大値 */
+	uint_t		occstat;		/* 使用量の状態 */
+	HRTCNT		occtim;			/* 使用量の状態が変化した時刻 */
+	SYSTIM		ttlfultim;		/* 満杯であった時間の累計 */
+	SYSTIM		ttlemptim;		/* 空であった時間の累計 */
+} OBJSTAT;
+
+/*
+ *  高分解能タイマの2つの値の差
+ */
+Inline HRTCNT
+objstat_elapsed(HRTCNT from, HRTCNT to)
+{
+	HRTCNT	elapsed = to - from;
+
+#ifdef TCYC_HRTCNT
+	if (to < from) {
+		elapsed += TCYC_HRTCNT;
+	}
+#endif /* TCYC_HRTCNT */
+	return(elapsed);
+}
+
+/*
+ *  統計情報ブロックの初期化
+ *
+ *  occは使用量の初期値，fullはその時に満杯であるかを示す．
+ */
+extern void	objstat_initialize(OBJSTAT *p_objstat, uint_t occ, bool_t full);
+
+/*
+ *  待ち状態に入る時の記録
+ *
+ *  実行中のタスクをp_wait_queueにつないだ後に呼び出す．待ちタスク数の
+ *  最大値を求めるために待ちキューをたどるため，待ちタスク数に比例した
+ *  時間がかかる．
+ */
+Inline void
+objstat_wait(OBJSTAT *p_objstat, QUEUE *p_wait_queue)
+{
+	QUEUE	*p_entry;
+	uint_t	wtcnt = 0U;
+
+	p_objstat->wtcnt += 1U;
+	for (p_entry = p_wait_queue->p_next; p_entry != p_wait_queue;
+										p_entry = p_entry->p_next) {
+		wtcnt += 1U;
+	}
+	if (wtcnt > p_objstat->maxwtcnt) {
+		p_objstat->maxwtcnt = wtcnt;
+	}
+	p_runtsk->wsttim = target_hrt_get_current();
+}
+
+/*
+ *  待ち解除された時の記録
+ *
+ *  待ち状態から戻った実行中のタスクが，待ち解除の返値ercdを渡して呼
+ *  び出す．
+ */
+extern void	objstat_wait_end(OBJSTAT *p_objstat, ER ercd);
+
+/*
+ *  使用量の状態の変化の記録
+ */
+extern void	objstat_change(OBJSTAT *p_objstat, uint_t occstat);
+
+/*
+ *  使用量の記録
+ *
+ *  使用量がoccに変化した時に呼び出す．fullは満杯であるかを示す．状態
+ *  が変化した場合にのみ，高分解能タイマを読む．
+ */
+Inline void
+objstat_occupancy(OBJSTAT *p_objstat, uint_t occ, bool_t full)
+{
+	uint_t	occstat;
+
+	if (occ > p_objstat->maxocc) {
+		p_objstat->maxocc = occ;
+	}
+	occstat = full ? OCCSTAT_FULL
+					: ((occ == 0U) ? OCCSTAT_EMPTY : OCCSTAT_NORMAL);
+	if (occstat != p_objstat->occstat) {
+		objstat_change(p_objstat, occstat);
+	}
+}
+
+/*
+ *  統計情報の記録のためのマクロ
+ *
+ *  OBJSTAT_ACQUIREは，獲得のサービスコールの返値がエラーでない場合に，
+ *  獲得に成功した回数を数える．メッセージバッファからの受信では，返値
+ *  は受信したメッセージのサイズとなる．
+ */
+#define OBJSTAT_INIT(p_objstat, occ, full) \
+								objstat_initialize(p_objstat, occ, full)
+#define OBJSTAT_WAIT(p_objstat, p_wait_queue) \
+								objstat_wait(p_objstat, p_wait_queue)
+#define OBJSTAT_WAIT_END(p_objstat, ercd) \
+								objstat_wait_end(p_objstat, ercd)
+#define OBJSTAT_ACQUIRE(p_objstat, ercd) do {				\
+	if ((ercd) >= E_OK) {									\
+		(p_objstat)->acqcnt += 1U;							\
+	}														\
+} while (false)
+#define OBJSTAT_OCCUPANCY(p_objstat, occ, full) \
+								objstat_occupancy(p_objstat, occ, full)
+
+#else /* USE_OBJSTAT */
+
+#define OBJSTAT_INIT(p_objstat, occ, full)
+#define OBJSTAT_WAIT(p_objstat, p_wait_queue)
+#define OBJSTAT_WAIT_END(p_objstat, ercd)
+#define OBJSTAT_ACQUIRE(p_objstat, ercd)
+#define OBJSTAT_OCCUPANCY(p_objstat, occ, full)
+
+#endif /* USE_OBJSTAT */
+#endif /* TOPPERS_OBJSTAT_H */
@@ -129,6 +129,58 @@
 #define INDEX_PDQ(pdqid)	((uint_t)((pdqid) - TMIN_PDQID))
 #define get_pdqcb(pdqid)	(&(pdqcb_table[INDEX_PDQ(pdqid)]))
 
+#ifdef USE_LOCK_ELISION
+/*
+ *  CPUロック状態にしない優先度データキューへの送信
+ *
+ *  TA_TSKCTX属性の優先度データキューに対して，タスク切換えを保留して
+ *  データを格納する．受信待ち行列にタスクがある場合と，優先度データキュー
+ *  管理領域に空きがない場合にはfalseを返す．
+ */
+Inline bool_t
+snd_pdq_held(PDQCB *p_pdqcb, intptr_t data, PRI datapri)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if (queue_empty(&(p_pdqcb->rwait_queue))
+				&& p_pdqcb->count < p_pdqcb->p_pdqinib->pdqcnt) {
+		enqueue_pridata(p_pdqcb, data, datapri);
+		done = true;
+	}
+	else {
+		done = false;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+/*
+ *  CPUロック状態にしない優先度データキューからの受信
+ *
+ *  TA_TSKCTX属性の優先度データキューに対して，タスク切換えを保留して
+ *  データを取り出す．送信待ち行列にタスクがある場合と，優先度データキュー
+ *  管理領域にデータがない場合にはfalseを返す．
+ */
+Inline bool_t
+rcv_pdq_held(PDQCB *p_pdqcb, intptr_t *p_data, PRI *p_datapri)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if (p_pdqcb->count > 0U && queue_empty(&(p_pdqcb->swait_queue))) {
+		dequeue_pridata(p_pdqcb, p_data, p_datapri);
+		done = true;
+	}
+	else {
+		done = false;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+#endif /* USE_LOCK_ELISION */
+
 /*
  *  優先度データキュー機能の初期化
  */
@@ -293,11 +345,19 @@ snd_pdq(ID pdqid, intptr_t data, PRI datapri)
 
 	LOG_SND_PDQ_ENTER(pdqid, data, datapri);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_PDQID(pdqid));
 	p_pdqcb = get_pdqcb(pdqid);
 	CHECK_ACPTN(p_pdqcb->p_pdqinib->acvct.acptn1);
 	CHECK_PAR(TMIN_DPRI <= datapri && datapri <= p_pdqcb->p_pdqinib->maxdpri);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_pdqcb->p_pdqinib->pdqatr) && !p_runtsk->raster
+							&& snd_pdq_held(p_pdqcb, data, datapri)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -340,9 +400,19 @@ psnd_pdq(ID pdqid, intptr_t data, PRI datapri)
 	CHECK_UNL();
 	CHECK_ID(VALID_PDQID(pdqid));
 	p_pdqcb = get_pdqcb(pdqid);
+#ifdef USE_LOCK_ELISION
+	CHECK_CTX(!(sense_context() && TSKCTX_OBJ(p_pdqcb->p_pdqinib->pdqatr)));
+#endif /* USE_LOCK_ELISION */
 	CHECK_ACPTN(p_pdqcb->p_pdqinib->acvct.acptn1);
 	CHECK_PAR(TMIN_DPRI <= datapri && datapri <= p_pdqcb->p_pdqinib->maxdpri);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_pdqcb->p_pdqinib->pdqatr)
+							&& snd_pdq_held(p_pdqcb, data, datapri)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (send_pridata(p_pdqcb, data, datapri)) {
 		if (p_runtsk != p_schedtsk) {
@@ -382,12 +452,20 @@ tsnd_pdq(ID pdqid, intptr_t data, PRI datapri, TMO tmout)
 
 	LOG_TSND_PDQ_ENTER(pdqid, data, datapri, tmout);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_PDQID(pdqid));
 	CHECK_PAR(VALID_TMOUT(tmout));
 	p_pdqcb = get_pdqcb(pdqid);
 	CHECK_ACPTN(p_pdqcb->p_pdqinib->acvct.acptn1);
 	CHECK_PAR(TMIN_DPRI <= datapri && datapri <= p_pdqcb->p_pdqinib->maxdpri);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_pdqcb->p_pdqinib->pdqatr) && !p_runtsk->raster
+							&& snd_pdq_held(p_pdqcb, data, datapri)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -432,12 +510,20 @@ rcv_pdq(ID pdqid, intptr_t *p_data, PRI *p_datapri)
 
 	LOG_RCV_PDQ_ENTER(pdqid, p_data, p_datapri);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_PDQID(pdqid));
 	CHECK_MACV_WRITE(p_data, intptr_t);
 	CHECK_MACV_WRITE(p_datapri, PRI);
 	p_pdqcb = get_pdqcb(pdqid);
 	CHECK_ACPTN(p_pdqcb->p_pdqinib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_pdqcb->p_pdqinib->pdqatr) && !p_runtsk->raster
+						&& rcv_pdq_held(p_pdqcb, p_data, p_datapri)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
@@ -488,6 +574,13 @@ prcv_pdq(ID pdqid, intptr_t *p_data, PRI *p_datapri)
 	p_pdqcb = get_pdqcb(pdqid);
 	CHECK_ACPTN(p_pdqcb->p_pdqinib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_pdqcb->p_pdqinib->pdqatr)
+						&& rcv_pdq_held(p_pdqcb, p_data, p_datapri)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (receive_pridata(p_pdqcb, p_data, p_datapri)) {
 		if (p_runtsk != p_schedtsk) {
@@ -522,6 +615,7 @@ trcv_pdq(ID pdqid, intptr_t *p_data, PRI *p_datapri, TMO tmout)
 
 	LOG_TRCV_PDQ_ENTER(pdqid, p_data, p_datapri, tmout);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_PDQID(pdqid));
 	CHECK_MACV_WRITE(p_data, intptr_t);
 	CHECK_MACV_WRITE(p_datapri, PRI);
@@ -529,6 +623,13 @@ trcv_pdq(ID pdqid, intptr_t *p_data, PRI *p_datapri, TMO tmout)
 	p_pdqcb = get_pdqcb(pdqid);
 	CHECK_ACPTN(p_pdqcb->p_pdqinib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_pdqcb->p_pdqinib->pdqatr) && !p_runtsk->raster
+						&& rcv_pdq_held(p_pdqcb, p_data, p_datapri)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
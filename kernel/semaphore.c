@@ -112,6 +112,74 @@
 #define INDEX_SEM(semid)	((uint_t)((semid) - TMIN_SEMID))
 #define get_semcb(semid)	(&(semcb_table[INDEX_SEM(semid)]))
 
+/*
+ *  セマフォの使用量（獲得されている資源の数）の記録
+ */
+#define SEM_OCCUPANCY(p_semcb)										\
+		OBJSTAT_OCCUPANCY(&((p_semcb)->objstat),					\
+					(p_semcb)->p_seminib->maxsem - (p_semcb)->semcnt,	\
+					(p_semcb)->semcnt == 0U)
+
+#ifdef USE_LOCK_ELISION
+/*
+ *  CPUロック状態にしないセマフォ資源の返却
+ *
+ *  TA_TSKCTX属性のセマフォに対して，タスク切換えを保留して資源を返却
+ *  する．待ち行列にタスクがある場合にはfalseを返し，呼出し元は，CPUロッ
+ *  ク状態で待ち解除を行う．
+ */
+Inline bool_t
+sig_sem_held(SEMCB *p_semcb, ER *p_ercd)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if (!queue_empty(&(p_semcb->wait_queue))) {
+		done = false;
+	}
+	else if (p_semcb->semcnt < p_semcb->p_seminib->maxsem) {
+		p_semcb->semcnt += 1;
+		UPDATE_SNPGEN();
+		SEM_OCCUPANCY(p_semcb);
+		*p_ercd = E_OK;
+		done = true;
+	}
+	else {
+		*p_ercd = E_QOVR;
+		done = true;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+/*
+ *  CPUロック状態にしないセマフォ資源の獲得
+ *
+ *  TA_TSKCTX属性のセマフォに対して，タスク切換えを保留して資源を獲得
+ *  する．資源がない場合にはfalseを返す．
+ */
+Inline bool_t
+wai_sem_held(SEMCB *p_semcb)
+{
+	bool_t	held, done;
+
+	held = begin_dsp_hold();
+	if (p_semcb->semcnt >= 1) {
+		p_semcb->semcnt -= 1;
+		UPDATE_SNPGEN();
+		SEM_OCCUPANCY(p_semcb);
+		OBJSTAT_ACQUIRE(&(p_semcb->objstat), E_OK);
+		done = true;
+	}
+	else {
+		done = false;
+	}
+	end_dsp_hold(held);
+	return(done);
+}
+
+#endif /* USE_LOCK_ELISION */
+
 /* 
  *  セマフォ機能の初期化
  */
@@ -128,6 +196,9 @@ initialize_semaphore(void)
 		queue_initialize(&(p_semcb->wait_queue));
 		p_semcb->p_seminib = &(seminib_table[i]);
 		p_semcb->semcnt = p_semcb->p_seminib->isemcnt;
+		OBJSTAT_INIT(&(p_semcb->objstat),
+					p_semcb->p_seminib->maxsem - p_semcb->semcnt,
+					p_semcb->semcnt == 0U);
 	}
 }
 
@@ -149,8 +220,17 @@ sig_sem(ID semid)
 	CHECK_UNL();
 	CHECK_ID(VALID_SEMID(semid));
 	p_semcb = get_semcb(semid);
+#ifdef USE_LOCK_ELISION
+	CHECK_CTX(!(sense_context() && TSKCTX_OBJ(p_semcb->p_seminib->sematr)));
+#endif /* USE_LOCK_ELISION */
 	CHECK_ACPTN(p_semcb->p_seminib->acvct.acptn1);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_semcb->p_seminib->sematr)
+							&& sig_sem_held(p_semcb, &ercd)) {
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (!queue_empty(&(p_semcb->wait_queue))) {
 		p_tcb = (TCB *) queue_delete_next(&(p_semcb->wait_queue));
@@ -167,6 +247,8 @@ sig_sem(ID semid)
 	}
 	else if (p_semcb->semcnt < p_semcb->p_seminib->maxsem) {
 		p_semcb->semcnt += 1;
+		UPDATE_SNPGEN();
+		SEM_OCCUPANCY(p_semcb);
 		ercd = E_OK;
 	}
 	else {
@@ -181,6 +263,34 @@ sig_sem(ID semid)
 
 #endif /* TOPPERS_sig_sem */
 
+/*
+ *  タイムイベントの通知処理によるセマフォ資源の返却
+ */
+#ifdef TOPPERS_nfysig
+
+ER
+nfy_sig_sem(SEMCB *p_semcb)
+{
+	TCB		*p_tcb;
+
+	if (!queue_empty(&(p_semcb->wait_queue))) {
+		p_tcb = (TCB *) queue_delete_next(&(p_semcb->wait_queue));
+		wait_complete(p_tcb);
+		return(E_OK);
+	}
+	else if (p_semcb->semcnt < p_semcb->p_seminib->maxsem) {
+		p_semcb->semcnt += 1;
+		UPDATE_SNPGEN();
+		SEM_OCCUPANCY(p_semcb);
+		return(E_OK);
+	}
+	else {
+		return(E_QOVR);
+	}
+}
+
+#endif /* TOPPERS_nfysig */
+
 /*
  *  セマフォ資源の獲得
  */
@@ -195,24 +305,37 @@ wai_sem(ID semid)
 
 	LOG_WAI_SEM_ENTER(semid);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_SEMID(semid));
 	p_semcb = get_semcb(semid);
 	CHECK_ACPTN(p_semcb->p_seminib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_semcb->p_seminib->sematr) && !p_runtsk->raster
+										&& wai_sem_held(p_semcb)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
 	}
 	else if (p_semcb->semcnt >= 1) {
 		p_semcb->semcnt -= 1;
+		UPDATE_SNPGEN();
+		SEM_OCCUPANCY(p_semcb);
 		ercd = E_OK;
 	}
 	else {
 		wobj_make_wait((WOBJCB *) p_semcb, TS_WAITING_SEM,
 				 							(WINFO_WOBJ *) &winfo_sem);
+		OBJSTAT_WAIT(&(p_semcb->objstat), &(p_semcb->wait_queue));
 		dispatch();
 		ercd = winfo_sem.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_semcb->objstat), ercd);
 	}
+	OBJSTAT_ACQUIRE(&(p_semcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -239,14 +362,23 @@ pol_sem(ID semid)
 	p_semcb = get_semcb(semid);
 	CHECK_ACPTN(p_semcb->p_seminib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_semcb->p_seminib->sematr) && wai_sem_held(p_semcb)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu();
 	if (p_semcb->semcnt >= 1) {
 		p_semcb->semcnt -= 1;
+		UPDATE_SNPGEN();
+		SEM_OCCUPANCY(p_semcb);
 		ercd = E_OK;
 	}
 	else {
 		ercd = E_TMOUT;
 	}
+	OBJSTAT_ACQUIRE(&(p_semcb->objstat), ercd);
 	unlock_cpu();
 
   error_exit:
@@ -271,17 +403,27 @@ twai_sem(ID semid, TMO tmout)
 
 	LOG_TWAI_SEM_ENTER(semid, tmout);
 	CHECK_DISPATCH();
+	CHECK_NONRSTR_CALLER();
 	CHECK_ID(VALID_SEMID(semid));
 	CHECK_PAR(VALID_TMOUT(tmout));
 	p_semcb = get_semcb(semid);
 	CHECK_ACPTN(p_semcb->p_seminib->acvct.acptn2);
 
+#ifdef USE_LOCK_ELISION
+	if (TSKCTX_OBJ(p_semcb->p_seminib->sematr) && !p_runtsk->raster
+										&& wai_sem_held(p_semcb)) {
+		ercd = E_OK;
+		goto error_exit;
+	}
+#endif /* USE_LOCK_ELISION */
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
 		ercd = E_RASTER;
 	}
 	else if (p_semcb->semcnt >= 1) {
 		p_semcb->semcnt -= 1;
+		UPDATE_SNPGEN();
+		SEM_OCCUPANCY(p_semcb);
 		ercd = E_OK;
 	}
 	else if (tmout == TMO_POL) {
@@ -290,9 +432,12 @@ twai_sem(ID semid, TMO tmout)
 	else {
 		wobj_make_wait_tmout((WOBJCB *) p_semcb, TS_WAITING_SEM,
 								(WINFO_WOBJ *) &winfo_sem, &tmevtb, tmout);
+		OBJSTAT_WAIT(&(p_semcb->objstat), &(p_semcb->wait_queue));
 		dispatch();
 		ercd = winfo_sem.winfo.wercd;
+		OBJSTAT_WAIT_END(&(p_semcb->objstat), ercd);
 	}
+	OBJSTAT_ACQUIRE(&(p_semcb->objstat), ercd);
 	unlock_cpu_dsp();
 
   error_exit:
@@ -322,6 +467,8 @@ ini_sem(ID semid)
 	lock_cpu();
 	init_wait_queue(&(p_semcb->wait_queue));
 	p_semcb->semcnt = p_semcb->p_seminib->isemcnt;
+	UPDATE_SNPGEN();
+	SEM_OCCUPANCY(p_semcb);
 	if (p_runtsk != p_schedtsk) {
 		dispatch();
 	}
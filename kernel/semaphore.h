@@ -50,6 +50,7 @@
 #include "kernel_impl.h"
 #include <queue.h>
 #include "wait.h"
+#include "objstat.h"
 
 /*
  *  セマフォ初期化ブロック
@@ -76,6 +77,9 @@ typedef struct semaphore_control_block {
 	QUEUE		wait_queue;		/* セマフォ待ちキュー */
 	const SEMINIB *p_seminib;	/* 初期化ブロックへのポインタ */
 	uint_t		semcnt;			/* セマフォ現在カウント値 */
+#ifdef USE_OBJSTAT
+	OBJSTAT		objstat;		/* 統計情報ブロック */
+#endif /* USE_OBJSTAT */
 } SEMCB;
 
 /*
@@ -115,4 +119,12 @@ extern SEMCB	semcb_table[];
  */
 extern void	initialize_semaphore(void);
 
+/*
+ *  タイムイベントの通知処理によるセマフォ資源の返却
+ *
+ *  コンフィギュレータが生成する通知ハンドラから，CPUロック状態で呼び
+ *  出される．
+ */
+extern ER	nfy_sig_sem(SEMCB *p_semcb);
+
 #endif /* TOPPERS_SEMAPHORE_H */
@@ -0,0 +1,275 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		スナップショット機能
+ */
+
+#include "kernel_impl.h"
+#include "check.h"
+#include "task.h"
+#include "wait.h"
+#include "snapshot.h"
+#include "semaphore.h"
+#include "eventflag.h"
+#include "dataqueue.h"
+#include "mutex.h"
+#include "messagebuf.h"
+#include "mempfix.h"
+
+/*
+ *  トレースログマクロのデフォルト定義
+ */
+#ifndef LOG_REF_SNP_ENTER
+#define LOG_REF_SNP_ENTER(objtyp, objid, num, pk_rsnp, p_snpgen)
+#endif /* LOG_REF_SNP_ENTER */
+
+#ifndef LOG_REF_SNP_LEAVE
+#define LOG_REF_SNP_LEAVE(ercd, pk_rsnp, p_snpgen)
+#endif /* LOG_REF_SNP_LEAVE */
+
+/*
+ *  状態変化の世代番号
+ */
+#ifdef TOPPERS_snpgen
+#ifdef USE_SNAPSHOT
+
+uint_t	snpgen;
+
+#endif /* USE_SNAPSHOT */
+#endif /* TOPPERS_snpgen */
+
+/*
+ *  タスクと同期・通信オブジェクトの状態のスナップショット
+ *
+ *  IDがobjidから始まる最大num個のオブジェクトの状態を，SNAPSHOT_SLICE
+ *  個ずつCPUロック区間に分けて取り出す．CPUロック区間の間で世代番号が
+ *  変化した場合には，最初から取り出し直す．SNAPSHOT_RETRY回やり直して
+ *  も一貫した状態が得られない場合には，E_OBJエラーとする．
+ */
+#ifdef TOPPERS_ref_snp
+#ifdef USE_SNAPSHOT
+
+/*
+ *  オブジェクト種別毎の状態の格納領域のサイズ
+ */
+static const size_t snapshot_size[] = {
+	sizeof(T_RSEM), sizeof(T_RFLG), sizeof(T_RDTQ), sizeof(T_RMTX),
+	sizeof(T_RMBF), sizeof(T_RMPF), sizeof(T_RTSK)
+};
+
+/*
+ *  アクセス許可ベクタの取出し
+ *
+ *  objidが範囲外の場合はNULLを返す．
+ */
+static const ACVCT *
+get_snapshot_acvct(uint_t objtyp, ID objid)
+{
+	switch (objtyp) {
+	case TOBJ_SEM:
+		if (!VALID_SEMID(objid)) {
+			return(NULL);
+		}
+		return(&(semcb_table[objid - TMIN_SEMID].p_seminib->acvct));
+	case TOBJ_FLG:
+		if (!VALID_FLGID(objid)) {
+			return(NULL);
+		}
+		return(&(flgcb_table[objid - TMIN_FLGID].p_flginib->acvct));
+	case TOBJ_DTQ:
+		if (!VALID_DTQID(objid)) {
+			return(NULL);
+		}
+		return(&(dtqcb_table[objid - TMIN_DTQID].p_dtqinib->acvct));
+	case TOBJ_MTX:
+		if (!VALID_MTXID(objid)) {
+			return(NULL);
+		}
+		return(&(mtxcb_table[objid - TMIN_MTXID].p_mtxinib->acvct));
+	case TOBJ_MBF:
+		if (!VALID_MBFID(objid)) {
+			return(NULL);
+		}
+		return(&(mbfcb_table[objid - TMIN_MBFID].p_mbfinib->acvct));
+	case TOBJ_MPF:
+		if (!VALID_MPFID(objid)) {
+			return(NULL);
+		}
+		return(&(mpfcb_table[objid - TMIN_MPFID].p_mpfinib->acvct));
+	case TOBJ_TSK:
+		if (!VALID_TSKID(objid)) {
+			return(NULL);
+		}
+		return(&(get_tcb(objid)->p_tinib->acvct));
+	default:
+		return(NULL);
+	}
+}
+
+/*
+ *  1つのオブジェクトの状態の取出し
+ *
+ *  objidで指定されるオブジェクトの状態を，pk_rsnpで指定される配列の
+ *  idx番目の要素に取り出す．CPUロック状態で呼び出される．
+ */
+static void
+refer_snapshot(uint_t objtyp, ID objid, void *pk_rsnp, uint_t idx)
+{
+	SEMCB	*p_semcb;
+	FLGCB	*p_flgcb;
+	DTQCB	*p_dtqcb;
+	MTXCB	*p_mtxcb;
+	MBFCB	*p_mbfcb;
+	MPFCB	*p_mpfcb;
+	T_RSEM	*pk_rsem;
+	T_RFLG	*pk_rflg;
+	T_RDTQ	*pk_rdtq;
+	T_RMTX	*pk_rmtx;
+	T_RMBF	*pk_rmbf;
+	T_RMPF	*pk_rmpf;
+
+	switch (objtyp) {
+	case TOBJ_SEM:
+		p_semcb = &(semcb_table[objid - TMIN_SEMID]);
+		pk_rsem = &(((T_RSEM *) pk_rsnp)[idx]);
+		pk_rsem->wtskid = wait_tskid(&(p_semcb->wait_queue));
+		pk_rsem->semcnt = p_semcb->semcnt;
+		break;
+	case TOBJ_FLG:
+		p_flgcb = &(flgcb_table[objid - TMIN_FLGID]);
+		pk_rflg = &(((T_RFLG *) pk_rsnp)[idx]);
+		pk_rflg->wtskid = wait_tskid(&(p_flgcb->wait_queue));
+		pk_rflg->flgptn = p_flgcb->flgptn;
+		break;
+	case TOBJ_DTQ:
+		p_dtqcb = &(dtqcb_table[objid - TMIN_DTQID]);
+		pk_rdtq = &(((T_RDTQ *) pk_rsnp)[idx]);
+		pk_rdtq->stskid = wait_tskid(&(p_dtqcb->swait_queue));
+		pk_rdtq->rtskid = wait_tskid(&(p_dtqcb->rwait_queue));
+		pk_rdtq->sdtqcnt = p_dtqcb->count;
+		break;
+	case TOBJ_MTX:
+		p_mtxcb = &(mtxcb_table[objid - TMIN_MTXID]);
+		pk_rmtx = &(((T_RMTX *) pk_rsnp)[idx]);
+		pk_rmtx->htskid = (p_mtxcb->p_loctsk != NULL)
+								? TSKID(p_mtxcb->p_loctsk) : TSK_NONE;
+		pk_rmtx->wtskid = wait_tskid(&(p_mtxcb->wait_queue));
+		break;
+	case TOBJ_MBF:
+		p_mbfcb = &(mbfcb_table[objid - TMIN_MBFID]);
+		pk_rmbf = &(((T_RMBF *) pk_rsnp)[idx]);
+		pk_rmbf->stskid = wait_tskid(&(p_mbfcb->swait_queue));
+		pk_rmbf->rtskid = wait_tskid(&(p_mbfcb->rwait_queue));
+		pk_rmbf->smbfcnt = p_mbfcb->smbfcnt;
+		pk_rmbf->fmbfsz = p_mbfcb->fmbfsz;
+		break;
+	case TOBJ_MPF:
+		p_mpfcb = &(mpfcb_table[objid - TMIN_MPFID]);
+		pk_rmpf = &(((T_RMPF *) pk_rsnp)[idx]);
+		pk_rmpf->wtskid = wait_tskid(&(p_mpfcb->wait_queue));
+		pk_rmpf->fblkcnt = p_mpfcb->fblkcnt;
+		break;
+	default:
+		refer_task(get_tcb(objid), &(((T_RTSK *) pk_rsnp)[idx]));
+		break;
+	}
+}
+
+#endif /* USE_SNAPSHOT */
+
+ER_UINT
+ref_snp(uint_t objtyp, ID objid, uint_t num, void *pk_rsnp, uint_t *p_snpgen)
+{
+#ifdef USE_SNAPSHOT
+	const ACVCT	*p_acvct;
+	uint_t		cnt, i, retry, gen;
+#endif /* USE_SNAPSHOT */
+	ER_UINT		ercd;
+
+	LOG_REF_SNP_ENTER(objtyp, objid, num, pk_rsnp, p_snpgen);
+	CHECK_TSKCTX_UNL();
+#ifdef USE_SNAPSHOT
+	CHECK_PAR(TOBJ_SEM <= objtyp && objtyp <= TOBJ_TSK && num > 0U);
+	CHECK_ID(get_snapshot_acvct(objtyp, objid) != NULL);
+	for (cnt = 0U; cnt < num; cnt++) {
+		p_acvct = get_snapshot_acvct(objtyp, objid + (ID) cnt);
+		if (p_acvct == NULL) {
+			break;
+		}
+		CHECK_ACPTN(p_acvct->acptn4);
+	}
+	CHECK_MACV_BUF_WRITE(pk_rsnp, snapshot_size[objtyp - TOBJ_SEM] * cnt);
+	CHECK_MACV_WRITE(p_snpgen, uint_t);
+
+	ercd = E_OBJ;
+	lock_cpu();
+	for (retry = 0U; retry <= SNAPSHOT_RETRY; retry++) {
+		gen = snpgen;
+		for (i = 0U; i < cnt; i++) {
+			if (i > 0U && i % SNAPSHOT_SLICE == 0U) {
+				/*
+				 *  ここで割込みを受け付ける．
+				 */
+				unlock_cpu();
+				delay_for_interrupt();
+				lock_cpu();
+				if (snpgen != gen) {
+					break;
+				}
+			}
+			refer_snapshot(objtyp, objid + (ID) i, pk_rsnp, i);
+		}
+		if (i == cnt) {
+			*p_snpgen = gen;
+			ercd = (ER_UINT) cnt;
+			break;
+		}
+	}
+	unlock_cpu();
+#else /* USE_SNAPSHOT */
+	ercd = E_NOSPT;
+#endif /* USE_SNAPSHOT */
+
+  error_exit:
+	LOG_REF_SNP_LEAVE(ercd, pk_rsnp, p_snpgen);
+	return(ercd);
+}
+
+#endif /* TOPPERS_ref_snp */
@@ -0,0 +1,85 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		スナップショット機能
+ *
+ *  USE_SNAPSHOTをマクロ定義すると，タスクと同期・通信オブジェクトの参
+ *  照できる状態が変化する度に，状態変化の世代番号（snpgen）を更新する．
+ *  ref_snpは，複数のオブジェクトの状態を短いCPUロック区間に分けて取り
+ *  出し，その間に世代番号が変化していないことで，取り出した状態の一貫
+ *  性を確認する．
+ *
+ *  世代番号の更新は，状態を変化させるCPUロック区間の中で，少なくとも
+ *  1回行えばよい．USE_SNAPSHOTをマクロ定義しない場合，UPDATE_SNPGEN
+ *  は何もしない．
+ */
+
+#ifndef TOPPERS_SNAPSHOT_H
+#define TOPPERS_SNAPSHOT_H
+
+#ifdef USE_SNAPSHOT
+
+/*
+ *  ref_snpが1回のCPUロック区間で取り出すオブジェクトの数
+ */
+#ifndef SNAPSHOT_SLICE
+#define SNAPSHOT_SLICE		4U
+#endif /* SNAPSHOT_SLICE */
+
+/*
+ *  ref_snpが状態の取出しをやり直す回数の上限
+ */
+#ifndef SNAPSHOT_RETRY
+#define SNAPSHOT_RETRY		3U
+#endif /* SNAPSHOT_RETRY */
+
+/*
+ *  状態変化の世代番号
+ */
+extern uint_t	snpgen;
+
+#define UPDATE_SNPGEN()		(snpgen += 1U)
+
+#else /* USE_SNAPSHOT */
+
+#define UPDATE_SNPGEN()
+
+#endif /* USE_SNAPSHOT */
+#endif /* TOPPERS_SNAPSHOT_H */
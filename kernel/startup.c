@@ -46,6 +46,7 @@
 
 #include "kernel_impl.h"
 #include "check.h"
+#include "task.h"
 #include "memory.h"
 #include "time_event.h"
 #include <sil.h>
@@ -71,6 +72,13 @@
 
 #ifdef TOPPERS_sta_ker
 
+#ifdef TOPPERS_BOOT_PROFILE
+/*
+ *  カーネル起動時間の記録領域
+ */
+uint32_t	bootprof_table[TNUM_BOOTPROF];
+#endif /* TOPPERS_BOOT_PROFILE */
+
 /*
  *  カーネル動作状態フラグ
  *
@@ -79,6 +87,29 @@
  */
 bool_t	kerflg = false;
 
+#ifdef USE_STACK_WATERMARK
+/*
+ *  非タスクコンテキスト用のスタック領域のパターン埋め
+ *
+ *  sta_kerは非タスクコンテキスト用のスタック領域上で実行されるため，
+ *  使用中の部分を壊さないように，ローカル変数の番地からSTKFILL_MARGIN
+ *  だけ離れた番地より下を埋める．
+ */
+#ifndef STKFILL_MARGIN
+#define STKFILL_MARGIN		256U
+#endif /* STKFILL_MARGIN */
+
+static void
+fill_istack(void)
+{
+	char	*p_limit = ((char *) &p_limit) - STKFILL_MARGIN;
+
+	if ((char *) istk < p_limit && p_limit <= (char *) istk + istksz) {
+		stack_fill(istk, (size_t)(p_limit - (char *) istk));
+	}
+}
+#endif /* USE_STACK_WATERMARK */
+
 /*
  *  カーネルの起動
  */
@@ -87,17 +118,24 @@ sta_ker(void)
 {
 	uint_t	i;
 
+	BOOT_PROFILE(BOOTPROF_STA_KER);
+#ifdef USE_STACK_WATERMARK
+	fill_istack();
+#endif /* USE_STACK_WATERMARK */
+
 	/*
 	 *  TECSの初期化
 	 */
 #ifndef TOPPERS_OMIT_TECS
 	initialize_tecs();
 #endif /* TOPPERS_OMIT_TECS */
+	BOOT_PROFILE(BOOTPROF_TECS);
 
 	/*
 	 *  ターゲット依存の初期化
 	 */
 	target_initialize();
+	BOOT_PROFILE(BOOTPROF_TARGET);
 
 	/*
 	 *  各モジュールの初期化
@@ -106,15 +144,24 @@ sta_ker(void)
 	 *  する必要がある．
 	 */
 	initialize_memory();
+	BOOT_PROFILE(BOOTPROF_MEMORY);
 	initialize_tmevt();								/*［ASPD1061］*/
+	BOOT_PROFILE(BOOTPROF_TMEVT);
 	initialize_domain();
+	BOOT_PROFILE(BOOTPROF_DOMAIN);
 	initialize_object();
+	BOOT_PROFILE(BOOTPROF_OBJECT);
 
 	/*
 	 *  初期化ルーチンの実行
 	 */ 
 	for (i = 0; i < tnum_inirtn; i++) {
 		(*(inirtnb_table[i].inirtn))(inirtnb_table[i].exinf);
+#ifdef TOPPERS_BOOT_PROFILE
+		if (i < TNUM_BOOTPROF_INIRTN) {
+			BOOT_PROFILE(BOOTPROF_INIRTN(i));
+		}
+#endif /* TOPPERS_BOOT_PROFILE */
 	}
 
 	/*
@@ -127,6 +174,7 @@ sta_ker(void)
 	 *  カーネル動作の開始
 	 */
 	kerflg = true;
+	BOOT_PROFILE(BOOTPROF_START);
 	LOG_KER_ENTER();
 	start_dispatch();
 	assert(0);
@@ -71,8 +71,8 @@ const SVC svc_table[-TMIN_FNCD+1] = {
 	(SVC)(rel_wai),
 	(SVC)(no_support),
 	(SVC)(no_support),
-	(SVC)(no_support),
-	(SVC)(no_support),
+	(SVC)(chg_dln),
+	(SVC)(ref_stk),
 	(SVC)(no_support),
 	(SVC)(no_support),
 	(SVC)(sus_tsk),
@@ -240,6 +240,8 @@ const SVC svc_table[-TMIN_FNCD+1] = {
 	(SVC)(ref_alm),
 	(SVC)(no_support),
 	(SVC)(no_support),
+	(SVC)(ref_ost),
+	(SVC)(ref_snp),
 	(SVC)(no_support),
 	(SVC)(no_support),
 	(SVC)(no_support),
@@ -289,12 +291,10 @@ const SVC svc_table[-TMIN_FNCD+1] = {
 	(SVC)(no_support),
 	(SVC)(no_support),
 	(SVC)(no_support),
-	(SVC)(no_support),
-	(SVC)(no_support),
-	(SVC)(no_support),
-	(SVC)(no_support),
-	(SVC)(no_support),
-	(SVC)(no_support),
+	(SVC)(sig_chn),
+	(SVC)(wai_chn),
+	(SVC)(twai_chn),
+	(SVC)(ref_chn),
 	(SVC)(no_support),
 	(SVC)(no_support),
 	(SVC)(no_support),
@@ -198,6 +198,8 @@ rot_rdq(PRI tskpri)
 {
 	uint_t	pri;
 	bool_t	context;
+	SCHEDCB	*p_schedcb;
+	QUEUE	*p_queue;
 	ER		ercd;
 
 	LOG_ROT_RDQ_ENTER(tskpri);
@@ -215,16 +217,28 @@ rot_rdq(PRI tskpri)
 	}
 
 	lock_cpu();
-	rotate_ready_queue(pri, context ? &schedcb_kernel : p_runtsk->p_schedcb);
-	if (p_runtsk != p_schedtsk) {
-		if (!context) {
-			dispatch();
-		}
-		else {
-			request_dispatch_retint();
+	p_schedcb = context ? &schedcb_kernel : p_runtsk->p_schedcb;
+	p_queue = &(p_schedcb->ready_queue[pri]);
+	if (!queue_empty(p_queue) && (((TCB *)(p_queue->p_next))->p_tinib->tskatr
+														& TA_RSTR) != 0U) {
+		/*
+		 *  先頭の制約タスクは実行途中の可能性があり，同じスタック領域
+		 *  を共有するタスクに実行順を譲ることはできない．
+		 */
+		ercd = E_NOSPT;
+	}
+	else {
+		rotate_ready_queue(pri, p_schedcb);
+		if (p_runtsk != p_schedtsk) {
+			if (!context) {
+				dispatch();
+			}
+			else {
+				request_dispatch_retint();
+			}
 		}
+		ercd = E_OK;
 	}
-	ercd = E_OK;
 	unlock_cpu();
 
   error_exit:
@@ -244,6 +258,7 @@ mrot_rdq(ID schedno, PRI tskpri)
 {
 	const DOMINIB	*p_dominib;
 	uint_t			pri;
+	QUEUE			*p_queue;
 	ER				ercd;
 
 	LOG_MROT_RDQ_ENTER(schedno, tskpri);
@@ -273,16 +288,26 @@ mrot_rdq(ID schedno, PRI tskpri)
 	CHECK_ACPTN(p_dominib->acvct.acptn1);		/*［NGKI3778］*/
 
 	lock_cpu();
-	rotate_ready_queue(pri, p_dominib->p_schedcb);
-	if (p_runtsk != p_schedtsk) {
-		if (!sense_context()) {
-			dispatch();
-		}
-		else {
-			request_dispatch_retint();
+	p_queue = &(p_dominib->p_schedcb->ready_queue[pri]);
+	if (!queue_empty(p_queue) && (((TCB *)(p_queue->p_next))->p_tinib->tskatr
+														& TA_RSTR) != 0U) {
+		/*
+		 *  rot_rdqと同様に，先頭の制約タスクの実行順は譲らない．
+		 */
+		ercd = E_NOSPT;
+	}
+	else {
+		rotate_ready_queue(pri, p_dominib->p_schedcb);
+		if (p_runtsk != p_schedtsk) {
+			if (!sense_context()) {
+				dispatch();
+			}
+			else {
+				request_dispatch_retint();
+			}
 		}
+		ercd = E_OK;
 	}
-	ercd = E_OK;
 	unlock_cpu();
 
   error_exit:
@@ -85,6 +85,20 @@ initialize_task(void)
 	enadsp = true;
 	dspflg = true;
 
+#ifdef USE_STACK_WATERMARK
+	/*
+	 *  タスクの起動時ではなく，ここで，すべてのタスクのスタック領域を
+	 *  パターンで埋める．起動と終了を繰り返すタスクでも，それまでの最
+	 *  大使用量が失われないようにするためである．また，スタック領域を
+	 *  共有する制約タスクでは，他のタスクの起動時に埋め直すと，共有す
+	 *  る他のタスクの最大使用量が失われる．
+	 */
+	for (i = 0; i < tnum_tsk; i++) {
+		stack_fill(tinib_table[i].sstk, tinib_table[i].sstksz);
+		stack_fill(tinib_table[i].ustk, tinib_table[i].ustksz);
+	}
+#endif /* USE_STACK_WATERMARK */
+
 	for (i = 0; i < tnum_tsk; i++) {
 		j = INDEX_TSK(torder_table[i]);
 		p_tcb = &(tcb_table[j]);
@@ -190,6 +204,82 @@ primap_clear(uint_t pri, SCHEDCB *p_schedcb)
 	p_schedcb->ready_primap &= ~PRIMAP_BIT(pri);
 }
 
+#ifdef USE_EDF_SCHED
+/*
+ *  絶対デッドラインの比較
+ *
+ *  p_tcb1の絶対デッドラインがp_tcb2の絶対デッドラインよりも早い場合に
+ *  trueを返す．2つの絶対デッドラインの差ではなく，それぞれの現在時刻
+ *  からの残り時間で比較する．絶対デッドラインを過ぎたタスクの残り時間
+ *  は0とみなすため，そのようなタスクの間では，先に挿入したタスクが前
+ *  になる．
+ */
+Inline bool_t
+deadline_precede(TCB *p_tcb1, TCB *p_tcb2)
+{
+	return(deadline_left(p_tcb1) < deadline_left(p_tcb2));
+}
+
+/*
+ *  絶対デッドラインの設定
+ *
+ *  現在時刻に相対デッドラインを加えて，絶対デッドラインとする．カー
+ *  ネルの初期化中は，高分解能タイマが動作しているとは限らないため，
+ *  現在のイベント時刻を更新しない．相対デッドラインはTMAX_DLNTIM以下
+ *  であるため（DEF_DLNとchg_dlnで検査している），設定した時点での
+ *  deadline_leftの値はTMAX_DLNTIMを超えない．
+ */
+Inline void
+set_deadline(TCB *p_tcb)
+{
+	if (kerflg) {
+		update_current_evttim();
+	}
+	p_tcb->absdln = current_evttim + (EVTTIM)(p_tcb->reldln);
+}
+#endif /* USE_EDF_SCHED */
+
+/*
+ *  レディキューへの挿入
+ *
+ *  p_tcbで指定されるタスクを，その優先度のタスクキューの末尾（mtxmode
+ *  がtrueの時は先頭）に挿入し，タスクキューの先頭に挿入された場合に
+ *  trueを返す．EDFスケジューリングを行うスケジューリング単位では，
+ *  mtxmodeによらず，絶対デッドラインの早い順になる位置に挿入する．絶
+ *  対デッドラインが同じタスクの間では，後から挿入したタスクを後ろに
+ *  する．
+ */
+Inline bool_t
+ready_queue_insert(TCB *p_tcb, SCHEDCB *p_schedcb, bool_t mtxmode)
+{
+	uint_t	pri = p_tcb->priority;
+	QUEUE	*p_queue = &(p_schedcb->ready_queue[pri]);
+#ifdef USE_EDF_SCHED
+	QUEUE	*p_entry;
+
+	if (p_schedcb->edf) {
+		for (p_entry = p_queue->p_next; p_entry != p_queue;
+											p_entry = p_entry->p_next) {
+			if (deadline_precede(p_tcb, (TCB *) p_entry)) {
+				break;
+			}
+		}
+		queue_insert_prev(p_entry, &(p_tcb->task_queue));
+		primap_set(pri, p_schedcb);
+		return(p_queue->p_next == &(p_tcb->task_queue));
+	}
+#endif /* USE_EDF_SCHED */
+
+	if (mtxmode) {
+		queue_insert_next(p_queue, &(p_tcb->task_queue));
+	}
+	else {
+		queue_insert_prev(p_queue, &(p_tcb->task_queue));
+	}
+	primap_set(pri, p_schedcb);
+	return(p_queue->p_next == &(p_tcb->task_queue));
+}
+
 /*
  *  最高優先順位タスクのサーチ
  */
@@ -211,7 +301,8 @@ search_predtsk(SCHEDCB *p_schedcb)
  *
  *  実行すべきタスクを更新するのは，実行できるタスクがなかった場合と，
  *  p_tcbで指定されるタスクの優先度が実行すべきタスクの優先度よりも高
- *  い場合である．
+ *  い場合である．EDFスケジューリングを行うスケジューリング単位では，
+ *  優先度が同じで，絶対デッドラインが早い場合にも更新する．
  */
 #ifdef TOPPERS_tskrun
 
@@ -220,12 +311,14 @@ make_runnable(TCB *p_tcb)
 {
 	SCHEDCB		*p_schedcb = p_tcb->p_schedcb;
 	uint_t		pri = p_tcb->priority;
+	bool_t		head;
 
-	queue_insert_prev(&(p_schedcb->ready_queue[pri]), &(p_tcb->task_queue));
-	primap_set(pri, p_schedcb);
+	UPDATE_SNPGEN();
+	head = ready_queue_insert(p_tcb, p_schedcb, false);
 
 	if (p_schedcb->p_predtsk == (TCB *) NULL
-							|| pri < p_schedcb->p_predtsk->priority) {
+				|| pri < p_schedcb->p_predtsk->priority
+				|| (head && pri == p_schedcb->p_predtsk->priority)) {
 		p_schedcb->p_predtsk = p_tcb;
 		if (dspflg) {
 			update_schedtsk();
@@ -252,6 +345,7 @@ make_non_runnable(TCB *p_tcb)
 	uint_t		pri = p_tcb->priority;
 	QUEUE		*p_queue = &(p_schedcb->ready_queue[pri]);
 
+	UPDATE_SNPGEN();
 	queue_delete(&(p_tcb->task_queue));
 	if (queue_empty(p_queue)) {
 		primap_clear(pri, p_schedcb);
@@ -290,6 +384,10 @@ make_dormant(TCB *p_tcb)
 	p_tcb->wupque = false;
 	p_tcb->raster = false;
 	p_tcb->enater = true;
+#ifdef USE_EDF_SCHED
+	p_tcb->reldln = p_tcb->p_tinib->ireldln;
+#endif /* USE_EDF_SCHED */
+	UPDATE_SNPGEN();
 	LOG_TSKSTAT(p_tcb);
 }
 
@@ -305,6 +403,11 @@ make_active(TCB *p_tcb)
 {
 	activate_context(p_tcb);
 	p_tcb->tstat = TS_RUNNABLE;
+#ifdef USE_EDF_SCHED
+	if (p_tcb->p_schedcb->edf) {
+		set_deadline(p_tcb);
+	}
+#endif /* USE_EDF_SCHED */
 	LOG_TSKSTAT(p_tcb);
 	make_runnable(p_tcb);
 }
@@ -322,8 +425,9 @@ make_active(TCB *p_tcb)
  *  すべきタスクであった場合には，優先度を下げた（または優先度が変わら
  *  なかった）時，(2) p_tcbで指定されるタスクが実行すべきタスクでなかっ
  *  た場合には，変更後の優先度が実行すべきタスクの優先度よりも高い時
- *  （mtxmodeがtrueの場合には，高いか同じ時）である．(1)の場合には，レ
- *  ディキューをサーチする必要がある．
+ *  （mtxmodeがtrueの場合には，高いか同じ時．EDFスケジューリングを行う
+ *  スケジューリング単位では，同じで絶対デッドラインが早い時）である．
+ *  (1)の場合には，レディキューをサーチする必要がある．
  */
 #ifdef TOPPERS_tskpri
 
@@ -332,9 +436,11 @@ change_priority(TCB *p_tcb, uint_t newpri, bool_t mtxmode)
 {
 	SCHEDCB		*p_schedcb = p_tcb->p_schedcb;
 	uint_t		oldpri;
+	bool_t		head;
 
 	oldpri = p_tcb->priority;
 	p_tcb->priority = newpri;
+	UPDATE_SNPGEN();
 
 	if (TSTAT_RUNNABLE(p_tcb->tstat)) {
 		/*
@@ -344,15 +450,7 @@ change_priority(TCB *p_tcb, uint_t newpri, bool_t mtxmode)
 		if (queue_empty(&(p_schedcb->ready_queue[oldpri]))) {
 			primap_clear(oldpri, p_schedcb);
 		}
-		if (mtxmode) {
-			queue_insert_next(&(p_schedcb->ready_queue[newpri]),
-												&(p_tcb->task_queue));
-		}
-		else {
-			queue_insert_prev(&(p_schedcb->ready_queue[newpri]),
-												&(p_tcb->task_queue));
-		}
-		primap_set(newpri, p_schedcb);
+		head = ready_queue_insert(p_tcb, p_schedcb, mtxmode);
 
 		if (p_schedcb->p_predtsk == p_tcb) {
 			if (newpri >= oldpri) {
@@ -368,8 +466,8 @@ change_priority(TCB *p_tcb, uint_t newpri, bool_t mtxmode)
 			}
 		}
 		else {
-			if (mtxmode ? newpri <= p_schedcb->p_predtsk->priority
-						: newpri < p_schedcb->p_predtsk->priority) {
+			if (newpri < p_schedcb->p_predtsk->priority
+					|| (head && newpri == p_schedcb->p_predtsk->priority)) {
 				p_schedcb->p_predtsk = p_tcb;
 				if (dspflg) {
 					update_schedtsk();
@@ -395,7 +493,9 @@ change_priority(TCB *p_tcb, uint_t newpri, bool_t mtxmode)
  *  レディキューの回転
  *
  *  実行すべきタスクを更新するのは，実行すべきタスクがタスクキューの末
- *  尾に移動した場合である．
+ *  尾に移動した場合である．EDFスケジューリングを行うスケジューリング
+ *  単位では，タスクキューを絶対デッドラインの順に保つため，回転させ
+ *  ない．
  */
 #ifdef TOPPERS_tskrot
 
@@ -405,6 +505,11 @@ rotate_ready_queue(uint_t pri, SCHEDCB *p_schedcb)
 	QUEUE	*p_queue = &(p_schedcb->ready_queue[pri]);
 	QUEUE	*p_entry;
 
+#ifdef USE_EDF_SCHED
+	if (p_schedcb->edf) {
+		return;
+	}
+#endif /* USE_EDF_SCHED */
 	if (!queue_empty(p_queue) && p_queue->p_next->p_next != p_queue) {
 		p_entry = queue_delete_next(p_queue);
 		queue_insert_prev(p_queue, p_entry);
@@ -419,6 +524,71 @@ rotate_ready_queue(uint_t pri, SCHEDCB *p_schedcb)
 
 #endif /* TOPPERS_tskrot */
 
+/*
+ *  タスクの相対デッドラインの変更
+ *
+ *  p_tcbで指定されるタスクが実行できる状態の場合には，レディキューの
+ *  中での位置を変更し，最高優先順位のタスクをサーチし直す．
+ */
+#ifdef TOPPERS_tskdln
+#ifdef USE_EDF_SCHED
+
+void
+change_deadline(TCB *p_tcb, RELTIM reldln)
+{
+	SCHEDCB		*p_schedcb = p_tcb->p_schedcb;
+
+	p_tcb->reldln = reldln;
+	if (p_schedcb->edf) {
+		set_deadline(p_tcb);
+		if (TSTAT_RUNNABLE(p_tcb->tstat)) {
+			queue_delete(&(p_tcb->task_queue));
+			(void) ready_queue_insert(p_tcb, p_schedcb, false);
+			p_schedcb->p_predtsk = search_predtsk(p_schedcb);
+			if (dspflg) {
+				update_schedtsk();
+			}
+		}
+	}
+}
+
+#endif /* USE_EDF_SCHED */
+#endif /* TOPPERS_tskdln */
+
+/*
+ *  スタック領域のパターン埋めと最大使用量の算出
+ */
+#ifdef TOPPERS_tskstk
+#ifdef USE_STACK_WATERMARK
+
+void
+stack_fill(void *stk, size_t stksz)
+{
+	uint32_t	*p_word = (uint32_t *) stk;
+	size_t		i;
+
+	for (i = 0; i < stksz / sizeof(uint32_t); i++) {
+		p_word[i] = STKFILL_PATTERN;
+	}
+}
+
+size_t
+stack_usage(const void *stk, size_t stksz)
+{
+	const uint32_t	*p_word = (const uint32_t *) stk;
+	size_t			i;
+
+	for (i = 0; i < stksz / sizeof(uint32_t); i++) {
+		if (p_word[i] != STKFILL_PATTERN) {
+			break;
+		}
+	}
+	return(stksz - i * sizeof(uint32_t));
+}
+
+#endif /* USE_STACK_WATERMARK */
+#endif /* TOPPERS_tskstk */
+
 /*
  *  タスクの終了処理
  */
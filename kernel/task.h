@@ -51,6 +51,7 @@
 #include <queue.h>
 #include "time_event.h"
 #include "domain.h"
+#include "snapshot.h"
 
 /*
  *  トレースログマクロのデフォルト定義
@@ -90,6 +91,8 @@
 #define TS_WAITING_RDTQ	(0x08U << 2)	/* データキューからの受信待ち */
 #define TS_WAITING_RPDQ	(0x09U << 2)	/* 優先度データキューからの受信待ち */
 #define TS_WAITING_RMBF	(0x0aU << 2)	/* メッセージバッファからの受信待ち */
+#define TS_WAITING_RCHN	(0x0bU << 2)	/* チャネルの受信ブロック待ち */
+#define TS_WAITING_SCHN	(0x0cU << 2)	/* チャネルの空きブロック待ち */
 #define TS_WAITING_SEM	(0x10U << 2)	/* セマフォ資源の獲得待ち */
 #define TS_WAITING_FLG	(0x11U << 2)	/* イベントフラグ待ち */
 #define TS_WAITING_SDTQ	(0x12U << 2)	/* データキューへの送信待ち */
@@ -207,6 +210,9 @@ typedef struct task_initialization_block {
 #endif /* USE_TSKINICTXB */
 
 	ACVCT		acvct;			/* アクセス許可ベクタ */
+#ifdef USE_EDF_SCHED
+	RELTIM		ireldln;		/* タスクの起動時相対デッドライン */
+#endif /* USE_EDF_SCHED */
 } TINIB;
 
 /*
@@ -225,13 +231,24 @@ typedef struct task_initialization_block {
  *  ・初期化後は常に有効：
  *  		p_tinib，p_dominib，p_schedcb，tstat，actque
  *  ・休止状態以外で有効（休止状態では初期値になっている）：
- *  		svclevel，bpriority，priority，wupque，raster，enater，p_lastmtx
+ *  		svclevel，bpriority，priority，wupque，raster，enater，p_lastmtx，
+ *  		reldln
+ *  ・休止状態以外で，EDFスケジューリングを行うスケジューリング単位に
+ *    属する場合に有効：
+ *  		absdln
  *  ・待ち状態（二重待ち状態を含む）で有効：
  *  		p_winfo
+ *  ・同期・通信オブジェクトに対する待ち状態で，USE_OBJSTATをマクロ定
+ *    義した場合に有効：
+ *  		wsttim
  *  ・実行できる状態と同期・通信オブジェクトに対する待ち状態で有効：
  *  		task_queue
  *  ・実行可能状態，待ち状態，強制待ち状態，二重待ち状態で有効：
  *  		tskctxb
+ *
+ *  ディスパッチャとスケジューラが参照するフィールド（EDFスケジューリ
+ *  ングで用いるデッドラインを含む）を先頭にまとめ，待ち状態やミューテッ
+ *  クスに関するフィールドを後ろに置いている．
  */
 struct task_control_block {
 	QUEUE			task_queue;		/* タスクキュー */
@@ -254,10 +271,17 @@ struct task_control_block {
 	BIT_FIELD_BOOL	wupque : 1;		/* 起床要求キューイング */
 	BIT_FIELD_BOOL	raster : 1;		/* タスク終了要求状態 */
 	BIT_FIELD_BOOL	enater : 1;		/* タスク終了許可状態 */
+	TSKCTXB			tskctxb;		/* タスクコンテキストブロック */
+#ifdef USE_EDF_SCHED
+	RELTIM			reldln;			/* 相対デッドライン */
+	EVTTIM			absdln;			/* 絶対デッドライン */
+#endif /* USE_EDF_SCHED */
 
 	WINFO			*p_winfo;		/* 待ち情報ブロックへのポインタ */
 	MTXCB			*p_lastmtx;		/* 最後にロックしたミューテックス */
-	TSKCTXB			tskctxb;		/* タスクコンテキストブロック */
+#ifdef USE_OBJSTAT
+	HRTCNT			wsttim;			/* 待ち状態に入った時刻 */
+#endif /* USE_OBJSTAT */
 };
 
 /*
@@ -375,12 +399,91 @@ update_schedtsk(void)
 		if (p_twdsched->p_predtsk != NULL) {
 			p_schedtsk = p_twdsched->p_predtsk;
 		}
+#ifdef USE_SLACK_RECLAIM
+		else if (p_runtwd != NULL) {
+			p_schedtsk = search_slktsk();
+		}
+#endif /* USE_SLACK_RECLAIM */
 		else {
 			p_schedtsk = p_idlesched->p_predtsk;
 		}
 	}
 }
 
+#ifdef USE_LOCK_ELISION
+/*
+ *  タスクコンテキスト専用のオブジェクトの判定
+ *
+ *  TA_TSKCTX属性のセマフォ，イベントフラグ，データキュー，優先度デー
+ *  タキューは，非タスクコンテキストから操作しない．ミューテックス，メッ
+ *  セージバッファ，固定長メモリプールを操作するサービスコールは，すべ
+ *  てタスクコンテキスト専用である．
+ */
+#define TSKCTX_OBJ(objatr)		(((objatr) & TA_TSKCTX) != 0U)
+
+/*
+ *  コンパイラによるメモリアクセスの移動の抑止
+ */
+#ifndef DSP_HOLD_BARRIER
+#define DSP_HOLD_BARRIER()		Asm("" ::: "memory")
+#endif /* DSP_HOLD_BARRIER */
+
+/*
+ *  タスク切換えを保留した直後に呼び出すフック（テスト用）
+ *
+ *  保留中に割込みを発生させるテストで用いる．
+ */
+#ifdef HOOK_DSP_HOLD
+extern void	hook_dsp_hold(void);
+#endif /* HOOK_DSP_HOLD */
+
+/*
+ *  タスク切換えの保留によるCPUロックの省略
+ *
+ *  タスクコンテキスト専用のオブジェクトの状態は，他のタスクに切り換わ
+ *  らない限り変化しない．そこで，待ち状態のタスクに関わらない操作は，
+ *  dspflgをfalseにして実行すべきタスクの更新を止め，CPUロック状態にせ
+ *  ずに行う．待ち行列からのタスクの削除（タイムアウトや待ち状態の強制
+ *  解除）は割込み処理からも行われるが，待ち行列にタスクをつなぐのは待
+ *  ち状態に入るタスク自身のみであるため，保留中に空の待ち行列が空でな
+ *  くなることはない．
+ *
+ *  begin_dsp_holdは，タスク切換えを保留した場合にtrueを返す．既にディ
+ *  スパッチ保留状態の場合には，何もせずにfalseを返す．end_dsp_holdに
+ *  は，begin_dsp_holdの返値を渡す．
+ */
+Inline bool_t
+begin_dsp_hold(void)
+{
+	if (dspflg) {
+		dspflg = false;
+		DSP_HOLD_BARRIER();
+#ifdef HOOK_DSP_HOLD
+		hook_dsp_hold();
+#endif /* HOOK_DSP_HOLD */
+		return(true);
+	}
+	return(false);
+}
+
+/*
+ *  タスク切換えの保留の解除
+ *
+ *  dspflgをtrueに戻し，保留中に必要になったタスク切換えを行う．
+ */
+extern void	release_dsp_hold(void);
+
+Inline void
+end_dsp_hold(bool_t held)
+{
+	if (held) {
+		DSP_HOLD_BARRIER();
+		release_dsp_hold();
+	}
+}
+
+#endif /* USE_LOCK_ELISION */
+
 /*
  *  実行できる状態への遷移
  *
@@ -434,6 +537,66 @@ extern void	change_priority(TCB *p_tcb, uint_t newpri, bool_t mtxmode);
  */
 extern void	rotate_ready_queue(uint_t pri, SCHEDCB *p_schedcb);
 
+#ifdef USE_EDF_SCHED
+/*
+ *  絶対デッドラインまでの残り時間
+ *
+ *  current_evttimから，p_tcbで指定されるタスクの絶対デッドラインまで
+ *  の時間を返す．絶対デッドラインは，設定した時点の時刻からTMAX_DLNTIM
+ *  以内であるため，残り時間がTMAX_DLNTIMより大きい場合には，絶対デッ
+ *  ドラインを過ぎているものとみなして0を返す．これにより，絶対デッド
+ *  ラインを大きく過ぎたタスクが，最も遅いデッドラインを持つように扱わ
+ *  れることを防ぐ（イベント時刻が一周するまでの間に限る）．
+ */
+Inline EVTTIM
+deadline_left(TCB *p_tcb)
+{
+	EVTTIM	left = p_tcb->absdln - current_evttim;
+
+	return((left > (EVTTIM) TMAX_DLNTIM) ? 0U : left);
+}
+
+/*
+ *  タスクの相対デッドラインの変更
+ *
+ *  p_tcbで指定されるタスクの相対デッドラインをreldlnに変更し，現在時
+ *  刻から絶対デッドラインを求め直す．p_tcbで指定されるタスクが，EDFス
+ *  ケジューリングを行うスケジューリング単位で実行できる状態である場合
+ *  には，レディキューの中での位置を変更し，必要な場合には，実行すべき
+ *  タスクを更新する．
+ */
+extern void	change_deadline(TCB *p_tcb, RELTIM reldln);
+#endif /* USE_EDF_SCHED */
+
+/*
+ *  スタック使用量の計測
+ *
+ *  USE_STACK_WATERMARKをマクロ定義すると，カーネルの初期化時にスタッ
+ *  ク領域をSTKFILL_PATTERNで埋めておき，書き換えられていない部分の大
+ *  きさから，スタック領域の最大使用量を求める．スタックは番地の小さい
+ *  方へ伸びるものとする．タスク初期化コンテキストブロックを用いる場合
+ *  は，スタック領域の番地がTINIBにないため，サポートしない．
+ */
+#ifdef USE_TSKINICTXB
+#undef USE_STACK_WATERMARK
+#endif /* USE_TSKINICTXB */
+
+#ifdef USE_STACK_WATERMARK
+#ifndef STKFILL_PATTERN
+#define STKFILL_PATTERN		0xa5a5a5a5U
+#endif /* STKFILL_PATTERN */
+
+/*
+ *  スタック領域のパターン埋め
+ */
+extern void	stack_fill(void *stk, size_t stksz);
+
+/*
+ *  スタック領域の最大使用量の算出
+ */
+extern size_t	stack_usage(const void *stk, size_t stksz);
+#endif /* USE_STACK_WATERMARK */
+
 /*
  *  タスクの終了処理
  *
@@ -442,4 +605,22 @@ extern void	rotate_ready_queue(uint_t pri, SCHEDCB *p_schedcb);
  */
 extern void	task_terminate(TCB *p_tcb);
 
+/*
+ *  タスクの状態の取出し
+ *
+ *  p_tcbで指定されるタスクの状態を，pk_rtskで指定される領域に取り出
+ *  す．ref_tskとref_snpから，CPUロック状態で呼び出される．
+ */
+extern void	refer_task(TCB *p_tcb, T_RTSK *pk_rtsk);
+
+/*
+ *  タイムイベントの通知処理によるタスクの起動／起床
+ *
+ *  コンフィギュレータが生成する通知ハンドラから，CPUロック状態で呼び
+ *  出される．act_tsk／wup_tskからエラーチェックとタスクディスパッチ
+ *  を除いたものである．
+ */
+extern ER	nfy_act_tsk(TCB *p_tcb);
+extern ER	nfy_wup_tsk(TCB *p_tcb);
+
 #endif /* TOPPERS_TASK_H */
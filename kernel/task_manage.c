@@ -100,6 +100,14 @@
 #define LOG_GET_INF_LEAVE(ercd, p_exinf)
 #endif /* LOG_GET_INF_LEAVE */
 
+#ifndef LOG_CHG_DLN_ENTER
+#define LOG_CHG_DLN_ENTER(tskid, reldln)
+#endif /* LOG_CHG_DLN_ENTER */
+
+#ifndef LOG_CHG_DLN_LEAVE
+#define LOG_CHG_DLN_LEAVE(ercd)
+#endif /* LOG_CHG_DLN_LEAVE */
+
 /*
  *  タスクの起動［NGKI3529］
  */
@@ -140,6 +148,7 @@ act_tsk(ID tskid)
 	}
 	else {
 		p_tcb->actque = true;					/*［NGKI3527］*/
+		UPDATE_SNPGEN();
 		ercd = E_OK;
 	}
 	unlock_cpu();
@@ -151,6 +160,34 @@ act_tsk(ID tskid)
 
 #endif /* TOPPERS_act_tsk */
 
+/*
+ *  タイムイベントの通知処理によるタスクの起動
+ *
+ *  通知ハンドラに指定されたタスクIDとアクセス許可は，コンフィギュレー
+ *  タのパス4でチェックしているため，ここではチェックしない．タスクディ
+ *  スパッチが必要な場合は，呼出し元で処理する．
+ */
+#ifdef TOPPERS_nfyact
+
+ER
+nfy_act_tsk(TCB *p_tcb)
+{
+	if (TSTAT_DORMANT(p_tcb->tstat)) {
+		make_active(p_tcb);
+		return(E_OK);
+	}
+	else if ((p_tcb->p_tinib->tskatr & TA_NOACTQUE) != 0U || p_tcb->actque) {
+		return(E_QOVR);
+	}
+	else {
+		p_tcb->actque = true;
+		UPDATE_SNPGEN();
+		return(E_OK);
+	}
+}
+
+#endif /* TOPPERS_nfyact */
+
 /*
  *  タスク起動要求のキャンセル［NGKI1138］
  */
@@ -176,6 +213,7 @@ can_act(ID tskid)
 	lock_cpu();
 	ercd = p_tcb->actque ? 1 : 0;				/*［NGKI1144］*/
 	p_tcb->actque = false;						/*［NGKI1144］*/
+	UPDATE_SNPGEN();
 	unlock_cpu();
 
   error_exit:
@@ -263,6 +301,7 @@ chg_pri(ID tskid, PRI tskpri)
 		p_tcb = get_tcb(tskid);
 	}
 	CHECK_ACPTN(p_tcb->p_tinib->acvct.acptn2);	/*［NGKI1190］*/
+	CHECK_NONRSTR(p_tcb);
 	if (tskpri == TPRI_INI) {
 		newbpri = p_tcb->p_tinib->ipriority;	/*［NGKI1199］*/
 	}
@@ -281,6 +320,7 @@ chg_pri(ID tskid, PRI tskpri)
 	}
 	else {
 		p_tcb->bpriority = newbpri;				/*［NGKI1192］*/
+		UPDATE_SNPGEN();
 		if (p_tcb->p_lastmtx == NULL || !((*mtxhook_scan_ceilmtx)(p_tcb))) {
 			change_priority(p_tcb, newbpri, false);		/*［NGKI1193］*/
 			if (p_runtsk != p_schedtsk) {
@@ -361,3 +401,56 @@ get_inf(EXINF *p_exinf)
 }
 
 #endif /* TOPPERS_get_inf */
+
+/*
+ *  タスクの相対デッドラインの変更
+ *
+ *  対象タスクの相対デッドラインをreldlnに変更し，現在時刻を起点に絶対
+ *  デッドラインを設定し直す．変更した相対デッドラインは，タスクが休
+ *  止状態になると，起動時相対デッドラインに戻る．USE_EDF_SCHEDがマク
+ *  ロ定義されていない場合には，E_NOSPTエラーとなる．reldlnの上限の検
+ *  査は，絶対デッドラインの比較（deadline_left）の前提となっている．
+ */
+#ifdef TOPPERS_chg_dln
+
+ER
+chg_dln(ID tskid, RELTIM reldln)
+{
+	TCB		*p_tcb;
+	ER		ercd;
+
+	LOG_CHG_DLN_ENTER(tskid, reldln);
+	CHECK_TSKCTX_UNL();
+	if (tskid == TSK_SELF) {
+		p_tcb = p_runtsk;
+	}
+	else {
+		CHECK_ID(VALID_TSKID(tskid));
+		p_tcb = get_tcb(tskid);
+	}
+	CHECK_ACPTN(p_tcb->p_tinib->acvct.acptn2);
+	CHECK_PAR(0U < reldln && reldln <= TMAX_DLNTIM);
+
+#ifdef USE_EDF_SCHED
+	lock_cpu();
+	if (TSTAT_DORMANT(p_tcb->tstat)) {
+		ercd = E_OBJ;
+	}
+	else {
+		change_deadline(p_tcb, reldln);
+		if (p_runtsk != p_schedtsk) {
+			dispatch();
+		}
+		ercd = E_OK;
+	}
+	unlock_cpu();
+#else /* USE_EDF_SCHED */
+	ercd = E_NOSPT;
+#endif /* USE_EDF_SCHED */
+
+  error_exit:
+	LOG_CHG_DLN_LEAVE(ercd);
+	return(ercd);
+}
+
+#endif /* TOPPERS_chg_dln */
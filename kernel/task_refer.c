@@ -53,6 +53,7 @@
 #include "mutex.h"
 #include "messagebuf.h"
 #include "mempfix.h"
+#include "channel.h"
 #include "time_event.h"
 
 /*
@@ -66,31 +67,24 @@
 #define LOG_REF_TSK_LEAVE(ercd, pk_rtsk)
 #endif /* LOG_REF_TSK_LEAVE */
 
+#ifndef LOG_REF_STK_ENTER
+#define LOG_REF_STK_ENTER(tskid, pk_rstk)
+#endif /* LOG_REF_STK_ENTER */
+
+#ifndef LOG_REF_STK_LEAVE
+#define LOG_REF_STK_LEAVE(ercd, pk_rstk)
+#endif /* LOG_REF_STK_LEAVE */
+
 /*
- *  タスクの状態参照［NGKI1217］
+ *  タスクの状態の取出し
  */
-#ifdef TOPPERS_ref_tsk
+#ifdef TOPPERS_tskref
 
-ER
-ref_tsk(ID tskid, T_RTSK *pk_rtsk)
+void
+refer_task(TCB *p_tcb, T_RTSK *pk_rtsk)
 {
-	TCB		*p_tcb;
 	uint_t	tstat;
-	ER		ercd;
 
-	LOG_REF_TSK_ENTER(tskid, pk_rtsk);
-	CHECK_TSKCTX_UNL();							/*［NGKI1218］［NGKI1219］*/
-	if (tskid == TSK_SELF) {
-		p_tcb = p_runtsk;						/*［NGKI1248］*/
-	}
-	else {
-		CHECK_ID(VALID_TSKID(tskid));			/*［NGKI1220］*/
-		p_tcb = get_tcb(tskid);
-	}
-	CHECK_MACV_WRITE(pk_rtsk, T_RTSK);			/*［NGKI1223］*/
-	CHECK_ACPTN(p_tcb->p_tinib->acvct.acptn4);	/*［NGKI1222］*/
-
-	lock_cpu();
 	tstat = p_tcb->tstat;
 	if (TSTAT_DORMANT(tstat)) {
 		/*
@@ -188,6 +182,16 @@ ref_tsk(ID tskid, T_RTSK *pk_rtsk)
 				pk_rtsk->wobjid = MPFID(((WINFO_MPF *)(p_tcb->p_winfo))
 																->p_mpfcb);
 				break;
+			case TS_WAITING_SCHN:
+				pk_rtsk->tskwait = TTW_SCHN;
+				pk_rtsk->wobjid = CHNID(((WINFO_CHN *)(p_tcb->p_winfo))
+																->p_chncb);
+				break;
+			case TS_WAITING_RCHN:
+				pk_rtsk->tskwait = TTW_RCHN;
+				pk_rtsk->wobjid = CHNID(((WINFO_CHN *)(p_tcb->p_winfo))
+																->p_chncb);
+				break;
 			}
 
 			/*
@@ -227,6 +231,35 @@ ref_tsk(ID tskid, T_RTSK *pk_rtsk)
 	 *  起動要求キューイング数の取出し［NGKI1238］
 	 */
 	pk_rtsk->actcnt = p_tcb->actque ? 1U : 0U;
+}
+
+#endif /* TOPPERS_tskref */
+
+/*
+ *  タスクの状態参照［NGKI1217］
+ */
+#ifdef TOPPERS_ref_tsk
+
+ER
+ref_tsk(ID tskid, T_RTSK *pk_rtsk)
+{
+	TCB		*p_tcb;
+	ER		ercd;
+
+	LOG_REF_TSK_ENTER(tskid, pk_rtsk);
+	CHECK_TSKCTX_UNL();							/*［NGKI1218］［NGKI1219］*/
+	if (tskid == TSK_SELF) {
+		p_tcb = p_runtsk;						/*［NGKI1248］*/
+	}
+	else {
+		CHECK_ID(VALID_TSKID(tskid));			/*［NGKI1220］*/
+		p_tcb = get_tcb(tskid);
+	}
+	CHECK_MACV_WRITE(pk_rtsk, T_RTSK);			/*［NGKI1223］*/
+	CHECK_ACPTN(p_tcb->p_tinib->acvct.acptn4);	/*［NGKI1222］*/
+
+	lock_cpu();
+	refer_task(p_tcb, pk_rtsk);
 	ercd = E_OK;
 	unlock_cpu();
 
@@ -236,3 +269,63 @@ ref_tsk(ID tskid, T_RTSK *pk_rtsk)
 }
 
 #endif /* TOPPERS_ref_tsk */
+
+/*
+ *  スタック領域の使用量の参照
+ *
+ *  tskidにTSK_ISTKを指定した場合には，非タスクコンテキスト用のスタッ
+ *  ク領域の使用量を，システムスタック領域の情報として返す．スタック領
+ *  域の走査には時間がかかるため，CPUロック状態にはしない．
+ */
+#ifdef TOPPERS_ref_stk
+
+ER
+ref_stk(ID tskid, T_RSTK *pk_rstk)
+{
+#ifdef USE_STACK_WATERMARK
+	TCB		*p_tcb;
+#endif /* USE_STACK_WATERMARK */
+	ER		ercd;
+
+	LOG_REF_STK_ENTER(tskid, pk_rstk);
+	CHECK_TSKCTX_UNL();
+#ifdef USE_STACK_WATERMARK
+	if (tskid == TSK_ISTK) {
+		p_tcb = NULL;
+	}
+	else if (tskid == TSK_SELF) {
+		p_tcb = p_runtsk;
+	}
+	else {
+		CHECK_ID(VALID_TSKID(tskid));
+		p_tcb = get_tcb(tskid);
+	}
+	CHECK_MACV_WRITE(pk_rstk, T_RSTK);
+
+	if (p_tcb == NULL) {
+		CHECK_ACPTN(sysstat_acvct.acptn4);
+		pk_rstk->sstksz = istksz;
+		pk_rstk->sstkuse = stack_usage(istk, istksz);
+		pk_rstk->ustksz = 0U;
+		pk_rstk->ustkuse = 0U;
+	}
+	else {
+		CHECK_ACPTN(p_tcb->p_tinib->acvct.acptn4);
+		pk_rstk->sstksz = p_tcb->p_tinib->sstksz;
+		pk_rstk->sstkuse = stack_usage(p_tcb->p_tinib->sstk,
+										p_tcb->p_tinib->sstksz);
+		pk_rstk->ustksz = p_tcb->p_tinib->ustksz;
+		pk_rstk->ustkuse = stack_usage(p_tcb->p_tinib->ustk,
+										p_tcb->p_tinib->ustksz);
+	}
+	ercd = E_OK;
+#else /* USE_STACK_WATERMARK */
+	ercd = E_NOSPT;
+#endif /* USE_STACK_WATERMARK */
+
+  error_exit:
+	LOG_REF_STK_LEAVE(ercd, pk_rstk);
+	return(ercd);
+}
+
+#endif /* TOPPERS_ref_stk */
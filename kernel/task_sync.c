@@ -129,6 +129,7 @@ slp_tsk(void)
 
 	LOG_SLP_TSK_ENTER();
 	CHECK_DISPATCH();							/*［NGKI1254］*/
+	CHECK_NONRSTR_CALLER();
 
 	lock_cpu_dsp();
 	if (p_runtsk->raster) {
@@ -136,6 +137,7 @@ slp_tsk(void)
 	}
 	else if (p_runtsk->wupque) {
 		p_runtsk->wupque = false;				/*［NGKI1259］*/
+		UPDATE_SNPGEN();
 		ercd = E_OK;
 	}
 	else {
@@ -167,6 +169,7 @@ tslp_tsk(TMO tmout)
 
 	LOG_TSLP_TSK_ENTER(tmout);
 	CHECK_DISPATCH();							/*［NGKI1254］*/
+	CHECK_NONRSTR_CALLER();
 	CHECK_PAR(VALID_TMOUT(tmout));				/*［NGKI1256］*/
 
 	lock_cpu_dsp();
@@ -175,6 +178,7 @@ tslp_tsk(TMO tmout)
 	}
 	else if (p_runtsk->wupque) {
 		p_runtsk->wupque = false;				/*［NGKI1259］*/
+		UPDATE_SNPGEN();
 		ercd = E_OK;
 	}
 	else if (tmout == TMO_POL) {
@@ -235,6 +239,7 @@ wup_tsk(ID tskid)
 	}
 	else if (!(p_tcb->wupque)) {
 		p_tcb->wupque = true;					/*［NGKI1273］*/
+		UPDATE_SNPGEN();
 		ercd = E_OK;
 	}
 	else {
@@ -249,6 +254,33 @@ wup_tsk(ID tskid)
 
 #endif /* TOPPERS_wup_tsk */
 
+/*
+ *  タイムイベントの通知処理によるタスクの起床
+ */
+#ifdef TOPPERS_nfywup
+
+ER
+nfy_wup_tsk(TCB *p_tcb)
+{
+	if (TSTAT_DORMANT(p_tcb->tstat)) {
+		return(E_OBJ);
+	}
+	else if (TSTAT_WAIT_SLP(p_tcb->tstat)) {
+		wait_complete(p_tcb);
+		return(E_OK);
+	}
+	else if (!(p_tcb->wupque)) {
+		p_tcb->wupque = true;
+		UPDATE_SNPGEN();
+		return(E_OK);
+	}
+	else {
+		return(E_QOVR);
+	}
+}
+
+#endif /* TOPPERS_nfywup */
+
 /*
  *  タスク起床要求のキャンセル［NGKI1276］
  */
@@ -278,6 +310,7 @@ can_wup(ID tskid)
 	else {
 		ercd = p_tcb->wupque ? 1 : 0;			/*［NGKI1284］*/
 		p_tcb->wupque = false;					/*［NGKI1284］*/
+		UPDATE_SNPGEN();
 	}
 	unlock_cpu();
 
@@ -354,6 +387,7 @@ sus_tsk(ID tskid)
 		p_tcb = get_tcb(tskid);
 	}
 	CHECK_ACPTN(p_tcb->p_tinib->acvct.acptn2);	/*［NGKI1304］*/
+	CHECK_NONRSTR(p_tcb);
 
 	lock_cpu();
 	if (p_tcb == p_runtsk && !dspflg) {			/*［NGKI1311］［NGKI3604］*/
@@ -385,6 +419,7 @@ sus_tsk(ID tskid)
 		 *  待ち状態から二重待ち状態への遷移［NGKI1308］
 		 */
 		p_tcb->tstat |= TS_SUSPENDED;
+		UPDATE_SNPGEN();
 		LOG_TSKSTAT(p_tcb);
 		ercd = E_OK;
 	}
@@ -432,6 +467,7 @@ rsm_tsk(ID tskid)
 		}
 		else {
 			p_tcb->tstat &= ~TS_SUSPENDED;
+			UPDATE_SNPGEN();
 			LOG_TSKSTAT(p_tcb);
 		}
 		ercd = E_OK;
@@ -459,6 +495,7 @@ dly_tsk(RELTIM dlytim)
 
 	LOG_DLY_TSK_ENTER(dlytim);
 	CHECK_DISPATCH();							/*［NGKI1349］*/
+	CHECK_NONRSTR_CALLER();
 	CHECK_PAR(VALID_RELTIM(dlytim));			/*［NGKI1351］*/
 
 	lock_cpu_dsp();
@@ -181,6 +181,7 @@ ras_ter(ID tskid)
 	}
 	else {
 		p_tcb->raster = true;					/*［NGKI3478］*/
+		UPDATE_SNPGEN();
 		if (!TSTAT_RUNNABLE(p_tcb->tstat)) {
 			if (TSTAT_WAITING(p_tcb->tstat)) {
 				wait_dequeue_wobj(p_tcb);		/*［NGKI3479］*/
@@ -221,6 +222,7 @@ dis_ter(void)
 
 	lock_cpu();
 	p_runtsk->enater = false;					/*［NGKI3486］*/
+	UPDATE_SNPGEN();
 	ercd = E_OK;
 	unlock_cpu();
 
@@ -253,6 +255,7 @@ ena_ter(void)
 	}
 	else {
 		p_runtsk->enater = true;				/*［NGKI3491］*/
+		UPDATE_SNPGEN();
 		ercd = E_OK;
 	}
 	unlock_cpu();
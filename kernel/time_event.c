@@ -47,6 +47,7 @@
 #include "kernel_impl.h"
 #include "time_event.h"
 #include "domain.h"
+#include "task.h"
 
 /*
  *  TCYC_HRTCNTの定義のチェック
@@ -708,6 +709,14 @@ signal_time(void)
 	 */
 	set_hrt_event();
 
+	/*
+	 *  CPUロック状態で呼び出した通知ハンドラによって，実行すべきタス
+	 *  クが更新された場合には，まとめてディスパッチを要求する．
+	 */
+	if (p_runtsk != p_schedtsk) {
+		request_dispatch_retint();
+	}
+
 	in_signal_time = false;							/*［ASPD1033］*/
 	unlock_cpu();
 }
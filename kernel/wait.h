@@ -125,6 +125,7 @@ make_non_wait(TCB *p_tcb)
 		 *  二重待ち状態から強制待ち状態への遷移
 		 */
 		p_tcb->tstat = TS_SUSPENDED;
+		UPDATE_SNPGEN();
 		LOG_TSKSTAT(p_tcb);
 	}
 }
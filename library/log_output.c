@@ -47,50 +47,140 @@
 #include <t_syslog.h>
 #include <log_output.h>
 
+/*
+ *  出力先の管理
+ *
+ *  整形した文字列はbufに格納する．putcがNULLでない場合には，bufが一杯
+ *  になる毎に，格納した文字をputcを用いて出力する．putcがNULLの場合に
+ *  は，bufに入り切らない文字は捨てる．
+ */
+typedef struct log_output_buffer {
+	char	*buf;				/* 文字列を格納する領域 */
+	uint_t	size;				/* bufのサイズ */
+	uint_t	len;				/* bufに格納した文字数 */
+	void	(*putc)(char);		/* 1文字出力関数 */
+} LOGBUF;
+
+/*
+ *  1文字出力関数を用いる場合のバッファのサイズ
+ */
+#ifndef LOG_OUTPUT_BUFSZ
+#define LOG_OUTPUT_BUFSZ	32U
+#endif /* LOG_OUTPUT_BUFSZ */
+
+/*
+ *  バッファに格納した文字の出力
+ */
+static void
+logbuf_flush(LOGBUF *p_logbuf)
+{
+	uint_t	i;
+
+	if (p_logbuf->putc != NULL) {
+		for (i = 0U; i < p_logbuf->len; i++) {
+			(*p_logbuf->putc)(p_logbuf->buf[i]);
+		}
+		p_logbuf->len = 0U;
+	}
+}
+
+/*
+ *  バッファへの1文字の格納
+ */
+Inline void
+logbuf_putc(LOGBUF *p_logbuf, char c)
+{
+	if (p_logbuf->len >= p_logbuf->size) {
+		logbuf_flush(p_logbuf);
+		if (p_logbuf->len >= p_logbuf->size) {
+			return;
+		}
+	}
+	p_logbuf->buf[p_logbuf->len++] = c;
+}
+
+/*
+ *  10による除算
+ *
+ *  除算命令を用いずに，ULOGPAR型の値を10で割った商を求める．ULOGPAR型
+ *  が32ビット以下の場合には，逆数の乗算で求め，そうでない場合には，シ
+ *  フトと加算で近似した商を補正して求める．
+ */
+Inline ULOGPAR
+div10(ULOGPAR val)
+{
+#if defined(UINT64_MAX) && UINTPTR_MAX <= UINT32_MAX
+	return((ULOGPAR)((((uint64_t) val) * UINT64_C(0xcccccccd)) >> 35));
+#else /* defined(UINT64_MAX) && UINTPTR_MAX <= UINT32_MAX */
+	ULOGPAR	q, r;
+
+	q = (val >> 1) + (val >> 2);
+	q += (q >> 4);
+	q += (q >> 8);
+	q += (q >> 16);
+	q += ((q >> 16) >> 16);
+	q >>= 3;
+	r = val - ((q << 3) + (q << 1));
+	return(q + ((r > 9U) ? 1U : 0U));
+#endif /* defined(UINT64_MAX) && UINTPTR_MAX <= UINT32_MAX */
+}
+
 /*
  *  数値を文字列に変換
+ *
+ *  16進数はシフトとマスクで，10進数はdiv10で各桁を求める．
  */
 #define CONVERT_BUFLEN	((sizeof(ULOGPAR) * CHAR_BIT + 2) / 3)
 										/* ULOGPAR型の数値の最大文字数 */
 static void
-convert(ULOGPAR val, uint_t radix, const char *radchar,
-			uint_t width, bool_t minus, bool_t padzero, void (*putc)(char))
+convert(LOGBUF *p_logbuf, ULOGPAR val, uint_t radix, const char *radchar,
+							uint_t width, bool_t minus, bool_t padzero)
 {
 	char	buf[CONVERT_BUFLEN];
 	uint_t	i, j;
+	ULOGPAR	q;
 
 	i = 0U;
-	do {
-		buf[i++] = radchar[val % radix];
-		val /= radix;
-	} while (i < CONVERT_BUFLEN && val != 0);
+	if (radix == 16U) {
+		do {
+			buf[i++] = radchar[val & 0x0fU];
+			val >>= 4;
+		} while (val != 0U);
+	}
+	else {
+		do {
+			q = div10(val);
+			buf[i++] = radchar[val - ((q << 3) + (q << 1))];
+			val = q;
+		} while (val != 0U);
+	}
 
 	if (minus && width > 0) {
 		width -= 1;
 	}
 	if (minus && padzero) {
-		(*putc)('-');
+		logbuf_putc(p_logbuf, '-');
 	}
 	for (j = i; j < width; j++) {
-		(*putc)(padzero ? '0' : ' ');
+		logbuf_putc(p_logbuf, padzero ? '0' : ' ');
 	}
 	if (minus && !padzero) {
-		(*putc)('-');
+		logbuf_putc(p_logbuf, '-');
 	}
 	while (i > 0U) {
-		(*putc)(buf[--i]);
+		logbuf_putc(p_logbuf, buf[--i]);
 	}
 }
 
 /*
- *  文字列整形出力
+ *  文字列整形
  */
 static const char raddec[] = "0123456789";
 static const char radhex[] = "0123456789abcdef";
 static const char radHEX[] = "0123456789ABCDEF";
 
-void
-syslog_printf(const char *format, const LOGPAR args[], void (*putc)(char))
+static void
+format_log(LOGBUF *p_logbuf, const char *format, const LOGPAR args[])
 {
 	char		c;
 	uint_t		width;
@@ -102,7 +192,7 @@ syslog_printf(const char *format, const LOGPAR args[], void (*putc)(char))
 	i = 0U;
 	while ((c = *format++) != '\0') {
 		if (c != '%' || i >= TNUM_LOGPAR - 1) {
-			(*putc)(c);
+			logbuf_putc(p_logbuf, c);
 			continue;
 		}
 
@@ -123,38 +213,38 @@ syslog_printf(const char *format, const LOGPAR args[], void (*putc)(char))
 		case 'd':
 			val = args[i++];
 			if (val >= 0) {
-				convert((ULOGPAR) val, 10U, raddec,
-										width, false, padzero, putc);
+				convert(p_logbuf, (ULOGPAR) val, 10U, raddec,
+												width, false, padzero);
 			}
 			else {
-				convert((ULOGPAR)(-val), 10U, raddec,
-										width, true, padzero, putc);
+				convert(p_logbuf, (ULOGPAR)(-val), 10U, raddec,
+												width, true, padzero);
 			}
 			break;
 		case 'u':
-			convert((ULOGPAR) args[i++], 10U, raddec,
-										width, false, padzero, putc);
+			convert(p_logbuf, (ULOGPAR) args[i++], 10U, raddec,
+												width, false, padzero);
 			break;
 		case 'x':
 		case 'p':
-			convert((ULOGPAR) args[i++], 16U, radhex,
-										width, false, padzero, putc);
+			convert(p_logbuf, (ULOGPAR) args[i++], 16U, radhex,
+												width, false, padzero);
 			break;
 		case 'X':
-			convert((ULOGPAR) args[i++], 16U, radHEX,
-										width, false, padzero, putc);
+			convert(p_logbuf, (ULOGPAR) args[i++], 16U, radHEX,
+												width, false, padzero);
 			break;
 		case 'c':
-			(*putc)((char) args[i++]);
+			logbuf_putc(p_logbuf, (char) args[i++]);
 			break;
 		case 's':
 			str = (const char *)(args[i++]);
 			while ((c = *str++) != '\0') {
-				(*putc)(c);
+				logbuf_putc(p_logbuf, c);
 			}
 			break;
 		case '%':
-			(*putc)('%');
+			logbuf_putc(p_logbuf, '%');
 			break;
 		case '\0':
 			format--;
@@ -166,21 +256,21 @@ syslog_printf(const char *format, const LOGPAR args[], void (*putc)(char))
 }
 
 /*
- *  ログ情報の出力
+ *  ログ情報の整形
  */
-void
-syslog_print(const SYSLOG *p_syslog, void (*putc)(char))
+static void
+print_log(LOGBUF *p_logbuf, const SYSLOG *p_syslog)
 {
 	switch (p_syslog->logtype) {
 	case LOG_TYPE_COMMENT:
-		syslog_printf((const char *)(p_syslog->logpar[0]),
-								&(p_syslog->logpar[1]), putc);
-		(*putc)('\n');
+		format_log(p_logbuf, (const char *)(p_syslog->logpar[0]),
+												&(p_syslog->logpar[1]));
+		logbuf_putc(p_logbuf, '\n');
 		break;
 	case LOG_TYPE_ASSERT:
-		syslog_printf("%s:%u: Assertion `%s' failed.",
-								&(p_syslog->logpar[0]), putc);
-		(*putc)('\n');
+		format_log(p_logbuf, "%s:%u: Assertion `%s' failed.",
+												&(p_syslog->logpar[0]));
+		logbuf_putc(p_logbuf, '\n');
 		break;
 	default:
 		/*
@@ -190,15 +280,91 @@ syslog_print(const SYSLOG *p_syslog, void (*putc)(char))
 	}
 }
 
+/*
+ *  ログ情報喪失メッセージの整形
+ */
+static void
+lostmsg_log(LOGBUF *p_logbuf, uint_t lostlog)
+{
+	LOGPAR	lostinfo[1];
+
+	lostinfo[0] = (LOGPAR) lostlog;
+	format_log(p_logbuf, "%d messages are lost.", lostinfo);
+	logbuf_putc(p_logbuf, '\n');
+}
+
+/*
+ *  文字列整形出力
+ */
+void
+syslog_printf(const char *format, const LOGPAR args[], void (*putc)(char))
+{
+	char	buf[LOG_OUTPUT_BUFSZ];
+	LOGBUF	logbuf = { buf, LOG_OUTPUT_BUFSZ, 0U, putc };
+
+	format_log(&logbuf, format, args);
+	logbuf_flush(&logbuf);
+}
+
+/*
+ *  ログ情報の出力
+ */
+void
+syslog_print(const SYSLOG *p_syslog, void (*putc)(char))
+{
+	char	buf[LOG_OUTPUT_BUFSZ];
+	LOGBUF	logbuf = { buf, LOG_OUTPUT_BUFSZ, 0U, putc };
+
+	print_log(&logbuf, p_syslog);
+	logbuf_flush(&logbuf);
+}
+
 /*
  *  ログ情報喪失メッセージの出力
  */
 void
 syslog_lostmsg(uint_t lostlog, void (*putc)(char))
 {
-	LOGPAR	lostinfo[1];
+	char	buf[LOG_OUTPUT_BUFSZ];
+	LOGBUF	logbuf = { buf, LOG_OUTPUT_BUFSZ, 0U, putc };
 
-	lostinfo[0] = (LOGPAR) lostlog;
-	syslog_printf("%d messages are lost.", lostinfo, putc);
-	(*putc)('\n');
+	lostmsg_log(&logbuf, lostlog);
+	logbuf_flush(&logbuf);
+}
+
+/*
+ *  バッファへの文字列整形
+ */
+uint_t
+syslog_sprintf(char *buf, uint_t size, const char *format,
+												const LOGPAR args[])
+{
+	LOGBUF	logbuf = { buf, size, 0U, NULL };
+
+	format_log(&logbuf, format, args);
+	return(logbuf.len);
+}
+
+/*
+ *  バッファへのログ情報の整形
+ */
+uint_t
+syslog_sprint(char *buf, uint_t size, const SYSLOG *p_syslog)
+{
+	LOGBUF	logbuf = { buf, size, 0U, NULL };
+
+	print_log(&logbuf, p_syslog);
+	return(logbuf.len);
+}
+
+/*
+ *  バッファへのログ情報喪失メッセージの整形
+ */
+uint_t
+syslog_slostmsg(char *buf, uint_t size, uint_t lostlog)
+{
+	LOGBUF	logbuf = { buf, size, 0U, NULL };
+
+	lostmsg_log(&logbuf, lostlog);
+	return(logbuf.len);
 }
@@ -0,0 +1,110 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		同期・通信オブジェクト統計出力サービス（非TECS版専用）
+ */
+
+#include <kernel.h>
+#include <t_stdlib.h>
+#include <t_syslog.h>
+#include "target_syssvc.h"
+#include "objmon.h"
+
+/*
+ *  オブジェクト種別の名称
+ */
+static const char *const objmon_name[] = {
+	"sem", "flg", "dtq", "mtx", "mbf", "mpf"
+};
+
+/*
+ *  時間をミリ秒単位に変換
+ */
+#define OBJMON_MSEC(systim)		((uint_t)((systim) / 1000U))
+
+/*
+ *  統計情報を出力するタスクの本体
+ *
+ *  OBJMON_INTERVAL毎に，すべての種別のすべてのオブジェクトについて，
+ *  統計情報を3行に分けて出力する．オブジェクトIDは1から始め，ref_ost
+ *  がエラーを返すまでOBJMON_BATCH個ずつ順に調べる．待ち時間と満杯・
+ *  空であった時間の累計はミリ秒単位で出力する．
+ */
+void
+objmon_task(EXINF exinf)
+{
+	T_ROST		rost[OBJMON_BATCH];
+	uint_t		objtyp, i;
+	ID			objid;
+	ER_UINT		ercd;
+	const char	*name;
+
+	while (true) {
+		(void) dly_tsk(OBJMON_INTERVAL);
+		for (objtyp = TOBJ_SEM; objtyp <= TOBJ_MPF; objtyp++) {
+			name = objmon_name[objtyp - TOBJ_SEM];
+			objid = 1;
+			while ((ercd = ref_ost(objtyp, objid, OBJMON_BATCH, rost)) > 0) {
+				for (i = 0U; i < (uint_t) ercd; i++) {
+					syslog_5(LOG_NOTICE,
+							"objstat: %s %d acq %u wait %u tmout %u",
+							name, objid, (uint_t)(rost[i].acqcnt),
+							(uint_t)(rost[i].wtcnt), (uint_t)(rost[i].tmocnt));
+					syslog_5(LOG_NOTICE,
+							"objstat: %s %d maxq %u maxwt %u us ttlwt %u ms",
+							name, objid, rost[i].maxwtcnt,
+							(uint_t)(rost[i].maxwttim),
+							OBJMON_MSEC(rost[i].ttlwttim));
+					syslog_5(LOG_NOTICE,
+							"objstat: %s %d maxocc %u full %u ms empty %u ms",
+							name, objid, rost[i].maxocc,
+							OBJMON_MSEC(rost[i].ttlfultim),
+							OBJMON_MSEC(rost[i].ttlemptim));
+					objid++;
+				}
+			}
+			if (ercd == E_NOSPT) {
+				syslog_1(LOG_NOTICE, "objstat: ref_ost returns %s.",
+											itron_strerror(ercd));
+				break;
+			}
+		}
+	}
+}
@@ -0,0 +1,87 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		同期・通信オブジェクト統計出力サービス（非TECS版専用）
+ *
+ *  カーネルをUSE_OBJSTATをマクロ定義して構築した場合に，セマフォ，イ
+ *  ベントフラグ，データキュー，ミューテックス，メッセージバッファ，固
+ *  定長メモリプールの統計情報をref_ostで参照し，定期的にシステムログに
+ *  出力する．
+ */
+
+#ifndef TOPPERS_OBJMON_H
+#define TOPPERS_OBJMON_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <kernel.h>
+#include "target_syssvc.h"
+
+/*
+ *  同期・通信オブジェクト統計出力サービス関連の定数のデフォルト値の定義
+ */ 
+#ifndef OBJMON_PRIORITY
+#define OBJMON_PRIORITY			TMAX_TPRI	/* 出力タスクの初期優先度 */
+#endif /* OBJMON_PRIORITY */
+
+#ifndef OBJMON_STACK_SIZE
+#define OBJMON_STACK_SIZE		1024	/* 出力タスクのスタック領域のサイズ */
+#endif /* OBJMON_STACK_SIZE */
+
+#ifndef OBJMON_INTERVAL
+#define OBJMON_INTERVAL			10000000U	/* 出力の周期（マイクロ秒）*/
+#endif /* OBJMON_INTERVAL */
+
+#ifndef OBJMON_BATCH
+#define OBJMON_BATCH			4U		/* 1回のref_ostで参照する数 */
+#endif /* OBJMON_BATCH */
+
+/*
+ *  統計情報を出力するタスクの本体
+ */
+extern void	objmon_task(EXINF exinf) throw();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOPPERS_OBJMON_H */
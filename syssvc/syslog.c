@@ -44,6 +44,7 @@
  *		システムログ機能（非TECS版専用）
  */
 
+#include <kernel.h>
 #include <sil.h>
 #undef TOPPERS_OMIT_SYSLOG
 #include <t_syslog.h>
@@ -58,6 +59,21 @@
 #define TCNT_SYSLOG_BUFFER	32		/* ログバッファのサイズ */
 #endif /* TCNT_SYSLOG_BUFFER */
 
+/*
+ *  システムログタスクを起床するしきい値
+ *
+ *  ログバッファ中のログの数がSYSLOG_NOTIFY_COUNTに達した時と，重要度
+ *  がSYSLOG_NOTIFY_PRIORITY以上のログ情報を記録した時に，登録されたシ
+ *  ステムログタスクを起床する．
+ */
+#ifndef SYSLOG_NOTIFY_COUNT
+#define SYSLOG_NOTIFY_COUNT		((TCNT_SYSLOG_BUFFER + 1U) / 2U)
+#endif /* SYSLOG_NOTIFY_COUNT */
+
+#ifndef SYSLOG_NOTIFY_PRIORITY
+#define SYSLOG_NOTIFY_PRIORITY	LOG_ERROR
+#endif /* SYSLOG_NOTIFY_PRIORITY */
+
 /*
  *  トレースログマクロのデフォルト定義
  *
@@ -97,6 +113,11 @@ static uint_t	syslog_lost;			/* 失われたログの数 */
 static uint_t	syslog_logmask;			/* ログバッファに記録すべき重要度 */
 static uint_t	syslog_lowmask_not;		/* 低レベル出力すべき重要度（反転）*/
 
+/*
+ *  ログ情報の記録を通知するタスク
+ */
+static ID		syslog_ntf_tskid;		/* 起床するタスクのID */
+
 /*
  *  システムログ機能の初期化
  */
@@ -109,8 +130,22 @@ syslog_initialize(EXINF exinf)
 	syslog_lost = 0U;
 	syslog_logmask = 0U;
 	syslog_lowmask_not = 0U;
+	syslog_ntf_tskid = TSK_NONE;
 }     
 
+/*
+ *  ログ情報の記録を通知するタスクの登録
+ */
+void
+_syslog_set_ntf(ID tskid)
+{
+	SIL_PRE_LOC;
+
+	SIL_LOC_INT();
+	syslog_ntf_tskid = tskid;
+	SIL_UNL_INT();
+}
+
 /* 
  *  ログ情報の出力
  *
@@ -119,6 +154,8 @@ syslog_initialize(EXINF exinf)
 ER
 _syslog_wri_log(uint_t prio, const SYSLOG *p_syslog)
 {
+	uint_t	ntfcnt = 0U;
+	ID		tskid;
 	SIL_PRE_LOC;
 
 	LOG_SYSLOG_WRI_LOG_ENTER(prio, p_syslog);
@@ -142,6 +179,22 @@ _syslog_wri_log(uint_t prio, const SYSLOG *p_syslog)
 			syslog_head = syslog_tail;
 			syslog_lost++;
 		}
+
+		/*
+		 *  システムログタスクを起床する回数の決定
+		 *
+		 *  空のログバッファに記録した時には，待ち状態のシステムログタ
+		 *  スクを動作させるために1回起床する．ログの数がしきい値に達
+		 *  した時や，重要度の高いログ情報の時には，まとめて出力するた
+		 *  めの待ちを打ち切らせるために，さらに1回起床する．
+		 */
+		if (syslog_count == 1U) {
+			ntfcnt++;
+		}
+		if (syslog_count == SYSLOG_NOTIFY_COUNT
+								|| prio <= SYSLOG_NOTIFY_PRIORITY) {
+			ntfcnt++;
+		}
 	}
 
 	/*
@@ -155,7 +208,23 @@ _syslog_wri_log(uint_t prio, const SYSLOG *p_syslog)
 		syslog_print(&logbuf, target_fput_log);
 	}
 
+	tskid = syslog_ntf_tskid;
 	SIL_UNL_INT();
+
+	/*
+	 *  システムログタスクの起床
+	 *
+	 *  カーネルの動作中で，CPUロック状態でない場合にのみ起床する．起
+	 *  床要求がキューイングされている場合のエラーは無視する．起床しな
+	 *  かった場合も，システムログタスクは待ち時間の上限でログバッファ
+	 *  を調べ直すため，記録したログ情報が出力されずに残ることはない．
+	 */
+	if (ntfcnt > 0U && tskid != TSK_NONE && !sns_ker() && !sns_loc()) {
+		while (ntfcnt > 0U) {
+			(void) wup_tsk(tskid);
+			ntfcnt--;
+		}
+	}
 	return(E_OK);
 }
 
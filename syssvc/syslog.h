@@ -123,6 +123,13 @@ extern ER		_syslog_fls_log(void) throw();
  */
 extern void	syslog_initialize(EXINF exinf) throw();
 
+/*
+ *  ログ情報の記録を通知するタスクの登録
+ *
+ *  システムログタスクが，自タスクのIDを登録するために呼び出す．
+ */
+extern void	_syslog_set_ntf(ID tskid) throw();
+
 /*
  *  システムログ機能のサービスコールを呼び出すための定義
  */
@@ -49,12 +49,27 @@
 #include <log_output.h>
 
 /*
- *  シリアルインタフェースへの1文字出力
+ *  出力バッファの内容のシリアルインタフェースへの出力
+ */
+static void
+logtask_output(void)
+{
+	if (VAR_outputCount > 0U) {
+		(void) cSerialPort_write(VAR_outputBuffer, VAR_outputCount);
+		VAR_outputCount = 0U;
+	}
+}
+
+/*
+ *  出力バッファへの1文字出力
  */
 static void
 logtask_putc(char c)
 {
-	cSerialPort_write(&c, 1);
+	VAR_outputBuffer[VAR_outputCount++] = c;
+	if (VAR_outputCount >= ATTR_outputBufferSize) {
+		logtask_output();
+	}
 }
 
 /*
@@ -66,6 +81,35 @@ target_fput_log(char c)
 	cPutLog_putChar(c);
 }
 
+/*
+ *  ログ情報の出力バッファへの整形
+ *
+ *  出力バッファの残りに入り切らない可能性がある場合には，出力バッファ
+ *  の内容を出力してから整形し直す．出力バッファ全体にも入り切らない場
+ *  合には，1文字ずつ出力バッファに格納する．
+ */
+static void
+logtask_format(const SYSLOG *p_syslog)
+{
+	uint_t	len;
+
+	len = syslog_sprint(&(VAR_outputBuffer[VAR_outputCount]),
+							ATTR_outputBufferSize - VAR_outputCount, p_syslog);
+	if (VAR_outputCount + len < ATTR_outputBufferSize) {
+		VAR_outputCount += len;
+	}
+	else {
+		logtask_output();
+		len = syslog_sprint(VAR_outputBuffer, ATTR_outputBufferSize, p_syslog);
+		if (len < ATTR_outputBufferSize) {
+			VAR_outputCount = len;
+		}
+		else {
+			syslog_print(p_syslog, logtask_putc);
+		}
+	}
+}
+
 /*
  *  システムログ出力の待ち合わせ（受け口関数）
  */
@@ -80,6 +124,14 @@ eLogTask_flush(uint_t count)
 		ercd = E_CTX;
 	}
 	else {
+		/*
+		 *  まとめて出力するための待ちを打ち切らせるために，システム
+		 *  ログタスクを起床する．
+		 */
+		if (VAR_taskId != TSK_NONE) {
+			(void) wup_tsk(VAR_taskId);
+		}
+
 		while (true) {
 			if (cSysLog_refer(&rlog) < 0) {
 				ercd = E_SYS;
@@ -127,20 +179,46 @@ eLogTask_flush(uint_t count)
 void
 eLogTaskBody_main(void)
 {
-	SYSLOG	syslog;
-	ER_UINT	rercd;
+	SYSLOG			syslog;
+	T_SYSLOG_RLOG	rlog;
+	ER_UINT			rercd;
 
 	cSerialPort_open();
+	(void) get_tid(&VAR_taskId);
+	(void) cSysLog_setNotify(VAR_taskId);
 	syslog_0(LOG_NOTICE, "System logging task is started.");
 
 	while (true) {
+		/*
+		 *  ログバッファが空の間は，システムログ機能から起床されるまで
+		 *  待つ．カーネルの起動前やCPUロック状態で記録されたログ情報
+		 *  では起床されないため，待ち時間を最大ATTR_intervalμ秒に制限し，
+		 *  ログバッファを調べ直す．
+		 */
+		(void) cSysLog_refer(&rlog);
+		while (rlog.count == 0U) {
+			(void) tslp_tsk(ATTR_interval);
+			(void) cSysLog_refer(&rlog);
+		}
+
+		/*
+		 *  ログ情報をまとめて出力するために，ログの数がしきい値に達す
+		 *  るか，重要度の高いログ情報が記録されて起床されるまで，最大
+		 *  ATTR_intervalμ秒待つ．
+		 */
+		(void) tslp_tsk(ATTR_interval);
+
+		/*
+		 *  ログバッファ中のすべてのログ情報を出力バッファに整形し，ま
+		 *  とめて出力する．
+		 */
 		while ((rercd = cSysLog_read(&syslog)) >= 0) {
 			if (((uint_t) rercd) > 0U) {
 				syslog_lostmsg((uint_t) rercd, logtask_putc);
 			}
-			syslog_print(&syslog, logtask_putc);
+			logtask_format(&syslog);
 		}
-		(void) dly_tsk(ATTR_interval);
+		logtask_output();
 	}
 }
 
@@ -151,6 +229,7 @@ void
 eLogTaskTerminate_main(EXINF exinf)
 {
 	char	c;
+	uint_t	i;
 	SYSLOG	syslog;
 	bool_t	msgflg = false;
 	ER_UINT	rercd;
@@ -163,6 +242,15 @@ eLogTaskTerminate_main(EXINF exinf)
 		target_fput_log(c);
 	}
 
+	/*
+	 *  出力バッファに残ったデータを，低レベル出力機能を用いて出力す
+	 *  る．
+	 */
+	for (i = 0U; i < VAR_outputCount; i++) {
+		target_fput_log(VAR_outputBuffer[i]);
+	}
+	VAR_outputCount = 0U;
+
 	/*
 	 *  ログバッファに記録されたログ情報を，低レベル出力機能を用いて出
 	 *  力する．
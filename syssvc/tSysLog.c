@@ -43,6 +43,7 @@
  *		システムログ機能
  */
 
+#include <kernel.h>
 #include <sil.h>
 #include "tSysLog_tecsgen.h"
 #undef TOPPERS_OMIT_SYSLOG
@@ -85,6 +86,14 @@
 				(*(p_logtim) = _kernel_target_hrt_get_current())
 #endif /* SYSLOG_GET_LOGTIM */
 
+/*
+ *  システムログタスクを起床するログの数
+ *
+ *  notifyCount属性が0の場合には，ログバッファサイズの半分とする．
+ */
+#define NOTIFY_COUNT	((ATTR_notifyCount > 0U) ? ATTR_notifyCount \
+										: (ATTR_logBufferSize + 1U) / 2U)
+
 /*
  *  低レベル出力の呼出し関数
  */
@@ -102,6 +111,8 @@ low_putchar(char c)
 ER
 eSysLog_write(uint_t priority, const SYSLOG *p_syslog)
 {
+	uint_t	ntfcnt = 0U;
+	ID		tskid;
 	SIL_PRE_LOC;
 
 	LOG_TSYSLOG_ESYSLOG_WRITE_ENTER(priority, p_syslog);
@@ -125,6 +136,21 @@ eSysLog_write(uint_t priority, const SYSLOG *p_syslog)
 			VAR_head = VAR_tail;
 			VAR_lost++;
 		}
+
+		/*
+		 *  システムログタスクを起床する回数の決定
+		 *
+		 *  空のログバッファに記録した時には，待ち状態のシステムログタ
+		 *  スクを動作させるために1回起床する．ログの数がしきい値に達
+		 *  した時や，重要度の高いログ情報の時には，まとめて出力するた
+		 *  めの待ちを打ち切らせるために，さらに1回起床する．
+		 */
+		if (VAR_count == 1U) {
+			ntfcnt++;
+		}
+		if (VAR_count == NOTIFY_COUNT || priority <= ATTR_notifyPriority) {
+			ntfcnt++;
+		}
 	}
 
 	/*
@@ -138,7 +164,23 @@ eSysLog_write(uint_t priority, const SYSLOG *p_syslog)
 		syslog_print(&logbuf, low_putchar);
 	}
 
+	tskid = VAR_notifyTask;
 	SIL_UNL_INT();
+
+	/*
+	 *  システムログタスクの起床
+	 *
+	 *  カーネルの動作中で，CPUロック状態でない場合にのみ起床する．起
+	 *  床要求がキューイングされている場合のエラーは無視する．起床しな
+	 *  かった場合も，システムログタスクは待ち時間の上限でログバッファ
+	 *  を調べ直すため，記録したログ情報が出力されずに残ることはない．
+	 */
+	if (ntfcnt > 0U && tskid != TSK_NONE && !sns_ker() && !sns_loc()) {
+		while (ntfcnt > 0U) {
+			(void) wup_tsk(tskid);
+			ntfcnt--;
+		}
+	}
 	return(E_OK);
 }
 
@@ -230,3 +272,17 @@ eSysLog_flush(void)
 	SIL_UNL_INT();
 	return(E_OK);
 }
+
+/*
+ *  ログ情報の記録を通知するタスクの登録（受け口関数）
+ */
+ER
+eSysLog_setNotify(ID taskId)
+{
+	SIL_PRE_LOC;
+
+	SIL_LOC_INT();
+	VAR_notifyTask = taskId;
+	SIL_UNL_INT();
+	return(E_OK);
+}
@@ -49,6 +49,12 @@
 #define FREQ_CMTW0      (7500000UL)   /* 7.5MHz */
 #define FREQ_CMTW1      (7500000UL)   /* 7.5MHz */
 
+/*
+ *  CMTW0/1のクロック選択（CMWCR.CKS）
+ *  FREQ_CMTW0/1に合わせて設定する．
+ */
+#define CMTW_DEFAULT_CKS  (0) /* PCLK / 8 */
+
 /*
  *  UARTデフォルト設定
  *  フォーマットは8N1に固定 (prc_serial.c)
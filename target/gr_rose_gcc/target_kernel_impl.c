@@ -119,8 +119,13 @@ hardware_init_hook(void)
 	sil_wrh_mem((void *)SYSTEM_PRCR_ADDR, SYSTEM_PRCR_PRKEY_BITS);
 
 	/* Set CMTW0/1.CMWCR.CTS to match FREQ_CMTW0/1 */
-	sil_wrh_mem((void *)CMTW0_CMWCR_ADDR, (0x0 << CMTWn_CMWCR_CKS_SHIFT));
-	sil_wrh_mem((void *)CMTW1_CMWCR_ADDR, (0x0 << CMTWn_CMWCR_CKS_SHIFT));
+	sil_wrh_mem((void *)CMTW0_CMWCR_ADDR, (CMTW_DEFAULT_CKS << CMTWn_CMWCR_CKS_SHIFT));
+	sil_wrh_mem((void *)CMTW1_CMWCR_ADDR, (CMTW_DEFAULT_CKS << CMTWn_CMWCR_CKS_SHIFT));
+
+#ifdef TOPPERS_BOOT_PROFILE
+	/* カーネル起動時間の計測の開始 */
+	prc_start_boot_profile();
+#endif /* TOPPERS_BOOT_PROFILE */
 
 #else
 #error Must modify code above if target frequencies are changed.
@@ -55,6 +55,10 @@
 #define TSTEP_HRTCNT (1U)
 #define HRTCNT_TO_CMWCNT(hrtcnt) ((hrtcnt) * 7U + (hrtcnt) / 2U)
 #define CMWCNT_TO_HRTCNT(cmwcnt) ((((cmwcnt) / 3U) * 2U) / 5U)
+/*
+ *  CMWCNT_TO_HRTCNTで変換した値がhrtcnt以上になる最小のCMWCNTの値
+ */
+#define HRTCNT_TO_CMWCNT_CEIL(hrtcnt) ((((hrtcnt) * 5U + 1U) / 2U) * 3U)
 #else
 #error Must modify definitions above if FREQ_CMTW0 is changed.
 #endif
@@ -0,0 +1,203 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		ホスト上での単体テスト用のカーネルサービスコール
+ *
+ *  シリアルドライバが用いるサービスコールを，レジスタモデルと組み合わ
+ *  せて模擬する．タスクは1つのみとし，wai_semで待つ間は，セマフォが返
+ *  却されるまでレジスタモデルの時間を進める．
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "kernel_cfg.h"
+#include "sim_rx65n.h"
+
+/*
+ *  待ち状態で進める時間の上限（文字数）
+ */
+#define SIM_WAIT_LIMIT	1024U
+
+/*
+ *  セマフォ（syssvc/serial.cfgと同じ初期値と最大値）
+ */
+static const struct {
+	uint_t	isemcnt;
+	uint_t	maxsem;
+} seminib_table[TNUM_SEMID] = {
+	{ 0U, 1U }, { 1U, 1U }, { 0U, 1U }, { 1U, 1U }
+};
+
+static uint_t	semcnt_table[TNUM_SEMID];
+
+#define VALID_SEMID(semid)	(1 <= (semid) && (semid) <= TNUM_SEMID)
+#define INDEX_SEM(semid)	((uint_t)((semid) - 1))
+
+/*
+ *  セマフォの初期化と参照
+ */
+void
+sim_kernel_reset(void)
+{
+	uint_t	i;
+
+	for (i = 0U; i < TNUM_SEMID; i++) {
+		semcnt_table[i] = seminib_table[i].isemcnt;
+	}
+}
+
+uint_t
+sim_semcnt(ID semid)
+{
+	return(semcnt_table[INDEX_SEM(semid)]);
+}
+
+ER
+sig_sem(ID semid)
+{
+	if (!VALID_SEMID(semid)) {
+		return(E_ID);
+	}
+	if (semcnt_table[INDEX_SEM(semid)]
+							== seminib_table[INDEX_SEM(semid)].maxsem) {
+		return(E_QOVR);
+	}
+	semcnt_table[INDEX_SEM(semid)]++;
+	return(E_OK);
+}
+
+ER
+wai_sem(ID semid)
+{
+	uint_t	count = 0U;
+
+	if (!VALID_SEMID(semid)) {
+		return(E_ID);
+	}
+	if (sim_sns_isr() || sim_sns_lock()) {
+		return(E_CTX);
+	}
+	while (semcnt_table[INDEX_SEM(semid)] == 0U) {
+		if (++count > SIM_WAIT_LIMIT) {
+			return(E_TMOUT);
+		}
+		sim_step();
+	}
+	semcnt_table[INDEX_SEM(semid)]--;
+	return(E_OK);
+}
+
+ER
+ini_sem(ID semid)
+{
+	if (!VALID_SEMID(semid)) {
+		return(E_ID);
+	}
+	semcnt_table[INDEX_SEM(semid)] = seminib_table[INDEX_SEM(semid)].isemcnt;
+	return(E_OK);
+}
+
+/*
+ *  CPUロック状態とディスパッチ禁止状態
+ */
+ER
+loc_cpu(void)
+{
+	sim_set_lock(true);
+	return(E_OK);
+}
+
+ER
+unl_cpu(void)
+{
+	sim_set_lock(false);
+	return(E_OK);
+}
+
+ER
+dis_dsp(void)
+{
+	return(E_OK);
+}
+
+ER
+ena_dsp(void)
+{
+	return(E_OK);
+}
+
+bool_t
+sns_dpn(void)
+{
+	return(sim_sns_isr() || sim_sns_lock());
+}
+
+/*
+ *  割込み要求禁止フラグの操作
+ */
+ER
+dis_int(INTNO intno)
+{
+	sim_set_ier(intno, false);
+	return(E_OK);
+}
+
+ER
+ena_int(INTNO intno)
+{
+	sim_set_ier(intno, true);
+	return(E_OK);
+}
+
+/*
+ *  システムログ
+ *
+ *  ドライバがシステムログに出力するのはアサーションの失敗のみである．
+ */
+ER
+_syslog_wri_log(uint_t prio, const SYSLOG *p_syslog)
+{
+	if (p_syslog->logtype == LOG_TYPE_ASSERT) {
+		sim_fail((const char *)(p_syslog->logpar[0]),
+					(int_t)(p_syslog->logpar[1]),
+					(const char *)(p_syslog->logpar[2]));
+	}
+	return(E_OK);
+}
@@ -0,0 +1,584 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		RX65NのSCI1/ICU/DTCのレジスタモデル
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sil.h>
+#include "rx65n.h"
+#include "sim_rx65n.h"
+
+/*
+ *  I/O領域の番地
+ */
+#define IOREG(addr)		((uint32_t)(uintptr_t)(addr))
+#define IS_IOREG(addr)	(SIM_IOREG_BASE <= (addr) && (addr) < SIM_IOREG_LIMIT)
+
+#define SCI1_TDR		IOREG(SCI1_TDR_ADDR)
+#define SCI1_SSR		IOREG(SCI1_SSR_ADDR)
+#define SCI1_RDR		IOREG(SCI1_RDR_ADDR)
+#define SCI1_SCR		IOREG(SCI1_SCR_ADDR)
+#define ICU_IR(no)		IOREG(ICU_IRn_ADDR(no))
+#define ICU_DTCER(no)	IOREG(ICU_DTCERn_ADDR(no))
+#define DTC_DTCVBR		IOREG(DTC_DTCVBR_ADDR)
+#define DTC_DTCST		IOREG(DTC_DTCST_ADDR)
+
+#define SSR_ERROR_BITS	0x38U			/* ORER，FER，PER */
+
+/*
+ *  割込み番号の数
+ */
+#define TNUM_SIM_INTNO	256U
+
+/*
+ *  送信した文字を記録するバッファのサイズ
+ */
+#define SIM_OUTPUT_SIZE	1024U
+
+/*
+ *  DTCがアクセスするメモリ領域の最大数
+ */
+#define TNUM_SIM_MAP	8U
+
+/*
+ *  I/O領域のバッキングストア
+ *
+ *  特別な動作を持たないレジスタは，書き込まれた値をそのまま保持する．
+ *  IR，DTCER，SSRなども値はここに置き，書込み時の動作のみを模擬する．
+ */
+static uint8_t	ioreg[SIM_IOREG_LIMIT - SIM_IOREG_BASE];
+
+#define REG(addr)		(ioreg[(addr) - SIM_IOREG_BASE])
+
+/*
+ *  モデルの内部状態
+ */
+static bool_t	ier[TNUM_SIM_INTNO];		/* 割込み要求許可（IER） */
+static ISR		isr_table[TNUM_SIM_INTNO];	/* 割込みサービスルーチン */
+static EXINF	exinf_table[TNUM_SIM_INTNO];
+
+static bool_t	tsr_busy;					/* 送信シフトレジスタが使用中 */
+static uint8_t	tsr;						/* 送信シフトレジスタ */
+
+static bool_t	cpu_locked;					/* CPUロック状態 */
+static bool_t	in_isr;						/* 割込みサービスルーチン実行中 */
+static bool_t	in_dtc;						/* DTCの起動処理中 */
+
+static char		output[SIM_OUTPUT_SIZE + 1];
+static uint_t	output_len;
+static uint_t	dtc_count;
+
+static struct {
+	const void	*base;
+	size_t		size;
+} map_table[TNUM_SIM_MAP];
+static uint_t	map_count;
+
+static void	sim_update(void);
+static uint8_t	ioreg_read(uint32_t addr);
+static void	ioreg_write(uint32_t addr, uint8_t data);
+
+/*
+ *  テストの失敗
+ */
+void
+sim_fail(const char *file, int_t line, const char *msg)
+{
+	fprintf(stderr, "%s:%d: %s\n", file, line, msg);
+	exit(EXIT_FAILURE);
+}
+
+#define SIM_FAIL(msg)	sim_fail(__FILE__, __LINE__, (msg))
+
+/*
+ *  モデルの初期化
+ */
+void
+sim_reset(void)
+{
+	memset(ioreg, 0, sizeof(ioreg));
+	memset(ier, 0, sizeof(ier));
+	memset(isr_table, 0, sizeof(isr_table));
+	memset(exinf_table, 0, sizeof(exinf_table));
+	tsr_busy = false;
+	cpu_locked = false;
+	in_isr = false;
+	in_dtc = false;
+	output_len = 0U;
+	output[0] = '\0';
+	dtc_count = 0U;
+	map_count = 0U;
+
+	REG(SCI1_SSR) = (uint8_t)(SCIn_SSR_TDRE_BIT | SCIn_SSR_TEND_BIT);
+}
+
+/*
+ *  DTCがアクセスするメモリ領域の登録
+ */
+void
+sim_map(const void *base, size_t size)
+{
+	if (map_count == TNUM_SIM_MAP) {
+		SIM_FAIL("too many mapped regions");
+	}
+	map_table[map_count].base = base;
+	map_table[map_count].size = size;
+	map_count++;
+}
+
+/*
+ *  DTCから見た32ビットの番地をホストのポインタに変換する
+ */
+static void *
+sim_xlate(uint32_t addr, size_t size)
+{
+	uint_t		i;
+	uint32_t	base;
+
+	for (i = 0U; i < map_count; i++) {
+		base = (uint32_t)(uintptr_t)(map_table[i].base);
+		if (base <= addr && addr - base + size <= map_table[i].size) {
+			return((char *)(map_table[i].base) + (addr - base));
+		}
+	}
+	SIM_FAIL("DTC accessed an unmapped address");
+	return(NULL);
+}
+
+/*
+ *  割込みサービスルーチンの登録
+ */
+void
+sim_att_isr(INTNO intno, ISR isr, EXINF exinf)
+{
+	isr_table[intno] = isr;
+	exinf_table[intno] = exinf;
+}
+
+/*
+ *  割込み要求の発生
+ *
+ *  IRは，割込み要求を保持するラッチである．IERが禁止されていても，要
+ *  求は保持される．
+ */
+static void
+sim_request(INTNO intno)
+{
+	REG(ICU_IR(intno)) = 1U;
+	sim_update();
+}
+
+/*
+ *  送信データレジスタから送信シフトレジスタへの転送
+ *
+ *  TDREがセットされ，TIEが許可されていればTXIが発生する．
+ */
+static void
+sci1_load_tsr(void)
+{
+	tsr = REG(SCI1_TDR);
+	tsr_busy = true;
+	REG(SCI1_SSR) |= (uint8_t) SCIn_SSR_TDRE_BIT;
+	if ((REG(SCI1_SCR) & SCIn_SCR_TIE_BIT) != 0U) {
+		sim_request(INT_TXI1);
+	}
+}
+
+/*
+ *  DTCによる1回の転送（ノーマル転送モード，フルアドレスモード）
+ *
+ *  転送情報は，MRA/MRB，SAR，DAR，CRA/CRBの4ロングワードである．最後
+ *  の転送を終えるとDTCERをクリアし，CPUへの割込み要求とする．
+ */
+static void
+dtc_transfer(INTNO intno)
+{
+	uint32_t	vbr, *p_vector, *p_info;
+	uint32_t	sar, dar, cra;
+	uint8_t		data;
+
+	vbr = (uint32_t) REG(DTC_DTCVBR)
+			| (uint32_t) REG(DTC_DTCVBR + 1U) << 8
+			| (uint32_t) REG(DTC_DTCVBR + 2U) << 16
+			| (uint32_t) REG(DTC_DTCVBR + 3U) << 24;
+	p_vector = sim_xlate(vbr + intno * 4U, sizeof(uint32_t));
+	p_info = sim_xlate(*p_vector, sizeof(uint32_t) * 4U);
+
+	/*
+	 *  ドライバが用いる転送モード（ソース加算，デスティネーション固定，
+	 *  バイト転送，チェーン転送なし）のみを模擬する．
+	 */
+	if (p_info[0] != ((uint32_t) DTC_MRA_SM_INC << 24)) {
+		SIM_FAIL("unsupported DTC transfer mode");
+	}
+	sar = p_info[1];
+	dar = p_info[2];
+	cra = p_info[3] >> 16;
+
+	if (IS_IOREG(sar)) {
+		data = ioreg_read(sar);
+	}
+	else {
+		data = *((uint8_t *) sim_xlate(sar, 1U));
+	}
+	if (IS_IOREG(dar)) {
+		ioreg_write(dar, data);
+	}
+	else {
+		*((uint8_t *) sim_xlate(dar, 1U)) = data;
+	}
+	dtc_count++;
+
+	cra = (cra - 1U) & 0xffffU;
+	p_info[1] = sar + 1U;
+	p_info[3] = (p_info[3] & 0xffffU) | cra << 16;
+	if (cra == 0U) {
+		REG(ICU_DTCER(intno)) &= (uint8_t) ~ICU_DTCERn_DTCE_BIT;
+		REG(ICU_IR(intno)) = 1U;
+	}
+}
+
+/*
+ *  割込み要求の処理
+ *
+ *  IRとIERがセットされた要求は，DTCERがセットされていればDTCを起動し，
+ *  そうでなければCPUに割込みをかける．DTCはCPUロック状態でも起動され，
+ *  CPUへの割込みは，CPUロック状態と割込みサービスルーチンの実行中に
+ *  は保留される．同じ割込み優先度の要求は，割込み番号の小さい方から受
+ *  け付ける．
+ */
+static void
+sim_update(void)
+{
+	INTNO	intno;
+	bool_t	progress;
+
+	if (in_dtc) {
+		return;
+	}
+	in_dtc = true;
+	do {
+		progress = false;
+		for (intno = 0U; intno < TNUM_SIM_INTNO; intno++) {
+			if (REG(ICU_IR(intno)) != 0U && ier[intno]
+					&& (REG(ICU_DTCER(intno)) & ICU_DTCERn_DTCE_BIT) != 0U
+					&& (REG(DTC_DTCST) & DTC_DTCST_DTCST_BIT) != 0U) {
+				REG(ICU_IR(intno)) = 0U;
+				dtc_transfer(intno);
+				progress = true;
+			}
+		}
+	} while (progress);
+	in_dtc = false;
+
+	while (!cpu_locked && !in_isr) {
+		for (intno = 0U; intno < TNUM_SIM_INTNO; intno++) {
+			if (REG(ICU_IR(intno)) != 0U && ier[intno]
+					&& (REG(ICU_DTCER(intno)) & ICU_DTCERn_DTCE_BIT) == 0U
+					&& isr_table[intno] != NULL) {
+				break;
+			}
+		}
+		if (intno == TNUM_SIM_INTNO) {
+			break;
+		}
+		REG(ICU_IR(intno)) = 0U;
+		in_isr = true;
+		(*isr_table[intno])(exinf_table[intno]);
+		in_isr = false;
+	}
+}
+
+/*
+ *  I/O領域の読出し
+ */
+static uint8_t
+ioreg_read(uint32_t addr)
+{
+	uint8_t	data = REG(addr);
+
+	if (addr == SCI1_RDR) {
+		REG(SCI1_SSR) &= (uint8_t) ~SCIn_SSR_RDRF_BIT;
+	}
+	return(data);
+}
+
+/*
+ *  I/O領域への書込み
+ */
+static void
+ioreg_write(uint32_t addr, uint8_t data)
+{
+	uint8_t	old = REG(addr);
+
+	if (addr == SCI1_SSR) {
+		/*
+		 *  SSRは，エラーフラグを0にクリアすることのみができる．
+		 */
+		REG(addr) = (uint8_t)((old & ~SSR_ERROR_BITS)
+										| (old & data & SSR_ERROR_BITS));
+	}
+	else if (addr == SCI1_TDR) {
+		REG(addr) = data;
+		REG(SCI1_SSR) &= (uint8_t) ~(SCIn_SSR_TDRE_BIT | SCIn_SSR_TEND_BIT);
+		if (!tsr_busy) {
+			sci1_load_tsr();
+		}
+	}
+	else if (addr == SCI1_SCR) {
+		REG(addr) = data;
+		/*
+		 *  TIEとTEを許可した時点でTDREがセットされていれば，TXIが発生
+		 *  する．
+		 */
+		if ((old & SCIn_SCR_TIE_BIT) == 0U
+				&& (data & (SCIn_SCR_TIE_BIT | SCIn_SCR_TE_BIT))
+							== (SCIn_SCR_TIE_BIT | SCIn_SCR_TE_BIT)
+				&& (REG(SCI1_SSR) & SCIn_SSR_TDRE_BIT) != 0U) {
+			sim_request(INT_TXI1);
+		}
+	}
+	else {
+		REG(addr) = data;
+	}
+	sim_update();
+}
+
+/*
+ *  システムインタフェースレイヤのアクセス関数
+ */
+uint8_t
+sil_reb_mem(const uint8_t *mem)
+{
+	uint32_t	addr = IOREG(mem);
+
+	if (IS_IOREG(addr)) {
+		return(ioreg_read(addr));
+	}
+	return(*mem);
+}
+
+void
+sil_wrb_mem(uint8_t *mem, uint8_t data)
+{
+	uint32_t	addr = IOREG(mem);
+
+	if (IS_IOREG(addr)) {
+		ioreg_write(addr, data);
+	}
+	else {
+		*mem = data;
+	}
+}
+
+uint16_t
+sil_reh_mem(const uint16_t *mem)
+{
+	uint32_t	addr = IOREG(mem);
+
+	if (IS_IOREG(addr)) {
+		return((uint16_t)(ioreg_read(addr)
+							| (uint16_t) ioreg_read(addr + 1U) << 8));
+	}
+	return(*mem);
+}
+
+void
+sil_wrh_mem(uint16_t *mem, uint16_t data)
+{
+	uint32_t	addr = IOREG(mem);
+
+	if (IS_IOREG(addr)) {
+		ioreg_write(addr, (uint8_t) data);
+		ioreg_write(addr + 1U, (uint8_t)(data >> 8));
+	}
+	else {
+		*mem = data;
+	}
+}
+
+uint32_t
+sil_rew_mem(const uint32_t *mem)
+{
+	uint32_t	addr = IOREG(mem);
+
+	if (IS_IOREG(addr)) {
+		return((uint32_t) ioreg_read(addr)
+					| (uint32_t) ioreg_read(addr + 1U) << 8
+					| (uint32_t) ioreg_read(addr + 2U) << 16
+					| (uint32_t) ioreg_read(addr + 3U) << 24);
+	}
+	return(*mem);
+}
+
+void
+sil_wrw_mem(uint32_t *mem, uint32_t data)
+{
+	uint32_t	addr = IOREG(mem);
+
+	if (IS_IOREG(addr)) {
+		ioreg_write(addr, (uint8_t) data);
+		ioreg_write(addr + 1U, (uint8_t)(data >> 8));
+		ioreg_write(addr + 2U, (uint8_t)(data >> 16));
+		ioreg_write(addr + 3U, (uint8_t)(data >> 24));
+	}
+	else {
+		*mem = data;
+	}
+}
+
+/*
+ *  1文字の送信時間だけ時間を進める
+ */
+void
+sim_step(void)
+{
+	if (tsr_busy) {
+		if (output_len == SIM_OUTPUT_SIZE) {
+			SIM_FAIL("output log overflow");
+		}
+		output[output_len++] = (char) tsr;
+		output[output_len] = '\0';
+		tsr_busy = false;
+		if ((REG(SCI1_SSR) & SCIn_SSR_TDRE_BIT) == 0U) {
+			sci1_load_tsr();
+		}
+		else {
+			REG(SCI1_SSR) |= (uint8_t) SCIn_SSR_TEND_BIT;
+		}
+	}
+	sim_update();
+}
+
+/*
+ *  送信が完了するまで時間を進める
+ */
+uint_t
+sim_run(void)
+{
+	uint_t	count = 0U;
+
+	while (tsr_busy || (REG(SCI1_SSR) & SCIn_SSR_TDRE_BIT) == 0U) {
+		if (++count > SIM_OUTPUT_SIZE) {
+			SIM_FAIL("transmission did not complete");
+		}
+		sim_step();
+	}
+	return(count);
+}
+
+/*
+ *  SCI1での1文字の受信
+ */
+void
+sim_receive(char c)
+{
+	REG(SCI1_RDR) = (uint8_t) c;
+	REG(SCI1_SSR) |= (uint8_t) SCIn_SSR_RDRF_BIT;
+	if ((REG(SCI1_SCR) & SCIn_SCR_RIE_BIT) != 0U) {
+		sim_request(INT_RXI1);
+	}
+}
+
+/*
+ *  送信された文字列の参照
+ */
+const char *
+sim_output(void)
+{
+	return(output);
+}
+
+void
+sim_clear_output(void)
+{
+	output_len = 0U;
+	output[0] = '\0';
+}
+
+/*
+ *  DTCによる転送回数の参照
+ */
+uint_t
+sim_dtc_count(void)
+{
+	return(dtc_count);
+}
+
+/*
+ *  割込み要求の許可状態
+ */
+bool_t
+sim_int_enabled(INTNO intno)
+{
+	return(ier[intno]);
+}
+
+void
+sim_set_ier(INTNO intno, bool_t enable)
+{
+	ier[intno] = enable;
+	sim_update();
+}
+
+/*
+ *  CPUロック状態と割込みサービスルーチン実行中の管理
+ */
+void
+sim_set_lock(bool_t lock)
+{
+	cpu_locked = lock;
+	sim_update();
+}
+
+bool_t
+sim_sns_lock(void)
+{
+	return(cpu_locked);
+}
+
+bool_t
+sim_sns_isr(void)
+{
+	return(in_isr);
+}
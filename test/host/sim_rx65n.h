@@ -0,0 +1,133 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		RX65NのSCI1/ICU/DTCのレジスタモデル
+ *
+ *  シリアルドライバの単体テストのために，SCI1の送受信，ICUの割込み要
+ *  求（IR，IER，DTCER）とDTCのノーマル転送モードを，1文字の送信時間
+ *  を単位として模擬する．
+ *
+ *  DTCが転送情報として読み出す番地は32ビットであるため，ホストのポイ
+ *  ンタとは一致しない．DTCがアクセスするメモリ領域は，sim_mapで登録
+ *  しておく必要がある．
+ */
+
+#ifndef TOPPERS_SIM_RX65N_H
+#define TOPPERS_SIM_RX65N_H
+
+#include <kernel.h>
+
+/*
+ *  I/O領域の範囲
+ */
+#define SIM_IOREG_BASE		0x00080000U
+#define SIM_IOREG_LIMIT		0x000a0000U
+
+/*
+ *  モデルの初期化（リセット状態にする）
+ */
+extern void	sim_reset(void);
+
+/*
+ *  DTCがアクセスするメモリ領域の登録
+ */
+extern void	sim_map(const void *base, size_t size);
+
+/*
+ *  割込みサービスルーチンの登録
+ */
+extern void	sim_att_isr(INTNO intno, ISR isr, EXINF exinf);
+
+/*
+ *  1文字の送信時間だけ時間を進める
+ */
+extern void	sim_step(void);
+
+/*
+ *  送信が完了し，受け付けられる割込みがなくなるまで時間を進める
+ *
+ *  進めた時間（文字数）を返す．
+ */
+extern uint_t	sim_run(void);
+
+/*
+ *  SCI1での1文字の受信
+ */
+extern void	sim_receive(char c);
+
+/*
+ *  SCI1から送信された文字列
+ */
+extern const char	*sim_output(void);
+extern void	sim_clear_output(void);
+
+/*
+ *  DTCによる転送回数
+ */
+extern uint_t	sim_dtc_count(void);
+
+/*
+ *  割込み要求の許可状態の参照
+ */
+extern bool_t	sim_int_enabled(INTNO intno);
+
+/*
+ *  CPUロック状態と割込みサービスルーチン実行中の管理
+ *
+ *  sim_kernel.cから呼び出す．sim_set_lockで，CPUロック状態を設定／解
+ *  除する．sim_sns_isrは，割込みサービスルーチンの実行中にtrueを返す．
+ */
+extern void		sim_set_lock(bool_t lock);
+extern bool_t	sim_sns_lock(void);
+extern bool_t	sim_sns_isr(void);
+extern void		sim_set_ier(INTNO intno, bool_t enable);
+
+/*
+ *  セマフォの初期化と参照（sim_kernel.c）
+ */
+extern void		sim_kernel_reset(void);
+extern uint_t	sim_semcnt(ID semid);
+
+/*
+ *  テストの失敗
+ */
+extern void	sim_fail(const char *file, int_t line, const char *msg);
+
+#endif /* TOPPERS_SIM_RX65N_H */
@@ -0,0 +1,354 @@
+/*
+ *  TOPPERS/HRP Kernel
+ *      Toyohashi Open Platform for Embedded Real-Time Systems/
+ *      High Reliable system Profile Kernel
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		シリアルドライバのブロック送信のテスト
+ *
+ * 【テストの目的】
+ *
+ *  RX65N用のSIOドライバ（arch/rx_gcc/rx65n/prc_serial.c）のDTCによる
+ *  ブロック送信と，シリアルインタフェースドライバ（syssvc/serial.c）
+ *  の送信バッファ管理を，ホスト上のレジスタモデル（sim_rx65n.c）と組
+ *  み合わせてテストする．
+ *
+ * 【テスト項目】
+ *
+ *  (A) sio_snd_blkの引数とDTCの設定
+ *	(A-1) 長さ0のブロックは受け付けない
+ *	(A-2) 送信レジスタが空いていれば，先頭の文字を書き込み，残りをDTC
+ *		  で転送する
+ *	(A-3) 以前のTXIの要求が残っていても，DTCを起動しない
+ *	(A-4) DTCで転送中は，sio_snd_blkとsio_snd_chrを受け付けない
+ *  (B) sio_irdy_sndでのsnd_blklenの管理
+ *	(B-1) 送信した文字列が順序通りに出力され，snd_blklenが0に戻る
+ *	(B-2) ブロックが送信バッファの末尾で分割される
+ *	(B-3) 送信バッファが満杯の時は，ブロックの送信完了でセマフォを返却
+ *		  する（送信バッファを何周かする）
+ *  (C) フロー制御
+ *	(C-1) STOP受信後は，送信中のブロックのみを送信する
+ *	(C-2) STOP中にブロックの送信が完了した後，STARTで送信を再開する
+ *	(C-3) ブロックの送信完了の処理の前にSTARTを受信した場合，ブロッ
+ *		  クの送信完了時に送信を再開する（文字を重複して送信しない）
+ *  (D) serial_get_chr
+ *	(D-1) 送信中のブロックを読み飛ばし，それ以降の文字を取り出す
+ *	(D-2) その後のブロックの送信完了で，送信バッファから二重に取り除か
+ *		  ない
+ *
+ *  シリアルインタフェースドライバのソースファイルは，インクルードパス
+ *  で選択する（Makefile参照）．
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "sim_rx65n.h"
+#include "prc_serial.c"
+#include "serial.c"
+
+#define CHECK(exp) do {										\
+	if (!(exp)) {											\
+		sim_fail(__FILE__, __LINE__, "check failed: " #exp);	\
+	}														\
+} while (false)
+
+#define CHECK_OUTPUT(str) do {								\
+	if (strcmp(sim_output(), (str)) != 0) {					\
+		fprintf(stderr, "output: \"%s\", expected: \"%s\"\n",	\
+										sim_output(), (str));	\
+		sim_fail(__FILE__, __LINE__, "unexpected output");	\
+	}														\
+} while (false)
+
+#define PORTID		SCI1_SIO_ID
+#define SND_BUFSZ	SERIAL_SND_BUFSZ1
+
+/*
+ *  送信バッファの状態のチェック
+ */
+static void
+check_idle(SPCB *p_spcb)
+{
+	CHECK(p_spcb->snd_blklen == 0U);
+	CHECK(p_spcb->snd_count == 0U);
+	CHECK(p_spcb->snd_read_ptr == p_spcb->snd_write_ptr);
+	CHECK(!(p_spcb->errorflag));
+	CHECK(sim_semcnt(SERIAL_SND_SEM1) == 1U);
+	CHECK(!sim_int_enabled(INT_TXI1));
+}
+
+/*
+ *  テストの準備
+ *
+ *  SIOドライバとシリアルインタフェースドライバを初期化し，ポートをオー
+ *  プンする．
+ */
+static SPCB *
+setup(uint_t ioctl)
+{
+	sim_reset();
+	sim_kernel_reset();
+	memset(siopcb_table, 0, sizeof(siopcb_table));
+	memset(spcb_table, 0, sizeof(spcb_table));
+
+	sim_map(dtc_vector_table, sizeof(dtc_vector_table));
+	sim_map(siopcb_table, sizeof(siopcb_table));
+	sim_map(snd_buffer1, sizeof(snd_buffer1));
+	sim_att_isr(INT_RXI1, sio_isr_rxi, SCI1_SIO_ID);
+	sim_att_isr(INT_TXI1, sio_isr_txi, SCI1_SIO_ID);
+
+	sio_initialize(0);
+	serial_initialize(0);
+	CHECK(_serial_opn_por(PORTID) == E_OK);
+	CHECK(_serial_ctl_por(PORTID, ioctl) == E_OK);
+	return(get_spcb(PORTID));
+}
+
+/*
+ *  文字列の送信
+ */
+static void
+write_str(const char *str)
+{
+	uint_t	len = (uint_t) strlen(str);
+
+	CHECK(_serial_wri_dat(PORTID, str, len) == (ER_UINT) len);
+}
+
+/*
+ *  (A) sio_snd_blkの引数とDTCの設定
+ */
+static void
+test_snd_blk(void)
+{
+	SPCB	*p_spcb;
+
+	p_spcb = setup(IOCTL_NULL);
+
+	/*
+	 *  (A-1)
+	 */
+	CHECK(loc_cpu() == E_OK);
+	CHECK(!sio_snd_blk(p_spcb->p_siopcb, snd_buffer1, 0U));
+
+	/*
+	 *  (A-2)(A-3)
+	 *
+	 *  'a'を送信シフトレジスタに入れてTXIの要求を残した状態で，"bcd"
+	 *  をブロック送信する．要求が残っていると，DTCが'c'で'b'を上書き
+	 *  してしまう．
+	 */
+	memcpy(snd_buffer1, "bcd", 3U);
+	CHECK(sio_snd_chr(p_spcb->p_siopcb, 'a'));
+	CHECK(sil_reb_mem((void *) ICU_IRn_ADDR(INT_TXI1)) != 0U);
+	CHECK(sio_snd_blk(p_spcb->p_siopcb, snd_buffer1, 3U));
+	CHECK((sil_reb_mem((void *) ICU_DTCERn_ADDR(INT_TXI1))
+									& ICU_DTCERn_DTCE_BIT) != 0U);
+	sio_ena_cbr(p_spcb->p_siopcb, SIO_RDY_SND);
+	CHECK(sim_dtc_count() == 0U);
+
+	/*
+	 *  (A-4)
+	 */
+	CHECK(!sio_snd_blk(p_spcb->p_siopcb, snd_buffer1, 1U));
+	sim_step();
+	CHECK(sim_dtc_count() == 1U);
+	CHECK(!sio_snd_chr(p_spcb->p_siopcb, 'x'));
+	CHECK(unl_cpu() == E_OK);
+	sim_run();
+	CHECK_OUTPUT("abcd");
+	CHECK(sim_dtc_count() == 2U);
+	CHECK((sil_reb_mem((void *) ICU_DTCERn_ADDR(INT_TXI1))
+									& ICU_DTCERn_DTCE_BIT) == 0U);
+}
+
+/*
+ *  (B) sio_irdy_sndでのsnd_blklenの管理
+ */
+static void
+test_irdy_snd(void)
+{
+	SPCB	*p_spcb;
+
+	/*
+	 *  (B-1)
+	 *
+	 *  先頭の2文字は送信レジスタに直接書き込み，残りの3文字は1つのブ
+	 *  ロックとして送信する．
+	 */
+	p_spcb = setup(IOCTL_NULL);
+	write_str("HELLO");
+	CHECK(p_spcb->snd_count == 3U);
+	sim_step();
+	CHECK(p_spcb->snd_blklen == 3U);
+	sim_run();
+	CHECK_OUTPUT("HELLO");
+	CHECK(sim_dtc_count() == 2U);
+	check_idle(p_spcb);
+
+	/*
+	 *  (B-2)
+	 *
+	 *  送信バッファの添字3の位置から6文字を入れると，末尾までの5文字
+	 *  と先頭の1文字の2つのブロックに分けて送信する．
+	 */
+	write_str("GHIJKLMN");
+	CHECK(p_spcb->snd_read_ptr == 3U && p_spcb->snd_count == 6U);
+	sim_step();
+	CHECK(p_spcb->snd_blklen == 5U);
+	sim_run();
+	CHECK_OUTPUT("HELLOGHIJKLMN");
+	check_idle(p_spcb);
+
+	/*
+	 *  (B-3)
+	 *
+	 *  送信バッファのサイズを超える文字列を送信すると，送信バッファが
+	 *  満杯になってwai_semで待ち，ブロックの送信完了で返却される．ブ
+	 *  ロックが送信バッファの末尾を越えると，sim_xlateで失敗する．
+	 */
+	p_spcb = setup(IOCTL_NULL);
+	write_str("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+	sim_run();
+	CHECK_OUTPUT("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+	check_idle(p_spcb);
+}
+
+/*
+ *  (C) フロー制御
+ */
+static void
+test_flow_control(void)
+{
+	SPCB	*p_spcb;
+
+	/*
+	 *  (C-1)(C-2)
+	 */
+	p_spcb = setup(IOCTL_FCSND);
+	write_str("ABCDEFG");
+	sim_step();
+	CHECK(p_spcb->snd_blklen == 5U);
+	sim_receive(FC_STOP);
+	CHECK(p_spcb->snd_stopped);
+	sim_run();
+	CHECK_OUTPUT("ABCDEFG");
+	CHECK(p_spcb->snd_blklen == 0U);
+
+	write_str("HIJ");
+	sim_run();
+	CHECK_OUTPUT("ABCDEFG");
+	CHECK(p_spcb->snd_count == 3U);
+
+	sim_receive(FC_START);
+	CHECK(!(p_spcb->snd_stopped));
+	sim_run();
+	CHECK_OUTPUT("ABCDEFGHIJ");
+	check_idle(p_spcb);
+
+	/*
+	 *  (C-3)
+	 *
+	 *  ブロックの最後の文字が送信シフトレジスタに移ってTDREがセットさ
+	 *  れ，送信完了のTXIが受け付けられる前にSTARTを受信した場合．RXI
+	 *  の方が割込み番号が小さいため，先に受け付けられる．
+	 */
+	p_spcb = setup(IOCTL_FCSND);
+	write_str("ABCDEFG");
+	sim_step();
+	sim_receive(FC_STOP);
+	write_str("XY");
+	CHECK(p_spcb->snd_count == 7U);
+	CHECK(loc_cpu() == E_OK);
+	while ((sil_reb_mem((void *) ICU_DTCERn_ADDR(INT_TXI1))
+									& ICU_DTCERn_DTCE_BIT) != 0U) {
+		sim_step();
+	}
+	sim_step();
+	CHECK_OUTPUT("ABCDEF");
+	CHECK((sil_reb_mem((void *) SCI1_SSR_ADDR) & SCIn_SSR_TDRE_BIT) != 0U);
+	sim_receive(FC_START);
+	CHECK(unl_cpu() == E_OK);
+	CHECK(p_spcb->snd_blklen == 2U);
+	sim_run();
+	CHECK_OUTPUT("ABCDEFGXY");
+	check_idle(p_spcb);
+}
+
+/*
+ *  (D) serial_get_chr
+ */
+static void
+test_get_chr(void)
+{
+	SPCB	*p_spcb;
+	char	c;
+
+	/*
+	 *  (D-1)
+	 */
+	p_spcb = setup(IOCTL_NULL);
+	write_str("ABCDEFG");
+	sim_step();
+	write_str("XY");
+	CHECK(p_spcb->snd_blklen == 5U);
+
+	CHECK(loc_cpu() == E_OK);
+	CHECK(serial_get_chr(PORTID, &c) && c == 'X');
+	CHECK(p_spcb->snd_blklen == 0U);
+	CHECK(serial_get_chr(PORTID, &c) && c == 'Y');
+	CHECK(!serial_get_chr(PORTID, &c));
+	CHECK(unl_cpu() == E_OK);
+
+	/*
+	 *  (D-2)
+	 */
+	sim_run();
+	CHECK_OUTPUT("ABCDEFG");
+	check_idle(p_spcb);
+}
+
+int
+main(void)
+{
+	test_snd_blk();
+	test_irdy_snd();
+	test_flow_control();
+	test_get_chr();
+	printf("test_serial: all tests passed\n");
+	return(0);
+}
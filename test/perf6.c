@@ -0,0 +1,156 @@
+/*
+ *  TOPPERS Software
+ *      Toyohashi Open Platform for Embedded Real-Time Systems
+ * 
+ *  Copyright (C) 2006-2018 by Embedded and Real-Time Systems Laboratory
+ *              Graduate School of Information Science, Nagoya Univ., JAPAN
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		カーネル性能評価プログラム(6)
+ *
+ *  ログ情報の整形にかかる時間を計測するためのプログラム．1文字出力関
+ *  数を用いるsyslog_printと，バッファに整形するsyslog_sprintを比較す
+ *  る．
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include <log_output.h>
+#include "syssvc/syslog.h"
+#include "syssvc/test_svc.h"
+#include "syssvc/histogram.h"
+#include "kernel_cfg.h"
+#include "perf6.h"
+
+/*
+ *  計測回数と実行時間分布を記録する最大時間
+ */
+#define NO_MEASURE	10000U			/* 計測回数 */
+
+/*
+ *  整形結果を格納するバッファ
+ */
+#define OUTBUF_SIZE		128U
+
+static char		outbuf[OUTBUF_SIZE];
+static uint_t	outcnt;
+
+/*
+ *  計測用の1文字出力関数
+ */
+static void
+perf_putc(char c)
+{
+	if (outcnt < OUTBUF_SIZE) {
+		outbuf[outcnt++] = c;
+	}
+}
+
+/*
+ *  計測に用いるログ情報の作成
+ */
+static void
+make_syslog(SYSLOG *p_syslog, uint_t i)
+{
+	p_syslog->logtype = LOG_TYPE_COMMENT;
+	p_syslog->logpar[0] = (LOGPAR) "task %d: state = %08x, count = %u (%s)";
+	p_syslog->logpar[1] = (LOGPAR)(-(int_t) i);
+	p_syslog->logpar[2] = (LOGPAR)(0x9e3779b9U * i);
+	p_syslog->logpar[3] = (LOGPAR)(4000000000U - i);
+	p_syslog->logpar[4] = (LOGPAR) "running";
+}
+
+/*
+ *  メインタスク
+ */
+void main_task(EXINF exinf)
+{
+	SYSLOG	syslog;
+	uint_t	i, len1, len2;
+	ER		ercd;
+
+	syslog_0(LOG_NOTICE, "Performance evaluation program (6)");
+
+	ercd = init_hist(1);
+	check_ercd(ercd, E_OK);
+
+	ercd = init_hist(2);
+	check_ercd(ercd, E_OK);
+
+	/*
+	 *  1文字出力関数を用いた整形
+	 */
+	for (i = 0; i < NO_MEASURE; i++) {
+		make_syslog(&syslog, i);
+		outcnt = 0U;
+
+		ercd = begin_measure(1);
+		check_ercd(ercd, E_OK);
+
+		syslog_print(&syslog, perf_putc);
+
+		ercd = end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	len1 = outcnt;
+
+	/*
+	 *  バッファへの整形
+	 */
+	for (i = 0; i < NO_MEASURE; i++) {
+		make_syslog(&syslog, i);
+
+		ercd = begin_measure(2);
+		check_ercd(ercd, E_OK);
+
+		len2 = syslog_sprint(outbuf, OUTBUF_SIZE, &syslog);
+
+		ercd = end_measure(2);
+		check_ercd(ercd, E_OK);
+	}
+
+	/*
+	 *  両者の整形結果の長さが一致することを確認する．
+	 */
+	check_assert(len1 == len2);
+
+	syslog_0(LOG_NOTICE, "Execution times of syslog_print");
+	print_hist(1);
+
+	syslog_0(LOG_NOTICE, "Execution times of syslog_sprint");
+	print_hist(2);
+
+	check_finish(0);
+}
@@ -0,0 +1,149 @@
+/*
+ *  TOPPERS Software
+ *      Toyohashi Open Platform for Embedded Real-Time Systems
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		カーネル性能評価プログラム(7)
+ *
+ *  複数のタスクとセマフォの状態を参照する時間を，ref_tskとref_semを
+ *  オブジェクト毎に呼び出す場合と，ref_snpでまとめて取り出す場合とで
+ *  比較するためのプログラム．カーネルをUSE_SNAPSHOTをマクロ定義して構
+ *  築する必要がある．
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "syssvc/histogram.h"
+#include "kernel_cfg.h"
+#include "perf7.h"
+
+/*
+ *  計測回数と実行時間分布を記録する最大時間
+ */
+#define NO_MEASURE	10000U			/* 計測回数 */
+
+/*
+ *  状態を取り出す領域
+ */
+static T_RTSK	rtsk1[NUM_TASK], rtsk2[NUM_TASK];
+static T_RSEM	rsem1[NUM_SEM], rsem2[NUM_SEM];
+
+/*
+ *  計測対象のタスク（起動されない）
+ */
+void
+task(EXINF exinf)
+{
+}
+
+/*
+ *  メインタスク
+ */
+void
+main_task(EXINF exinf)
+{
+	uint_t	i, j, snpgen1, snpgen2;
+	ER_UINT	ercd;
+
+	syslog_0(LOG_NOTICE, "Performance evaluation program (7)");
+
+	ercd = init_hist(1);
+	check_ercd(ercd, E_OK);
+
+	ercd = init_hist(2);
+	check_ercd(ercd, E_OK);
+
+	/*
+	 *  オブジェクト毎の参照
+	 */
+	for (i = 0; i < NO_MEASURE; i++) {
+		ercd = begin_measure(1);
+		check_ercd(ercd, E_OK);
+
+		for (j = 0; j < NUM_TASK; j++) {
+			(void) ref_tsk(TASK1 + (ID) j, &(rtsk1[j]));
+		}
+		for (j = 0; j < NUM_SEM; j++) {
+			(void) ref_sem(SEM1 + (ID) j, &(rsem1[j]));
+		}
+
+		ercd = end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+
+	/*
+	 *  スナップショットによる参照
+	 */
+	for (i = 0; i < NO_MEASURE; i++) {
+		ercd = begin_measure(2);
+		check_ercd(ercd, E_OK);
+
+		(void) ref_snp(TOBJ_TSK, TASK1, NUM_TASK, rtsk2, &snpgen1);
+		(void) ref_snp(TOBJ_SEM, SEM1, NUM_SEM, rsem2, &snpgen2);
+
+		ercd = end_measure(2);
+		check_ercd(ercd, E_OK);
+	}
+
+	/*
+	 *  両者の参照結果が一致し，一貫していることを確認する．
+	 */
+	ercd = ref_snp(TOBJ_TSK, TASK1, NUM_TASK, rtsk2, &snpgen1);
+	check_ercd(ercd, NUM_TASK);
+	ercd = ref_snp(TOBJ_SEM, SEM1, NUM_SEM, rsem2, &snpgen2);
+	check_ercd(ercd, NUM_SEM);
+	check_assert(snpgen1 == snpgen2);
+	for (j = 0; j < NUM_TASK; j++) {
+		check_assert(rtsk1[j].tskstat == TTS_DMT);
+		check_assert(rtsk2[j].tskstat == TTS_DMT);
+		check_assert(rtsk1[j].actcnt == rtsk2[j].actcnt);
+	}
+	for (j = 0; j < NUM_SEM; j++) {
+		check_assert(rsem1[j].wtskid == rsem2[j].wtskid);
+		check_assert(rsem1[j].semcnt == rsem2[j].semcnt);
+	}
+
+	syslog_1(LOG_NOTICE, "Execution times of %d ref_tsk/ref_sem",
+												NUM_TASK + NUM_SEM);
+	print_hist(1);
+
+	syslog_0(LOG_NOTICE, "Execution times of 2 ref_snp");
+	print_hist(2);
+
+	check_finish(0);
+}
@@ -0,0 +1,1900 @@
+/*  This file is generated from ../kernel/svc.def by genperf.rb. */
+
+/*
+ *		カーネル性能評価プログラム(8)
+ *
+ *  サービスコール毎の実行時間を計測するためのプログラム．サービスコー
+ *  ルの呼出し方毎に，次のいずれかの時間を計測する．
+ *
+ *	nowait	サービスコールの実行時間（タスク切換えなし）
+ *	switch	サービスコールにより，高優先度のタスクに切り換わるまでの時間
+ *	block	サービスコールにより待ち状態に入り，低優先度のタスクに切り
+ *			換わるまでの時間
+ *
+ *  計測結果は，"Execution times of <サービスコール名> (<呼出し方>)"に
+ *  続けて，print_histにより出力する．
+ *
+ *  計測していないサービスコール：
+ *	ext_tsk ter_tsk chg_dln dly_tsk ras_ter set_tim set_dft fch_mnt
+ *	ref_ovr sta_ovr stp_ovr ext_ker dis_int ena_int xsns_dpn clr_int
+ *	ras_int prb_int chg_som ref_ost ref_snp sig_chn wai_chn twai_chn
+ *	ref_chn chg_spr mrot_rdq mget_lod mget_nth
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "syssvc/histogram.h"
+#include "kernel_cfg.h"
+#include "perf8.h"
+
+/*
+ *  計測回数
+ */
+#define NO_MEASURE	1000U			/* 計測回数 */
+
+/*
+ *  サービスコールの引数と返値を格納する変数
+ */
+static STAT		tskstat;
+static PRI		tskpri;
+static EXINF	tskinf;
+static FLGPTN	flgptn;
+static intptr_t	data;
+static PRI		datapri;
+static void		*blk, *blk2;
+static SYSTIM	systim;
+static uint_t	load;
+static ID		tskid;
+static ID		domid;
+static ID		somid;
+static PRI		intpri;
+static T_RTSK	rtsk;
+static T_RSTK	rstk;
+static T_RSEM	rsem;
+static T_RFLG	rflg;
+static T_RDTQ	rdtq;
+static T_RPDQ	rpdq;
+static T_RMTX	rmtx;
+static T_RMBF	rmbf;
+static T_RMPF	rmpf;
+static T_RCYC	rcyc;
+static T_RALM	ralm;
+static T_RMEM	rmem;
+static char		perf_smsg[PERF_MSGSZ];
+static char		perf_rmsg[PERF_MSGSZ];
+
+/*
+ *  計測中の処理の番号
+ */
+static uint_t	perf_no;
+
+/*
+ *  計測の開始
+ */
+static void
+perf_start(uint_t no, bool_t restart)
+{
+	ER		ercd;
+
+	perf_no = no;
+	ercd = init_hist(1);
+	check_ercd(ercd, E_OK);
+
+	/*
+	 *  計測タスク1を再起動し，計測する処理の待ち状態に入れる．
+	 */
+	if (restart) {
+		(void) ter_tsk(TASK1);
+		ercd = act_tsk(TASK1);
+		check_ercd(ercd, E_OK);
+	}
+}
+
+/*
+ *  計測結果の出力
+ */
+static void
+perf_finish(const char *svcname, const char *label)
+{
+	ER		ercd;
+
+	syslog_2(LOG_NOTICE, "Execution times of %s (%s)", svcname, label);
+	ercd = print_hist(1);
+	check_ercd(ercd, E_OK);
+}
+
+/*
+ *  計測タスク1（高優先度）
+ *
+ *  計測する処理の待ち状態に入り，待ち解除されたら計測を終了する．
+ */
+void
+task1(EXINF exinf)
+{
+	while (true) {
+		switch (perf_no) {
+		case 12U:
+			(void) slp_tsk();
+			(void) end_measure(1);
+			break;
+		case 14U:
+			(void) slp_tsk();
+			(void) end_measure(1);
+			break;
+		case 18U:
+			(void) sus_tsk(TSK_SELF);
+			(void) end_measure(1);
+			break;
+		case 23U:
+			(void) wai_sem(SEM1);
+			(void) end_measure(1);
+			break;
+		case 30U:
+			(void) wai_flg(FLG1, 0x01U, TWF_ORW, &flgptn);
+			(void) end_measure(1);
+			break;
+		case 38U:
+			(void) rcv_dtq(DTQ1, &data);
+			(void) end_measure(1);
+			break;
+		case 41U:
+			(void) rcv_dtq(DTQ1, &data);
+			(void) end_measure(1);
+			break;
+		case 43U:
+			(void) rcv_dtq(DTQ1, &data);
+			(void) end_measure(1);
+			break;
+		case 46U:
+			(void) rcv_dtq(DTQ2, &data);
+			(void) end_measure(1);
+			break;
+		case 53U:
+			(void) rcv_pdq(PDQ1, &data, &datapri);
+			(void) end_measure(1);
+			break;
+		case 56U:
+			(void) rcv_pdq(PDQ1, &data, &datapri);
+			(void) end_measure(1);
+			break;
+		case 58U:
+			(void) rcv_pdq(PDQ1, &data, &datapri);
+			(void) end_measure(1);
+			break;
+		case 72U:
+			(void) slp_tsk();
+			(void) loc_mtx(MTX1);
+			(void) end_measure(1);
+			(void) unl_mtx(MTX1);
+			break;
+		case 74U:
+			(void) rcv_mbf(MBF1, perf_rmsg);
+			(void) end_measure(1);
+			break;
+		case 76U:
+			(void) rcv_mbf(MBF1, perf_rmsg);
+			(void) end_measure(1);
+			break;
+		case 78U:
+			(void) rcv_mbf(MBF1, perf_rmsg);
+			(void) end_measure(1);
+			break;
+		case 90U:
+			(void) slp_tsk();
+			(void) get_mpf(MPF1, &blk2);
+			(void) end_measure(1);
+			(void) rel_mpf(MPF1, blk2);
+			break;
+		case 105U:
+			(void) slp_tsk();
+			(void) end_measure(1);
+			break;
+		default:
+			check_assert(false);
+			break;
+		}
+	}
+}
+
+/*
+ *  計測タスク2（高優先度）
+ *
+ *  起動されたら計測を終了する．
+ */
+void
+task2(EXINF exinf)
+{
+	(void) end_measure(1);
+}
+
+/*
+ *  計測タスク3（低優先度）
+ *
+ *  メインタスクが待ち状態に入ったら計測を終了し，待ち状態を解除する．
+ */
+void
+task3(EXINF exinf)
+{
+	while (true) {
+		(void) end_measure(1);
+
+		switch (perf_no) {
+		case 6U:
+			(void) chg_pri(MAIN_TASK, MAIN_PRIORITY);
+			break;
+		case 9U:
+			(void) wup_tsk(MAIN_TASK);
+			break;
+		case 10U:
+			(void) wup_tsk(MAIN_TASK);
+			break;
+		case 25U:
+			(void) sig_sem(SEM1);
+			break;
+		case 28U:
+			(void) sig_sem(SEM1);
+			break;
+		case 33U:
+			(void) set_flg(FLG1, 0x01U);
+			break;
+		case 36U:
+			(void) set_flg(FLG1, 0x01U);
+			break;
+		case 39U:
+			(void) prcv_dtq(DTQ1, &data);
+			break;
+		case 44U:
+			(void) prcv_dtq(DTQ1, &data);
+			break;
+		case 48U:
+			(void) psnd_dtq(DTQ1, 1);
+			break;
+		case 51U:
+			(void) psnd_dtq(DTQ1, 1);
+			break;
+		case 54U:
+			(void) prcv_pdq(PDQ1, &data, &datapri);
+			break;
+		case 60U:
+			(void) psnd_pdq(PDQ1, 1, 1);
+			break;
+		case 63U:
+			(void) psnd_pdq(PDQ1, 1, 1);
+			break;
+		case 80U:
+			(void) psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ);
+			break;
+		case 83U:
+			(void) psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ);
+			break;
+		case 85U:
+			(void) rel_mpf(MPF1, blk);
+			break;
+		case 88U:
+			(void) rel_mpf(MPF1, blk);
+			break;
+		default:
+			check_assert(false);
+			break;
+		}
+	}
+}
+
+/*
+ *  メインタスク
+ */
+void
+main_task(EXINF exinf)
+{
+	uint_t	i;
+	ER_UINT	ercd;
+
+	syslog_0(LOG_NOTICE, "Performance evaluation program (8)");
+
+	/*
+	 *  act_tsk（nowait）
+	 */
+	perf_start(1U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = act_tsk(TASK3);
+		(void) end_measure(1);
+		(void) can_act(TASK3);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("act_tsk", "nowait");
+
+	/*
+	 *  act_tsk（switch）
+	 */
+	perf_start(2U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = act_tsk(TASK2);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("act_tsk", "switch");
+
+	/*
+	 *  get_tst（nowait）
+	 */
+	perf_start(3U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_tst(TASK3, &tskstat);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_tst", "nowait");
+
+	/*
+	 *  can_act（nowait）
+	 */
+	perf_start(4U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) act_tsk(TASK3);
+		(void) begin_measure(1);
+		ercd = can_act(TASK3);
+		(void) end_measure(1);
+		check_ercd(ercd, 1);
+	}
+	perf_finish("can_act", "nowait");
+
+	/*
+	 *  chg_pri（nowait）
+	 */
+	perf_start(5U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = chg_pri(TSK_SELF, MAIN_PRIORITY);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("chg_pri", "nowait");
+
+	/*
+	 *  chg_pri（block）
+	 */
+	perf_start(6U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = chg_pri(TSK_SELF, LOW_PRIORITY);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("chg_pri", "block");
+
+	/*
+	 *  get_pri（nowait）
+	 */
+	perf_start(7U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_pri(TASK3, &tskpri);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_pri", "nowait");
+
+	/*
+	 *  get_inf（nowait）
+	 */
+	perf_start(8U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_inf(&tskinf);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_inf", "nowait");
+
+	/*
+	 *  slp_tsk（block）
+	 */
+	perf_start(9U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = slp_tsk();
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("slp_tsk", "block");
+
+	/*
+	 *  tslp_tsk（block）
+	 */
+	perf_start(10U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = tslp_tsk(PERF_TMOUT);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tslp_tsk", "block");
+
+	/*
+	 *  wup_tsk（nowait）
+	 */
+	perf_start(11U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = wup_tsk(TSK_SELF);
+		(void) end_measure(1);
+		(void) can_wup(TSK_SELF);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("wup_tsk", "nowait");
+
+	/*
+	 *  wup_tsk（switch）
+	 */
+	perf_start(12U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = wup_tsk(TASK1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("wup_tsk", "switch");
+
+	/*
+	 *  can_wup（nowait）
+	 */
+	perf_start(13U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) wup_tsk(TSK_SELF);
+		(void) begin_measure(1);
+		ercd = can_wup(TSK_SELF);
+		(void) end_measure(1);
+		check_ercd(ercd, 1);
+	}
+	perf_finish("can_wup", "nowait");
+
+	/*
+	 *  rel_wai（switch）
+	 */
+	perf_start(14U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = rel_wai(TASK1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("rel_wai", "switch");
+
+	/*
+	 *  ref_stk（nowait）
+	 */
+	perf_start(15U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_stk(TASK3, &rstk);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_stk", "nowait");
+
+	/*
+	 *  sus_tsk（nowait）
+	 */
+	perf_start(16U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = sus_tsk(TASK3);
+		(void) end_measure(1);
+		(void) rsm_tsk(TASK3);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("sus_tsk", "nowait");
+
+	/*
+	 *  rsm_tsk（nowait）
+	 */
+	perf_start(17U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) sus_tsk(TASK3);
+		(void) begin_measure(1);
+		ercd = rsm_tsk(TASK3);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("rsm_tsk", "nowait");
+
+	/*
+	 *  rsm_tsk（switch）
+	 */
+	perf_start(18U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = rsm_tsk(TASK1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("rsm_tsk", "switch");
+
+	/*
+	 *  dis_ter（nowait）
+	 */
+	perf_start(19U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = dis_ter();
+		(void) end_measure(1);
+		(void) ena_ter();
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("dis_ter", "nowait");
+
+	/*
+	 *  ena_ter（nowait）
+	 */
+	perf_start(20U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) dis_ter();
+		(void) begin_measure(1);
+		ercd = ena_ter();
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ena_ter", "nowait");
+
+	/*
+	 *  sns_ter（nowait）
+	 */
+	perf_start(21U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		(void) sns_ter();
+		(void) end_measure(1);
+	}
+	perf_finish("sns_ter", "nowait");
+
+	/*
+	 *  sig_sem（nowait）
+	 */
+	perf_start(22U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = sig_sem(SEM1);
+		(void) end_measure(1);
+		(void) pol_sem(SEM1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("sig_sem", "nowait");
+
+	/*
+	 *  sig_sem（switch）
+	 */
+	perf_start(23U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = sig_sem(SEM1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("sig_sem", "switch");
+
+	/*
+	 *  wai_sem（nowait）
+	 */
+	perf_start(24U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) sig_sem(SEM1);
+		(void) begin_measure(1);
+		ercd = wai_sem(SEM1);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("wai_sem", "nowait");
+
+	/*
+	 *  wai_sem（block）
+	 */
+	perf_start(25U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = wai_sem(SEM1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("wai_sem", "block");
+
+	/*
+	 *  pol_sem（nowait）
+	 */
+	perf_start(26U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) sig_sem(SEM1);
+		(void) begin_measure(1);
+		ercd = pol_sem(SEM1);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("pol_sem", "nowait");
+
+	/*
+	 *  twai_sem（nowait）
+	 */
+	perf_start(27U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) sig_sem(SEM1);
+		(void) begin_measure(1);
+		ercd = twai_sem(SEM1, PERF_TMOUT);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("twai_sem", "nowait");
+
+	/*
+	 *  twai_sem（block）
+	 */
+	perf_start(28U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = twai_sem(SEM1, PERF_TMOUT);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("twai_sem", "block");
+
+	/*
+	 *  set_flg（nowait）
+	 */
+	perf_start(29U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = set_flg(FLG1, 0x01U);
+		(void) end_measure(1);
+		(void) clr_flg(FLG1, 0U);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("set_flg", "nowait");
+
+	/*
+	 *  set_flg（switch）
+	 */
+	perf_start(30U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = set_flg(FLG1, 0x01U);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("set_flg", "switch");
+
+	/*
+	 *  clr_flg（nowait）
+	 */
+	perf_start(31U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) set_flg(FLG1, 0x01U);
+		(void) begin_measure(1);
+		ercd = clr_flg(FLG1, 0U);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("clr_flg", "nowait");
+
+	/*
+	 *  wai_flg（nowait）
+	 */
+	perf_start(32U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) set_flg(FLG1, 0x01U);
+		(void) begin_measure(1);
+		ercd = wai_flg(FLG1, 0x01U, TWF_ORW, &flgptn);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("wai_flg", "nowait");
+
+	/*
+	 *  wai_flg（block）
+	 */
+	perf_start(33U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = wai_flg(FLG1, 0x01U, TWF_ORW, &flgptn);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("wai_flg", "block");
+
+	/*
+	 *  pol_flg（nowait）
+	 */
+	perf_start(34U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) set_flg(FLG1, 0x01U);
+		(void) begin_measure(1);
+		ercd = pol_flg(FLG1, 0x01U, TWF_ORW, &flgptn);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("pol_flg", "nowait");
+
+	/*
+	 *  twai_flg（nowait）
+	 */
+	perf_start(35U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) set_flg(FLG1, 0x01U);
+		(void) begin_measure(1);
+		ercd = twai_flg(FLG1, 0x01U, TWF_ORW, &flgptn, PERF_TMOUT);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("twai_flg", "nowait");
+
+	/*
+	 *  twai_flg（block）
+	 */
+	perf_start(36U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = twai_flg(FLG1, 0x01U, TWF_ORW, &flgptn, PERF_TMOUT);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("twai_flg", "block");
+
+	/*
+	 *  snd_dtq（nowait）
+	 */
+	perf_start(37U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = snd_dtq(DTQ2, 1);
+		(void) end_measure(1);
+		(void) prcv_dtq(DTQ2, &data);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("snd_dtq", "nowait");
+
+	/*
+	 *  snd_dtq（switch）
+	 */
+	perf_start(38U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = snd_dtq(DTQ1, 1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("snd_dtq", "switch");
+
+	/*
+	 *  snd_dtq（block）
+	 */
+	perf_start(39U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = snd_dtq(DTQ1, 1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("snd_dtq", "block");
+
+	/*
+	 *  psnd_dtq（nowait）
+	 */
+	perf_start(40U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = psnd_dtq(DTQ2, 1);
+		(void) end_measure(1);
+		(void) prcv_dtq(DTQ2, &data);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("psnd_dtq", "nowait");
+
+	/*
+	 *  psnd_dtq（switch）
+	 */
+	perf_start(41U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = psnd_dtq(DTQ1, 1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("psnd_dtq", "switch");
+
+	/*
+	 *  tsnd_dtq（nowait）
+	 */
+	perf_start(42U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = tsnd_dtq(DTQ2, 1, PERF_TMOUT);
+		(void) end_measure(1);
+		(void) prcv_dtq(DTQ2, &data);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tsnd_dtq", "nowait");
+
+	/*
+	 *  tsnd_dtq（switch）
+	 */
+	perf_start(43U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = tsnd_dtq(DTQ1, 1, PERF_TMOUT);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tsnd_dtq", "switch");
+
+	/*
+	 *  tsnd_dtq（block）
+	 */
+	perf_start(44U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = tsnd_dtq(DTQ1, 1, PERF_TMOUT);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tsnd_dtq", "block");
+
+	/*
+	 *  fsnd_dtq（nowait）
+	 */
+	perf_start(45U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = fsnd_dtq(DTQ2, 1);
+		(void) end_measure(1);
+		(void) prcv_dtq(DTQ2, &data);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("fsnd_dtq", "nowait");
+
+	/*
+	 *  fsnd_dtq（switch）
+	 */
+	perf_start(46U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = fsnd_dtq(DTQ2, 1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("fsnd_dtq", "switch");
+
+	/*
+	 *  rcv_dtq（nowait）
+	 */
+	perf_start(47U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) psnd_dtq(DTQ2, 1);
+		(void) begin_measure(1);
+		ercd = rcv_dtq(DTQ2, &data);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("rcv_dtq", "nowait");
+
+	/*
+	 *  rcv_dtq（block）
+	 */
+	perf_start(48U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = rcv_dtq(DTQ1, &data);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("rcv_dtq", "block");
+
+	/*
+	 *  prcv_dtq（nowait）
+	 */
+	perf_start(49U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) psnd_dtq(DTQ2, 1);
+		(void) begin_measure(1);
+		ercd = prcv_dtq(DTQ2, &data);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("prcv_dtq", "nowait");
+
+	/*
+	 *  trcv_dtq（nowait）
+	 */
+	perf_start(50U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) psnd_dtq(DTQ2, 1);
+		(void) begin_measure(1);
+		ercd = trcv_dtq(DTQ2, &data, PERF_TMOUT);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("trcv_dtq", "nowait");
+
+	/*
+	 *  trcv_dtq（block）
+	 */
+	perf_start(51U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = trcv_dtq(DTQ1, &data, PERF_TMOUT);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("trcv_dtq", "block");
+
+	/*
+	 *  snd_pdq（nowait）
+	 */
+	perf_start(52U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = snd_pdq(PDQ2, 1, 1);
+		(void) end_measure(1);
+		(void) prcv_pdq(PDQ2, &data, &datapri);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("snd_pdq", "nowait");
+
+	/*
+	 *  snd_pdq（switch）
+	 */
+	perf_start(53U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = snd_pdq(PDQ1, 1, 1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("snd_pdq", "switch");
+
+	/*
+	 *  snd_pdq（block）
+	 */
+	perf_start(54U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = snd_pdq(PDQ1, 1, 1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("snd_pdq", "block");
+
+	/*
+	 *  psnd_pdq（nowait）
+	 */
+	perf_start(55U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = psnd_pdq(PDQ2, 1, 1);
+		(void) end_measure(1);
+		(void) prcv_pdq(PDQ2, &data, &datapri);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("psnd_pdq", "nowait");
+
+	/*
+	 *  psnd_pdq（switch）
+	 */
+	perf_start(56U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = psnd_pdq(PDQ1, 1, 1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("psnd_pdq", "switch");
+
+	/*
+	 *  tsnd_pdq（nowait）
+	 */
+	perf_start(57U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = tsnd_pdq(PDQ2, 1, 1, PERF_TMOUT);
+		(void) end_measure(1);
+		(void) prcv_pdq(PDQ2, &data, &datapri);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tsnd_pdq", "nowait");
+
+	/*
+	 *  tsnd_pdq（switch）
+	 */
+	perf_start(58U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = tsnd_pdq(PDQ1, 1, 1, PERF_TMOUT);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tsnd_pdq", "switch");
+
+	/*
+	 *  rcv_pdq（nowait）
+	 */
+	perf_start(59U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) psnd_pdq(PDQ2, 1, 1);
+		(void) begin_measure(1);
+		ercd = rcv_pdq(PDQ2, &data, &datapri);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("rcv_pdq", "nowait");
+
+	/*
+	 *  rcv_pdq（block）
+	 */
+	perf_start(60U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = rcv_pdq(PDQ1, &data, &datapri);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("rcv_pdq", "block");
+
+	/*
+	 *  prcv_pdq（nowait）
+	 */
+	perf_start(61U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) psnd_pdq(PDQ2, 1, 1);
+		(void) begin_measure(1);
+		ercd = prcv_pdq(PDQ2, &data, &datapri);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("prcv_pdq", "nowait");
+
+	/*
+	 *  trcv_pdq（nowait）
+	 */
+	perf_start(62U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) psnd_pdq(PDQ2, 1, 1);
+		(void) begin_measure(1);
+		ercd = trcv_pdq(PDQ2, &data, &datapri, PERF_TMOUT);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("trcv_pdq", "nowait");
+
+	/*
+	 *  trcv_pdq（block）
+	 */
+	perf_start(63U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = trcv_pdq(PDQ1, &data, &datapri, PERF_TMOUT);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("trcv_pdq", "block");
+
+	/*
+	 *  get_tim（nowait）
+	 */
+	perf_start(64U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_tim(&systim);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_tim", "nowait");
+
+	/*
+	 *  adj_tim（nowait）
+	 */
+	perf_start(65U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = adj_tim(0);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("adj_tim", "nowait");
+
+	/*
+	 *  loc_mtx（nowait）
+	 */
+	perf_start(66U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = loc_mtx(MTX1);
+		(void) end_measure(1);
+		(void) unl_mtx(MTX1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("loc_mtx", "nowait");
+
+	/*
+	 *  loc_mtx（ceiling）
+	 */
+	perf_start(67U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = loc_mtx(MTX2);
+		(void) end_measure(1);
+		(void) unl_mtx(MTX2);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("loc_mtx", "ceiling");
+
+	/*
+	 *  ploc_mtx（nowait）
+	 */
+	perf_start(68U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ploc_mtx(MTX1);
+		(void) end_measure(1);
+		(void) unl_mtx(MTX1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ploc_mtx", "nowait");
+
+	/*
+	 *  tloc_mtx（nowait）
+	 */
+	perf_start(69U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = tloc_mtx(MTX1, PERF_TMOUT);
+		(void) end_measure(1);
+		(void) unl_mtx(MTX1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tloc_mtx", "nowait");
+
+	/*
+	 *  unl_mtx（nowait）
+	 */
+	perf_start(70U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) loc_mtx(MTX1);
+		(void) begin_measure(1);
+		ercd = unl_mtx(MTX1);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("unl_mtx", "nowait");
+
+	/*
+	 *  unl_mtx（ceiling）
+	 */
+	perf_start(71U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) loc_mtx(MTX2);
+		(void) begin_measure(1);
+		ercd = unl_mtx(MTX2);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("unl_mtx", "ceiling");
+
+	/*
+	 *  unl_mtx（switch）
+	 */
+	perf_start(72U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) loc_mtx(MTX1);
+		(void) wup_tsk(TASK1);
+		(void) begin_measure(1);
+		ercd = unl_mtx(MTX1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("unl_mtx", "switch");
+
+	/*
+	 *  snd_mbf（nowait）
+	 */
+	perf_start(73U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = snd_mbf(MBF1, perf_smsg, PERF_MSGSZ);
+		(void) end_measure(1);
+		(void) prcv_mbf(MBF1, perf_rmsg);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("snd_mbf", "nowait");
+
+	/*
+	 *  snd_mbf（switch）
+	 */
+	perf_start(74U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = snd_mbf(MBF1, perf_smsg, PERF_MSGSZ);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("snd_mbf", "switch");
+
+	/*
+	 *  psnd_mbf（nowait）
+	 */
+	perf_start(75U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ);
+		(void) end_measure(1);
+		(void) prcv_mbf(MBF1, perf_rmsg);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("psnd_mbf", "nowait");
+
+	/*
+	 *  psnd_mbf（switch）
+	 */
+	perf_start(76U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("psnd_mbf", "switch");
+
+	/*
+	 *  tsnd_mbf（nowait）
+	 */
+	perf_start(77U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = tsnd_mbf(MBF1, perf_smsg, PERF_MSGSZ, PERF_TMOUT);
+		(void) end_measure(1);
+		(void) prcv_mbf(MBF1, perf_rmsg);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tsnd_mbf", "nowait");
+
+	/*
+	 *  tsnd_mbf（switch）
+	 */
+	perf_start(78U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = tsnd_mbf(MBF1, perf_smsg, PERF_MSGSZ, PERF_TMOUT);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tsnd_mbf", "switch");
+
+	/*
+	 *  rcv_mbf（nowait）
+	 */
+	perf_start(79U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ);
+		(void) begin_measure(1);
+		ercd = rcv_mbf(MBF1, perf_rmsg);
+		(void) end_measure(1);
+		check_ercd(ercd, PERF_MSGSZ);
+	}
+	perf_finish("rcv_mbf", "nowait");
+
+	/*
+	 *  rcv_mbf（block）
+	 */
+	perf_start(80U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = rcv_mbf(MBF1, perf_rmsg);
+		check_ercd(ercd, PERF_MSGSZ);
+	}
+	perf_finish("rcv_mbf", "block");
+
+	/*
+	 *  prcv_mbf（nowait）
+	 */
+	perf_start(81U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ);
+		(void) begin_measure(1);
+		ercd = prcv_mbf(MBF1, perf_rmsg);
+		(void) end_measure(1);
+		check_ercd(ercd, PERF_MSGSZ);
+	}
+	perf_finish("prcv_mbf", "nowait");
+
+	/*
+	 *  trcv_mbf（nowait）
+	 */
+	perf_start(82U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ);
+		(void) begin_measure(1);
+		ercd = trcv_mbf(MBF1, perf_rmsg, PERF_TMOUT);
+		(void) end_measure(1);
+		check_ercd(ercd, PERF_MSGSZ);
+	}
+	perf_finish("trcv_mbf", "nowait");
+
+	/*
+	 *  trcv_mbf（block）
+	 */
+	perf_start(83U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = trcv_mbf(MBF1, perf_rmsg, PERF_TMOUT);
+		check_ercd(ercd, PERF_MSGSZ);
+	}
+	perf_finish("trcv_mbf", "block");
+
+	/*
+	 *  get_mpf（nowait）
+	 */
+	perf_start(84U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_mpf(MPF1, &blk);
+		(void) end_measure(1);
+		(void) rel_mpf(MPF1, blk);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_mpf", "nowait");
+
+	/*
+	 *  get_mpf（block）
+	 */
+	perf_start(85U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) pget_mpf(MPF1, &blk);
+		(void) begin_measure(1);
+		ercd = get_mpf(MPF1, &blk2);
+		(void) rel_mpf(MPF1, blk2);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_mpf", "block");
+
+	/*
+	 *  pget_mpf（nowait）
+	 */
+	perf_start(86U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = pget_mpf(MPF1, &blk);
+		(void) end_measure(1);
+		(void) rel_mpf(MPF1, blk);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("pget_mpf", "nowait");
+
+	/*
+	 *  tget_mpf（nowait）
+	 */
+	perf_start(87U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = tget_mpf(MPF1, &blk, PERF_TMOUT);
+		(void) end_measure(1);
+		(void) rel_mpf(MPF1, blk);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tget_mpf", "nowait");
+
+	/*
+	 *  tget_mpf（block）
+	 */
+	perf_start(88U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) pget_mpf(MPF1, &blk);
+		(void) begin_measure(1);
+		ercd = tget_mpf(MPF1, &blk2, PERF_TMOUT);
+		(void) rel_mpf(MPF1, blk2);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("tget_mpf", "block");
+
+	/*
+	 *  rel_mpf（nowait）
+	 */
+	perf_start(89U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) pget_mpf(MPF1, &blk);
+		(void) begin_measure(1);
+		ercd = rel_mpf(MPF1, blk);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("rel_mpf", "nowait");
+
+	/*
+	 *  rel_mpf（switch）
+	 */
+	perf_start(90U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) pget_mpf(MPF1, &blk);
+		(void) wup_tsk(TASK1);
+		(void) begin_measure(1);
+		ercd = rel_mpf(MPF1, blk);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("rel_mpf", "switch");
+
+	/*
+	 *  fch_hrt（nowait）
+	 */
+	perf_start(91U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		(void) fch_hrt();
+		(void) end_measure(1);
+	}
+	perf_finish("fch_hrt", "nowait");
+
+	/*
+	 *  sta_cyc（nowait）
+	 */
+	perf_start(92U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = sta_cyc(CYC1);
+		(void) end_measure(1);
+		(void) stp_cyc(CYC1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("sta_cyc", "nowait");
+
+	/*
+	 *  stp_cyc（nowait）
+	 */
+	perf_start(93U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) sta_cyc(CYC1);
+		(void) begin_measure(1);
+		ercd = stp_cyc(CYC1);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("stp_cyc", "nowait");
+
+	/*
+	 *  sta_alm（nowait）
+	 */
+	perf_start(94U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = sta_alm(ALM1, PERF_ALMTIM);
+		(void) end_measure(1);
+		(void) stp_alm(ALM1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("sta_alm", "nowait");
+
+	/*
+	 *  stp_alm（nowait）
+	 */
+	perf_start(95U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) sta_alm(ALM1, PERF_ALMTIM);
+		(void) begin_measure(1);
+		ercd = stp_alm(ALM1);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("stp_alm", "nowait");
+
+	/*
+	 *  rot_rdq（nowait）
+	 */
+	perf_start(96U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = rot_rdq(MAIN_PRIORITY);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("rot_rdq", "nowait");
+
+	/*
+	 *  get_lod（nowait）
+	 */
+	perf_start(97U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_lod(MAIN_PRIORITY, &load);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_lod", "nowait");
+
+	/*
+	 *  get_did（nowait）
+	 */
+	perf_start(98U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_did(&domid);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_did", "nowait");
+
+	/*
+	 *  get_tid（nowait）
+	 */
+	perf_start(99U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_tid(&tskid);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_tid", "nowait");
+
+	/*
+	 *  get_nth（nowait）
+	 */
+	perf_start(100U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_nth(MAIN_PRIORITY, 0U, &tskid);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_nth", "nowait");
+
+	/*
+	 *  loc_cpu（nowait）
+	 */
+	perf_start(101U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = loc_cpu();
+		(void) end_measure(1);
+		(void) unl_cpu();
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("loc_cpu", "nowait");
+
+	/*
+	 *  unl_cpu（nowait）
+	 */
+	perf_start(102U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) loc_cpu();
+		(void) begin_measure(1);
+		ercd = unl_cpu();
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("unl_cpu", "nowait");
+
+	/*
+	 *  dis_dsp（nowait）
+	 */
+	perf_start(103U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = dis_dsp();
+		(void) end_measure(1);
+		(void) ena_dsp();
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("dis_dsp", "nowait");
+
+	/*
+	 *  ena_dsp（nowait）
+	 */
+	perf_start(104U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) dis_dsp();
+		(void) begin_measure(1);
+		ercd = ena_dsp();
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ena_dsp", "nowait");
+
+	/*
+	 *  ena_dsp（switch）
+	 */
+	perf_start(105U, true);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) dis_dsp();
+		(void) wup_tsk(TASK1);
+		(void) begin_measure(1);
+		ercd = ena_dsp();
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ena_dsp", "switch");
+
+	/*
+	 *  sns_ctx（nowait）
+	 */
+	perf_start(106U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		(void) sns_ctx();
+		(void) end_measure(1);
+	}
+	perf_finish("sns_ctx", "nowait");
+
+	/*
+	 *  sns_loc（nowait）
+	 */
+	perf_start(107U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		(void) sns_loc();
+		(void) end_measure(1);
+	}
+	perf_finish("sns_loc", "nowait");
+
+	/*
+	 *  sns_dsp（nowait）
+	 */
+	perf_start(108U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		(void) sns_dsp();
+		(void) end_measure(1);
+	}
+	perf_finish("sns_dsp", "nowait");
+
+	/*
+	 *  sns_dpn（nowait）
+	 */
+	perf_start(109U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		(void) sns_dpn();
+		(void) end_measure(1);
+	}
+	perf_finish("sns_dpn", "nowait");
+
+	/*
+	 *  sns_ker（nowait）
+	 */
+	perf_start(110U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		(void) sns_ker();
+		(void) end_measure(1);
+	}
+	perf_finish("sns_ker", "nowait");
+
+	/*
+	 *  prb_mem（nowait）
+	 */
+	perf_start(111U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = prb_mem(perf_smsg, PERF_MSGSZ, TSK_SELF, TPM_READ);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("prb_mem", "nowait");
+
+	/*
+	 *  ref_mem（nowait）
+	 */
+	perf_start(112U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_mem(perf_smsg, &rmem);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_mem", "nowait");
+
+	/*
+	 *  chg_ipm（nowait）
+	 */
+	perf_start(113U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = chg_ipm(TIPM_ENAALL);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("chg_ipm", "nowait");
+
+	/*
+	 *  get_ipm（nowait）
+	 */
+	perf_start(114U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_ipm(&intpri);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_ipm", "nowait");
+
+	/*
+	 *  get_som（nowait）
+	 */
+	perf_start(115U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = get_som(&somid);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("get_som", "nowait");
+
+	/*
+	 *  ini_sem（nowait）
+	 */
+	perf_start(116U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ini_sem(SEM1);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ini_sem", "nowait");
+
+	/*
+	 *  ini_flg（nowait）
+	 */
+	perf_start(117U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ini_flg(FLG1);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ini_flg", "nowait");
+
+	/*
+	 *  ini_dtq（nowait）
+	 */
+	perf_start(118U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ini_dtq(DTQ2);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ini_dtq", "nowait");
+
+	/*
+	 *  ini_pdq（nowait）
+	 */
+	perf_start(119U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ini_pdq(PDQ2);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ini_pdq", "nowait");
+
+	/*
+	 *  ini_mtx（nowait）
+	 */
+	perf_start(120U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ini_mtx(MTX1);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ini_mtx", "nowait");
+
+	/*
+	 *  ini_mbf（nowait）
+	 */
+	perf_start(121U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ini_mbf(MBF1);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ini_mbf", "nowait");
+
+	/*
+	 *  ini_mpf（nowait）
+	 */
+	perf_start(122U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ini_mpf(MPF1);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ini_mpf", "nowait");
+
+	/*
+	 *  ref_tsk（nowait）
+	 */
+	perf_start(123U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_tsk(TASK3, &rtsk);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_tsk", "nowait");
+
+	/*
+	 *  ref_sem（nowait）
+	 */
+	perf_start(124U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_sem(SEM1, &rsem);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_sem", "nowait");
+
+	/*
+	 *  ref_flg（nowait）
+	 */
+	perf_start(125U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_flg(FLG1, &rflg);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_flg", "nowait");
+
+	/*
+	 *  ref_dtq（nowait）
+	 */
+	perf_start(126U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_dtq(DTQ2, &rdtq);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_dtq", "nowait");
+
+	/*
+	 *  ref_pdq（nowait）
+	 */
+	perf_start(127U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_pdq(PDQ2, &rpdq);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_pdq", "nowait");
+
+	/*
+	 *  ref_mtx（nowait）
+	 */
+	perf_start(128U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_mtx(MTX1, &rmtx);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_mtx", "nowait");
+
+	/*
+	 *  ref_mbf（nowait）
+	 */
+	perf_start(129U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_mbf(MBF1, &rmbf);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_mbf", "nowait");
+
+	/*
+	 *  ref_mpf（nowait）
+	 */
+	perf_start(130U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_mpf(MPF1, &rmpf);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_mpf", "nowait");
+
+	/*
+	 *  ref_cyc（nowait）
+	 */
+	perf_start(131U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_cyc(CYC1, &rcyc);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_cyc", "nowait");
+
+	/*
+	 *  ref_alm（nowait）
+	 */
+	perf_start(132U, false);
+	for (i = 0; i < NO_MEASURE; i++) {
+		(void) begin_measure(1);
+		ercd = ref_alm(ALM1, &ralm);
+		(void) end_measure(1);
+		check_ercd(ercd, E_OK);
+	}
+	perf_finish("ref_alm", "nowait");
+
+	check_finish(0);
+}
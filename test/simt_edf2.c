@@ -0,0 +1,238 @@
+/*
+ *  TOPPERS Software
+ *      Toyohashi Open Platform for Embedded Real-Time Systems
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/* 
+ *		EDFスケジューリングのテスト(2)
+ *
+ * 【テストの目的】
+ *
+ *  EDFスケジューリングを行うスケジューリング単位で，絶対デッドライン
+ *  が同じタスクの間の優先順位と，イベント時刻が一周する前後の絶対デッ
+ *  ドラインの比較をテストする．
+ *
+ * 【テスト項目】
+ *
+ *	(A) 絶対デッドラインが同じタスクの間では，先に実行できる状態になっ
+ *		たタスクが優先される
+ *	(B) 絶対デッドラインがイベント時刻の一周をまたぐタスクと，またがな
+ *		いタスクの間で，絶対デッドラインの早い順に実行される
+ *
+ * 【使用リソース】
+ *
+ *	高分解能タイマモジュールの性質：HRT_CONFIG1
+ *		TCYC_HRTCNT		未定義（2^32の意味）
+ *		TSTEP_HRTCNT	1U
+ *		HRTCNT_BOUND	4000000002U
+ *
+ *	タイマドライバシミュレータのパラメータ
+ *		SIMTIM_INIT_CURRENT		10
+ *
+ *	システム周期: 1000
+ *	DOM1: システム周期の最初タイムウィンドウ（長さ: 500）を割当て，
+ *		  EDFスケジューリング
+ *	TASK1: DOM1，低優先度タスク，TA_ACT属性
+ *	TASK2: DOM1，中優先度タスク，相対デッドライン：500
+ *	TASK3: DOM1，中優先度タスク，相対デッドライン：500
+ *	TASK4: DOM1，中優先度タスク，相対デッドライン：800
+ *	TASK5: DOM1，中優先度タスク，相対デッドライン：1000
+ *	TASK6: DOM1，中優先度タスク，相対デッドライン：200
+ *
+ * 【補足説明】
+ *
+ *	タスクの実行中に時刻を進める場合には，タイマ割込みを発生させない
+ *	simtim_addを用いる．そのため，テストの途中でタイムウィンドウは切
+ *	り換わらない．
+ *
+ *	イベント時刻を一周の直前（WRAP_EVTTIM）まで進めるために，
+ *	HRTCNT_BOUNDを超えないように，2回に分けて時刻を進める．
+ *	WRAP_EVTTIMで起動したTASK5の絶対デッドラインはイベント時刻の一周
+ *	をまたいで500となり，TASK6の絶対デッドラインは2^32 - 300となる．
+ *	絶対デッドラインの値を単純に比較するとTASK5の方が早いが，現在時刻
+ *	からの残り時間はTASK6の方が短い．
+ *
+ * 【テストシーケンス】
+ *
+ *	== TASK1（優先度：低）==
+ *	1:	dis_dsp()
+ *		act_tsk(TASK2)
+ *		act_tsk(TASK4)
+ *		act_tsk(TASK3)
+ *		ena_dsp()											... (A)
+ *	== TASK2（優先度：中）==
+ *	2:	RETURN
+ *	== TASK3（優先度：中）==
+ *	3:	RETURN
+ *	== TASK4（優先度：中）==
+ *	4:	RETURN
+ *	== TASK1（続き）==
+ *	5:	DO(simtim_add(WRAP_STEP))
+ *		get_tim(&systim)
+ *		DO(simtim_add((uint_t)(WRAP_EVTTIM - systim)))
+ *		get_tim(&systim)
+ *		assert(systim == WRAP_EVTTIM)
+ *		dis_dsp()
+ *		act_tsk(TASK5)
+ *		act_tsk(TASK6)
+ *		ena_dsp()											... (B)
+ *	== TASK6（優先度：中）==
+ *	6:	RETURN
+ *	== TASK5（優先度：中）==
+ *	7:	RETURN
+ *	== TASK1（続き）==
+ *	8:	END
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "arch/simtimer/sim_timer_cntl.h"
+#include "kernel_cfg.h"
+#include "simt_edf2.h"
+
+#ifndef HRT_CONFIG1
+#error Compiler option "-DHRT_CONFIG1" is missing.
+#endif /* HRT_CONFIG1 */
+
+#ifndef USE_EDF_SCHED
+#error Compiler option "-DUSE_EDF_SCHED" is missing.
+#endif /* USE_EDF_SCHED */
+
+/* DO NOT DELETE THIS LINE -- gentest depends on it. */
+
+void
+task1(EXINF exinf)
+{
+	ER_UINT	ercd;
+	SYSTIM	systim;
+
+	test_start(__FILE__);
+
+	check_point(1);
+	ercd = dis_dsp();
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK2);
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK4);
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK3);
+	check_ercd(ercd, E_OK);
+
+	ercd = ena_dsp();
+	check_ercd(ercd, E_OK);
+
+	check_point(5);
+	simtim_add(WRAP_STEP);
+
+	ercd = get_tim(&systim);
+	check_ercd(ercd, E_OK);
+
+	simtim_add((uint_t)(WRAP_EVTTIM - systim));
+
+	ercd = get_tim(&systim);
+	check_ercd(ercd, E_OK);
+
+	check_assert(systim == WRAP_EVTTIM);
+
+	ercd = dis_dsp();
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK5);
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK6);
+	check_ercd(ercd, E_OK);
+
+	ercd = ena_dsp();
+	check_ercd(ercd, E_OK);
+
+	check_finish(8);
+	check_assert(false);
+}
+
+void
+task2(EXINF exinf)
+{
+
+	check_point(2);
+	return;
+
+	check_assert(false);
+}
+
+void
+task3(EXINF exinf)
+{
+
+	check_point(3);
+	return;
+
+	check_assert(false);
+}
+
+void
+task4(EXINF exinf)
+{
+
+	check_point(4);
+	return;
+
+	check_assert(false);
+}
+
+void
+task5(EXINF exinf)
+{
+
+	check_point(7);
+	return;
+
+	check_assert(false);
+}
+
+void
+task6(EXINF exinf)
+{
+
+	check_point(6);
+	return;
+
+	check_assert(false);
+}
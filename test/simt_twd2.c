@@ -0,0 +1,268 @@
+/*
+ *  TOPPERS Software
+ *      Toyohashi Open Platform for Embedded Real-Time Systems
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/*
+ *		タイムウィンドウ管理機能のテスト(2)
+ *
+ * 【テストの目的】
+ *
+ *  タイムウィンドウの余剰時間の再割当て（USE_SLACK_RECLAIM）について
+ *  テストする．
+ *
+ * 【テスト項目】
+ *
+ *	(A) ATT_SLKで指定したユーザドメインのタスクが，他のタイムウィンド
+ *		ウの余剰時間に実行される
+ *	(B) ATT_SLKで指定していないユーザドメインのタスクは，他のタイムウィ
+ *		ンドウの余剰時間に実行されない
+ *	(C) ATT_SLKで指定したユーザドメインに実行できるタスクがない場合に
+ *		は，アイドルドメインのタスクが余剰時間に実行される
+ *	(D) タイムウィンドウ毎の使用時間の統計情報（twdstat_table）が正し
+ *		く計測される
+ *
+ * 【使用リソース】
+ *
+ *	高分解能タイマモジュールの性質：HRT_CONFIG1
+ *		TCYC_HRTCNT		未定義（2^32の意味）
+ *		TSTEP_HRTCNT	1U
+ *		HRTCNT_BOUND	4000000002U
+ *
+ *	タイマドライバシミュレータのパラメータ
+ *		SIMTIM_INIT_CURRENT		10
+ *		SIMTIM_OVERHEAD_HRTINT	10
+ *		SIMTIM_OVERHEAD_TWDINT	10
+ *
+ *	システム周期: 1000
+ *	DOM1: システム周期の1番目のタイムウィンドウ（長さ: 500）を割当て
+ *	DOM2: システム周期の2番目のタイムウィンドウ（長さ: 200）を割当て，
+ *		  ATT_SLKで余剰時間を割り当てる
+ *	DOM3: システム周期の3番目のタイムウィンドウ（長さ: 100）を割当て
+ *	DOM4: タイムウィンドウを割り当てない
+ *	TASK1: DOM1，中優先度，TA_ACT属性
+ *	TASK2: DOM2，中優先度，TA_ACT属性
+ *	TASK3: DOM3，中優先度，TA_ACT属性
+ *	TASK4: DOM4，中優先度，TA_ACT属性
+ *	TASK5: カーネルドメイン，高優先度
+ *
+ * 【補足説明】
+ *
+ *	TASK3は最初から実行できる状態であるが，DOM3のタイムウィンドウ以外
+ *	では実行されない．TASK3が余剰時間に実行されると，チェックポイント
+ *	の順序が合わなくなる．
+ *
+ *	twdstat_tableは，タイムウィンドウの終了時に格納されるため，アイド
+ *	ルウィンドウの中で参照する．
+ *
+ * 【テストシーケンス】
+ *
+ *	== HRT_HANDLER ==										// 時刻：10
+ *	//	時刻が10進む
+ *	// タイムウィンドウ for DOM1
+ *	== TASK1 ==
+ *	1:	assert(fch_hrt() == 20U)							// 時刻：20
+ *		DO(simtim_advance(100U))
+ *		slp_tsk()
+ *	// 余剰時間 for DOM2
+ *	== TASK2 ==
+ *	2:	assert(fch_hrt() == 120U)							// 時刻：120
+ *		DO(simtim_advance(100U))							... (A)
+ *		slp_tsk()
+ *	// 余剰時間 for アイドルドメイン
+ *	== TASK4 ==
+ *	3:	assert(fch_hrt() == 220U)							// 時刻：220
+ *		DO(simtim_advance(299U))							... (B)(C)
+ *	4:	assert(fch_hrt() == 519U)							// 時刻：519
+ *		DO(simtim_advance(1U))
+ *	== TWD_HANDLER ==										// 時刻：520
+ *	//	時刻が10進む
+ *	// タイムウィンドウ for DOM2
+ *	// 余剰時間 for アイドルドメイン
+ *	== TASK4（続き）==
+ *	5:	assert(fch_hrt() == 530U)							// 時刻：530
+ *		DO(simtim_advance(200U))							... (B)
+ *	== TWD_HANDLER ==										// 時刻：730
+ *	//	時刻が10進む
+ *	// タイムウィンドウ for DOM3
+ *	== TASK3 ==
+ *	6:	assert(fch_hrt() == 740U)							// 時刻：740
+ *		DO(simtim_advance(100U))
+ *	== TWD_HANDLER ==										// 時刻：840
+ *	//	時刻が10進む
+ *	// アイドルウィンドウ
+ *	== TASK4（続き）==
+ *	7:	assert(fch_hrt() == 850U)							// 時刻：850
+ *		act_tsk(TASK5)
+ *	== TASK5 ==
+ *	8:	assert(_kernel_twdstat_table[0].usedtim == 100U)	... (D)
+ *		assert(_kernel_twdstat_table[0].slktim == 400U)		... (D)
+ *		assert(_kernel_twdstat_table[1].usedtim == 0U)		... (D)
+ *		assert(_kernel_twdstat_table[1].slktim == 200U)		... (D)
+ *		assert(_kernel_twdstat_table[2].usedtim == 100U)	... (D)
+ *		assert(_kernel_twdstat_table[2].slktim == 0U)		... (D)
+ *	9:	END
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "arch/simtimer/sim_timer_cntl.h"
+#include "kernel_cfg.h"
+#include "simt_twd2.h"
+
+#ifndef HRT_CONFIG1
+#error Compiler option "-DHRT_CONFIG1" is missing.
+#endif /* HRT_CONFIG1 */
+
+#ifndef USE_SLACK_RECLAIM
+#error Compiler option "-DUSE_SLACK_RECLAIM" is missing.
+#endif /* USE_SLACK_RECLAIM */
+
+/*
+ *  タイムウィンドウの使用時間の統計情報（kernel/domain.hと同じ構造）
+ */
+typedef struct {
+	PRCTIM		usedtim;
+	PRCTIM		slktim;
+} TWDSTAT;
+
+extern TWDSTAT	_kernel_twdstat_table[];
+
+/* DO NOT DELETE THIS LINE -- gentest depends on it. */
+
+void
+HRT_HANDLER(void)
+{
+
+	test_start(__FILE__);
+
+	check_assert(false);
+}
+
+void
+task1(EXINF exinf)
+{
+	ER_UINT	ercd;
+
+	check_point(1);
+	check_assert(fch_hrt() == 20U);
+
+	simtim_advance(100U);
+
+	ercd = slp_tsk();
+	check_ercd(ercd, E_OK);
+
+	check_assert(false);
+}
+
+void
+task2(EXINF exinf)
+{
+	ER_UINT	ercd;
+
+	check_point(2);
+	check_assert(fch_hrt() == 120U);
+
+	simtim_advance(100U);
+
+	ercd = slp_tsk();
+	check_ercd(ercd, E_OK);
+
+	check_assert(false);
+}
+
+void
+task3(EXINF exinf)
+{
+
+	check_point(6);
+	check_assert(fch_hrt() == 740U);
+
+	simtim_advance(100U);
+
+	check_assert(false);
+}
+
+void
+task4(EXINF exinf)
+{
+	ER_UINT	ercd;
+
+	check_point(3);
+	check_assert(fch_hrt() == 220U);
+
+	simtim_advance(299U);
+
+	check_point(4);
+	check_assert(fch_hrt() == 519U);
+
+	simtim_advance(1U);
+
+	check_point(5);
+	check_assert(fch_hrt() == 530U);
+
+	simtim_advance(200U);
+
+	check_point(7);
+	check_assert(fch_hrt() == 850U);
+
+	ercd = act_tsk(TASK5);
+	check_ercd(ercd, E_OK);
+
+	check_assert(false);
+}
+
+void
+task5(EXINF exinf)
+{
+
+	check_point(8);
+	check_assert(_kernel_twdstat_table[0].usedtim == 100U);
+
+	check_assert(_kernel_twdstat_table[0].slktim == 400U);
+
+	check_assert(_kernel_twdstat_table[1].usedtim == 0U);
+
+	check_assert(_kernel_twdstat_table[1].slktim == 200U);
+
+	check_assert(_kernel_twdstat_table[2].usedtim == 100U);
+
+	check_assert(_kernel_twdstat_table[2].slktim == 0U);
+
+	check_finish(9);
+	check_assert(false);
+}
@@ -43,6 +43,7 @@
  */
 
 #include "tBitKernel_tecsgen.h"
+#include <t_syslog.h>
 #include "kernel/kernel_impl.h"
 #include "kernel/task.h"
 #include "kernel/wait.h"
@@ -53,6 +54,7 @@
 #include "kernel/mutex.h"
 #include "kernel/messagebuf.h"
 #include "kernel/mempfix.h"
+#include "kernel/channel.h"
 #include "kernel/cyclic.h"
 #include "kernel/alarm.h"
 #include "kernel/time_event.h"
@@ -121,6 +123,10 @@
 		((((char *)(p_mpfcb)) - ((char *) mpfcb_table)) % sizeof(MPFCB) == 0 \
 			&& TMIN_MPFID <= MPFID(p_mpfcb) && MPFID(p_mpfcb) <= tmax_mpfid)
 
+#define VALID_CHNCB(p_chncb) \
+		((((char *)(p_chncb)) - ((char *) chncb_table)) % sizeof(CHNCB) == 0 \
+			&& TMIN_CHNID <= CHNID(p_chncb) && CHNID(p_chncb) <= tmax_chnid)
+
 #define VALID_TMEVTN(p_tmevtn, p_tmevt_heap) \
 		((((char *)(p_tmevtn)) - ((char *) p_tmevt_heap)) % sizeof(TMEVTN) == 0\
 			&& p_top_tmevtn(p_tmevt_heap) <= (p_tmevtn)						   \
@@ -242,11 +248,11 @@ primap_extract_bit(uint_t pri, SCHEDCB *p_schedcb)
 }
 
 static ER
-bit_schedcb(SCHEDCB *p_schedcb)
+bit_schedcb_head(SCHEDCB *p_schedcb)
 {
+#ifdef PRIMAP_LEVEL_2
 	uint_t	pri;
-	QUEUE	*p_queue;
-	TCB		*p_tcb;
+#endif /* PRIMAP_LEVEL_2 */
 
 	/*
 	 *  p_predtskの整合性検査
@@ -281,34 +287,77 @@ bit_schedcb(SCHEDCB *p_schedcb)
 		}
 	}
 #endif /* PRIMAP_LEVEL_2 */
+	return(E_OK);
+}
+
+/*
+ *  優先度毎のレディキューの整合性検査
+ *
+ *  ready_queue[pri]とready_primapの整合性を検査する．
+ */
+static ER
+bit_schedcb_pri(SCHEDCB *p_schedcb, uint_t pri)
+{
+	QUEUE	*p_queue;
+	TCB		*p_tcb;
+
+	p_queue = p_schedcb->ready_queue[pri].p_next;
+	if (p_queue == &(p_schedcb->ready_queue[pri])) {
+		if (primap_extract_bit(pri, p_schedcb) != 0U) {
+			return(E_SYS_LINENO);
+		}
+	}
+	else {
+		if (primap_extract_bit(pri, p_schedcb) == 0U) {
+			return(E_SYS_LINENO);
+		}
+	}
+	while (p_queue != &(p_schedcb->ready_queue[pri])) {
+		p_tcb = (TCB *) p_queue;
+		if (!VALID_TCB(p_tcb)) {
+			return(E_SYS_LINENO);
+		}
+		if (!TSTAT_RUNNABLE(p_tcb->tstat)) {
+			return(E_SYS_LINENO);
+		}
+		if (p_tcb->priority != pri) {
+			return(E_SYS_LINENO);
+		}
+#ifdef USE_EDF_SCHED
+		/*
+		 *  EDFスケジューリングを行う場合の絶対デッドラインの順序の検
+		 *  査
+		 */
+		if (p_schedcb->edf
+				&& p_queue->p_next != &(p_schedcb->ready_queue[pri])
+				&& deadline_left((TCB *)(p_queue->p_next))
+												< deadline_left(p_tcb)) {
+			return(E_SYS_LINENO);
+		}
+#endif /* USE_EDF_SCHED */
+		p_queue = p_queue->p_next;
+	}
+	return(E_OK);
+}
+
+static ER
+bit_schedcb(SCHEDCB *p_schedcb)
+{
+	uint_t	pri;
+	ER		ercd;
+
+	ercd = bit_schedcb_head(p_schedcb);
+	if (ercd != E_OK) {
+		return(ercd);
+	}
 
 	/*
 	 *  ready_queueとready_primapの整合性検査
 	 */
 	for (pri = 0; pri < TNUM_TPRI; pri++) {
-		p_queue = p_schedcb->ready_queue[pri].p_next;
-		if (p_queue == &(p_schedcb->ready_queue[pri])) {
-			if (primap_extract_bit(pri, p_schedcb) != 0U) {
-				return(E_SYS_LINENO);
-			}
-		}
-		else {
-			if (primap_extract_bit(pri, p_schedcb) == 0U) {
-				return(E_SYS_LINENO);
-			}
-		}
-		while (p_queue != &(p_schedcb->ready_queue[pri])) {
-			p_tcb = (TCB *) p_queue;
-			if (!VALID_TCB(p_tcb)) {
-				return(E_SYS_LINENO);
-			}
-			if (!TSTAT_RUNNABLE(p_tcb->tstat)) {
-				return(E_SYS_LINENO);
-			}
-			if (p_tcb->priority != pri) {
-				return(E_SYS_LINENO);
-			}
-			p_queue = p_queue->p_next;
+		ercd = bit_schedcb_pri(p_schedcb, pri);
+		if (ercd != E_OK) {
+			return(ercd);
 		}
 	}
 	return(E_OK);
@@ -325,11 +374,8 @@ bit_schedcb(SCHEDCB *p_schedcb)
 #define EVTTIM_LE(t1, t2)	(EVTTIM_ADVANCE(t1) <= EVTTIM_ADVANCE(t2))
 
 static ER
-bit_tmevt_heap(TMEVTN *p_tmevt_heap)
+bit_tmevt_heap_head(TMEVTN *p_tmevt_heap)
 {
-	TMEVTN	*p_tmevtn, *p_child;
-	TMEVTB	*p_tmevtb;
-
 	/*
 	 *  p_last_tmevtn（＝p_tmevt_heap[0].p_last）の検査
 	 */
@@ -356,54 +402,80 @@ bit_tmevt_heap(TMEVTN *p_tmevt_heap)
 	}
 #endif
 
+	return(E_OK);
+}
+
+/*
+ *  タイムイベントノード毎の検査
+ */
+static ER
+bit_tmevtn(TMEVTN *p_tmevtn, TMEVTN *p_tmevt_heap)
+{
+	TMEVTN	*p_child;
+	TMEVTB	*p_tmevtb;
+
 	/*
-	 *  タイムイベントノード毎の検査
+	 *  対応するタイムイベントブロックを取得
 	 */
-	for (p_tmevtn = p_top_tmevtn(p_tmevt_heap);
-					p_tmevtn <= p_last_tmevtn(p_tmevt_heap); p_tmevtn++) {
-		/*
-		 *  対応するタイムイベントブロックを取得
-		 */
-		p_tmevtb = p_tmevtn->p_tmevtb;
+	p_tmevtb = p_tmevtn->p_tmevtb;
 
-		/*
-		 *  p_tmevtnの検査
-		 */
-		if (p_tmevtn != p_tmevtb->p_tmevtn) {
-			return(E_SYS_LINENO);
-		}
+	/*
+	 *  p_tmevtnの検査
+	 */
+	if (p_tmevtn != p_tmevtb->p_tmevtn) {
+		return(E_SYS_LINENO);
+	}
 
-		/*
-		 *  evttimの検査
-		 */
-		/* 左の子ノードよりイベント発生時刻が早いか同じ */
-		if ((p_child = LCHILD(p_tmevtn, p_tmevt_heap))
+	/*
+	 *  evttimの検査
+	 */
+	/* 左の子ノードよりイベント発生時刻が早いか同じ */
+	if ((p_child = LCHILD(p_tmevtn, p_tmevt_heap))
 										<= p_last_tmevtn(p_tmevt_heap)) {
-			if (!EVTTIM_LE(p_tmevtb->evttim, p_child->p_tmevtb->evttim)) {
-				return(E_SYS_LINENO);
-			}
+		if (!EVTTIM_LE(p_tmevtb->evttim, p_child->p_tmevtb->evttim)) {
+			return(E_SYS_LINENO);
 		}
-		/* 右の子ノードよりイベント発生時刻が早いか同じ */
-		if ((p_child = RCHILD(p_tmevtn, p_tmevt_heap))
+	}
+	/* 右の子ノードよりイベント発生時刻が早いか同じ */
+	if ((p_child = RCHILD(p_tmevtn, p_tmevt_heap))
 										<= p_last_tmevtn(p_tmevt_heap)) {
-			if (!EVTTIM_LE(p_tmevtb->evttim, p_child->p_tmevtb->evttim)) {
-				return(E_SYS_LINENO);
-			}
+		if (!EVTTIM_LE(p_tmevtb->evttim, p_child->p_tmevtb->evttim)) {
+			return(E_SYS_LINENO);
 		}
 	}
 	return(E_OK);
 }
 
-/*
- *  保護ドメイン関連の整合性検査
- */
 static ER
-bit_domain(void)
+bit_tmevt_heap(TMEVTN *p_tmevt_heap)
 {
-	ID		domid;
-	uint_t	i;
+	TMEVTN	*p_tmevtn;
 	ER		ercd;
 
+	ercd = bit_tmevt_heap_head(p_tmevt_heap);
+	if (ercd != E_OK) {
+		return(ercd);
+	}
+
+	/*
+	 *  タイムイベントノード毎の検査
+	 */
+	for (p_tmevtn = p_top_tmevtn(p_tmevt_heap);
+					p_tmevtn <= p_last_tmevtn(p_tmevt_heap); p_tmevtn++) {
+		ercd = bit_tmevtn(p_tmevtn, p_tmevt_heap);
+		if (ercd != E_OK) {
+			return(ercd);
+		}
+	}
+	return(E_OK);
+}
+
+/*
+ *  実行すべきタスクの整合性検査
+ */
+static ER
+bit_schedtsk(void)
+{
 	/*
 	 *  p_schedtskの整合性検査
 	 */
@@ -436,44 +508,15 @@ bit_domain(void)
 		}
 	}
 
-	/*
-	 *  スケジューリング単位毎の整合性検査
-	 */
-	ercd = bit_schedcb(&schedcb_kernel);
-	if (ercd != E_OK) {
-		return(ercd);
-	}
-	ercd = bit_schedcb(&schedcb_idle);
-	if (ercd != E_OK) {
-		return(ercd);
-	}
-	for (i = 0; i < tnum_schedcb; i++) {
-		ercd = bit_schedcb(&(schedcb_table[i]));
-		if (ercd != E_OK) {
-			return(ercd);
-		}
-	}
-
-	/*
-	 *  タイムイベントヒープ毎の整合性検査
-	 */
-	ercd = bit_tmevt_heap(tmevt_heap_kernel);
-	if (ercd != E_OK) {
-		return(ercd);
-	}
-	if (system_cyctim != 0U) {
-		ercd = bit_tmevt_heap(tmevt_heap_idle);
-		if (ercd != E_OK) {
-			return(ercd);
-		}
-	}
-	for (domid = TMIN_DOMID; domid <= tmax_domid; domid++) {
-		ercd = bit_tmevt_heap(get_dominib(domid)->p_tmevt_heap);
-		if (ercd != E_OK) {
-			return(ercd);
-		}
-	}
+	return(E_OK);
+}
 
+/*
+ *  時間パーティショニングの状態の整合性検査
+ */
+static ER
+bit_cursom(void)
+{
 	/*
 	 *  p_cursom，p_runtwd，p_twdsched，p_idleschedの整合性検査
 	 */
@@ -547,6 +590,62 @@ bit_domain(void)
 	return(E_OK);
 }
 
+/*
+ *  保護ドメイン関連の整合性検査
+ */
+static ER
+bit_domain(void)
+{
+	ID		domid;
+	uint_t	i;
+	ER		ercd;
+
+	ercd = bit_schedtsk();
+	if (ercd != E_OK) {
+		return(ercd);
+	}
+
+	/*
+	 *  スケジューリング単位毎の整合性検査
+	 */
+	ercd = bit_schedcb(&schedcb_kernel);
+	if (ercd != E_OK) {
+		return(ercd);
+	}
+	ercd = bit_schedcb(&schedcb_idle);
+	if (ercd != E_OK) {
+		return(ercd);
+	}
+	for (i = 0; i < tnum_schedcb; i++) {
+		ercd = bit_schedcb(&(schedcb_table[i]));
+		if (ercd != E_OK) {
+			return(ercd);
+		}
+	}
+
+	/*
+	 *  タイムイベントヒープ毎の整合性検査
+	 */
+	ercd = bit_tmevt_heap(tmevt_heap_kernel);
+	if (ercd != E_OK) {
+		return(ercd);
+	}
+	if (system_cyctim != 0U) {
+		ercd = bit_tmevt_heap(tmevt_heap_idle);
+		if (ercd != E_OK) {
+			return(ercd);
+		}
+	}
+	for (domid = TMIN_DOMID; domid <= tmax_domid; domid++) {
+		ercd = bit_tmevt_heap(get_dominib(domid)->p_tmevt_heap);
+		if (ercd != E_OK) {
+			return(ercd);
+		}
+	}
+
+	return(bit_cursom());
+}
+
 /*
  *  タスク毎の整合性検査
  */
@@ -567,6 +666,7 @@ bit_task(ID tskid)
 	const MTXINIB	*p_mtxinib;
 	MBFCB			*p_mbfcb;
 	MPFCB			*p_mpfcb;
+	CHNCB			*p_chncb;
 	size_t			winfo_size;
 
 	if (!VALID_TSKID(tskid)) {
@@ -839,6 +939,28 @@ bit_task(ID tskid)
 			winfo_size = sizeof(WINFO_MPF);
 			break;
 
+		case TS_WAITING_SCHN:
+			p_chncb = ((WINFO_CHN *)(p_tcb->p_winfo))->p_chncb;
+			if (!VALID_CHNCB(p_chncb)) {
+				return(E_SYS_LINENO);
+			}
+			if (!in_queue(&(p_chncb->swait_queue), &(p_tcb->task_queue))) {
+				return(E_SYS_LINENO);
+			}
+			winfo_size = sizeof(WINFO_CHN);
+			break;
+
+		case TS_WAITING_RCHN:
+			p_chncb = ((WINFO_CHN *)(p_tcb->p_winfo))->p_chncb;
+			if (!VALID_CHNCB(p_chncb)) {
+				return(E_SYS_LINENO);
+			}
+			if (!in_queue(&(p_chncb->rwait_queue), &(p_tcb->task_queue))) {
+				return(E_SYS_LINENO);
+			}
+			winfo_size = sizeof(WINFO_CHN);
+			break;
+
 		default:
 			return(E_SYS_LINENO);
 			break;
@@ -1305,6 +1427,7 @@ bit_cyclic(ID cycid)
 {
 	CYCCB			*p_cyccb;
 	const CYCINIB	*p_cycinib;
+	CYCGCB			*p_cycgcb;
 
 	if (!VALID_CYCID(cycid)) {
 		return(E_ID);
@@ -1324,9 +1447,33 @@ bit_cyclic(ID cycid)
 	 */
 	switch (p_cyccb->cycsta) {
 	case false:
+		if (p_cyccb->ingrp) {
+			return(E_SYS_LINENO);
+		}
 		break;
 
 	case true:
+		if (p_cyccb->ingrp) {
+			/*
+			 *  周期通知グループにより起動される場合は，グループのタイ
+			 *  ムイベントを検査する．
+			 */
+			p_cycgcb = p_cycinib->p_cycgcb;
+			if (p_cycgcb == NULL || p_cycgcb->actcnt == 0U) {
+				return(E_SYS_LINENO);
+			}
+			if (!valid_tmevtb(&(p_cycgcb->tmevtb),
+							p_cycgcb->p_cycginib->p_tmevt_heap)) {
+				return(E_SYS_LINENO);
+			}
+			if (p_cycgcb->tmevtb.callback != (CBACK) call_cycgrp) {
+				return(E_SYS_LINENO);
+			}
+			if (p_cycgcb->tmevtb.arg != (void *) p_cycgcb) {
+				return(E_SYS_LINENO);
+			}
+			break;
+		}
 		if (!valid_tmevtb(&(p_cyccb->tmevtb),
 							p_cyccb->p_cycinib->p_tmevt_heap)) {
 			return(E_SYS_LINENO);
@@ -1490,3 +1637,346 @@ eBuiltInTest_builtInTest(void)
 	}
 	return(E_OK);
 }
+
+/*
+ *  段階的な整合性検査
+ *
+ *  eIncrementalTest_stepを1回呼び出す毎に，検査対象の1単位（スケジュー
+ *  リング単位管理ブロックの1つの優先度，タイムイベントヒープの
+ *  ATTR_heapNodesPerStep個のノード，または1つのオブジェクト）だけを，
+ *  CPUロック状態で検査する．検査の進捗はVAR_phase，VAR_index，
+ *  VAR_subIndexに保持し，次の呼出しでその続きから検査する．すべての検
+ *  査対象を検査すると，VAR_roundを1増やして最初から検査する．不整合を
+ *  検出した場合には，その検査対象の残りの検査を打ち切り，次の検査対象
+ *  に進む．
+ */
+#define BIT_PHASE_STATE		0U		/* 実行すべきタスク等の検査 */
+#define BIT_PHASE_SCHEDCB	1U		/* スケジューリング単位の検査 */
+#define BIT_PHASE_TMEVT		2U		/* タイムイベントヒープの検査 */
+#define BIT_PHASE_TASK		3U		/* タスクの検査 */
+#define BIT_PHASE_SEM		4U		/* セマフォの検査 */
+#define BIT_PHASE_FLG		5U		/* イベントフラグの検査 */
+#define BIT_PHASE_DTQ		6U		/* データキューの検査 */
+#define BIT_PHASE_MTX		7U		/* ミューテックスの検査 */
+#define BIT_PHASE_CYC		8U		/* 周期通知の検査 */
+#define BIT_PHASE_ALM		9U		/* アラーム通知の検査 */
+#define BIT_PHASE_END		10U
+
+/*
+ *  スケジューリング単位管理ブロックの取出し
+ *
+ *  0はカーネルドメイン，1はアイドルドメイン，2以降はschedcb_tableの
+ *  要素に対応する．
+ */
+static SCHEDCB *
+get_bit_schedcb(uint_t index)
+{
+	if (index == 0U) {
+		return(&schedcb_kernel);
+	}
+	else if (index == 1U) {
+		return(&schedcb_idle);
+	}
+	else {
+		return(&(schedcb_table[index - 2U]));
+	}
+}
+
+/*
+ *  タイムイベントヒープの取出し
+ *
+ *  0はカーネルドメイン，1はアイドルドメイン，2以降はユーザドメインの
+ *  タイムイベントヒープに対応する．時間パーティショニングを使用しない
+ *  場合のアイドルドメインに対しては，NULLを返す．
+ */
+static TMEVTN *
+get_bit_tmevt_heap(uint_t index)
+{
+	if (index == 0U) {
+		return(tmevt_heap_kernel);
+	}
+	else if (index == 1U) {
+		return((system_cyctim != 0U) ? tmevt_heap_idle : NULL);
+	}
+	else {
+		return(get_dominib((ID)(TMIN_DOMID + (index - 2U)))->p_tmevt_heap);
+	}
+}
+
+/*
+ *  各段階の検査対象の数
+ */
+static uint_t
+bit_phase_count(uint_t phase)
+{
+	switch (phase) {
+	case BIT_PHASE_STATE:
+		return(1U);
+	case BIT_PHASE_SCHEDCB:
+		return(tnum_schedcb + 2U);
+	case BIT_PHASE_TMEVT:
+		return(tnum_udom + 2U);
+	case BIT_PHASE_TASK:
+		return((uint_t)(tmax_tskid - TMIN_TSKID + 1));
+	case BIT_PHASE_SEM:
+		return((uint_t)(tmax_semid - TMIN_SEMID + 1));
+	case BIT_PHASE_FLG:
+		return((uint_t)(tmax_flgid - TMIN_FLGID + 1));
+	case BIT_PHASE_DTQ:
+		return((uint_t)(tmax_dtqid - TMIN_DTQID + 1));
+	case BIT_PHASE_MTX:
+		return((uint_t)(tmax_mtxid - TMIN_MTXID + 1));
+	case BIT_PHASE_CYC:
+		return((uint_t)(tmax_cycid - TMIN_CYCID + 1));
+	case BIT_PHASE_ALM:
+		return((uint_t)(tmax_almid - TMIN_ALMID + 1));
+	default:
+		return(0U);
+	}
+}
+
+/*
+ *  次の検査対象に進める
+ */
+static void
+bit_next_index(void)
+{
+	VAR_index++;
+	VAR_subIndex = 0U;
+}
+
+/*
+ *  検査の1単位の実行
+ *
+ *  CPUロック状態で呼び出す．
+ */
+static ER
+bit_step(void)
+{
+	SCHEDCB	*p_schedcb;
+	TMEVTN	*p_tmevt_heap;
+	uint_t	i;
+	ER		ercd = E_OK;
+
+	/*
+	 *  検査対象が残っていない段階を読み飛ばす
+	 */
+	while (VAR_index >= bit_phase_count(VAR_phase)) {
+		VAR_phase++;
+		VAR_index = 0U;
+		VAR_subIndex = 0U;
+		if (VAR_phase >= BIT_PHASE_END) {
+			VAR_phase = BIT_PHASE_STATE;
+			VAR_round++;
+		}
+	}
+
+	switch (VAR_phase) {
+	case BIT_PHASE_STATE:
+		ercd = bit_schedtsk();
+		if (ercd == E_OK) {
+			ercd = bit_cursom();
+		}
+		bit_next_index();
+		break;
+
+	case BIT_PHASE_SCHEDCB:
+		/*
+		 *  1回の呼出しで1つの優先度のレディキューを検査する．
+		 */
+		p_schedcb = get_bit_schedcb(VAR_index);
+		if (VAR_subIndex == 0U) {
+			ercd = bit_schedcb_head(p_schedcb);
+		}
+		if (ercd == E_OK) {
+			ercd = bit_schedcb_pri(p_schedcb, VAR_subIndex);
+		}
+		VAR_subIndex++;
+		if (ercd != E_OK || VAR_subIndex >= TNUM_TPRI) {
+			bit_next_index();
+		}
+		break;
+
+	case BIT_PHASE_TMEVT:
+		/*
+		 *  1回の呼出しで最大ATTR_heapNodesPerStep個のノードを検査す
+		 *  る．VAR_subIndexは，次に検査するノードの番号である．
+		 */
+		p_tmevt_heap = get_bit_tmevt_heap(VAR_index);
+		if (p_tmevt_heap == NULL) {
+			bit_next_index();
+			break;
+		}
+		if (VAR_subIndex == 0U) {
+			ercd = bit_tmevt_heap_head(p_tmevt_heap);
+			VAR_subIndex = 1U;
+		}
+		for (i = 0U; ercd == E_OK && i < ATTR_heapNodesPerStep
+					&& p_tmevt_heap + VAR_subIndex
+									<= p_last_tmevtn(p_tmevt_heap); i++) {
+			ercd = bit_tmevtn(p_tmevt_heap + VAR_subIndex, p_tmevt_heap);
+			VAR_subIndex++;
+		}
+		if (ercd != E_OK || p_tmevt_heap + VAR_subIndex
+										> p_last_tmevtn(p_tmevt_heap)) {
+			bit_next_index();
+		}
+		break;
+
+	case BIT_PHASE_TASK:
+		ercd = bit_task((ID)(TMIN_TSKID + VAR_index));
+		bit_next_index();
+		break;
+
+	case BIT_PHASE_SEM:
+		ercd = bit_semaphore((ID)(TMIN_SEMID + VAR_index));
+		bit_next_index();
+		break;
+
+	case BIT_PHASE_FLG:
+		ercd = bit_eventflag((ID)(TMIN_FLGID + VAR_index));
+		bit_next_index();
+		break;
+
+	case BIT_PHASE_DTQ:
+		ercd = bit_dataqueue((ID)(TMIN_DTQID + VAR_index));
+		bit_next_index();
+		break;
+
+	case BIT_PHASE_MTX:
+		ercd = bit_mutex((ID)(TMIN_MTXID + VAR_index));
+		bit_next_index();
+		break;
+
+	case BIT_PHASE_CYC:
+		ercd = bit_cyclic((ID)(TMIN_CYCID + VAR_index));
+		bit_next_index();
+		break;
+
+	case BIT_PHASE_ALM:
+		ercd = bit_alarm((ID)(TMIN_ALMID + VAR_index));
+		bit_next_index();
+		break;
+	}
+	return(ercd);
+}
+
+/*
+ *  段階的な整合性検査の1単位の実行（受け口関数）
+ *
+ *  不整合を検出した場合には，そのエラーコードを返す．CPUロック状態で
+ *  呼び出された場合には，そのまま検査する．
+ */
+ER
+eIncrementalTest_step(void)
+{
+	uint_t	phase, index;
+	bool_t	locked;
+	ER		ercd;
+
+	locked = sns_loc();
+	if (!locked) {
+		ercd = loc_cpu();
+		if (ercd != E_OK) {
+			return(ercd);
+		}
+	}
+
+	phase = VAR_phase;
+	index = VAR_index;
+	ercd = bit_step();
+	if (ercd != E_OK) {
+		VAR_errorCount++;
+		VAR_lastError = ercd;
+		VAR_lastPhase = phase;
+		VAR_lastIndex = index;
+	}
+
+	if (!locked) {
+		(void) unl_cpu();
+	}
+	return(ercd);
+}
+
+/*
+ *  段階的な整合性検査の進捗の参照（受け口関数）
+ */
+ER
+eIncrementalTest_getProgress(uint_t *p_round, uint_t *p_phase,
+														uint_t *p_index)
+{
+	SIL_PRE_LOC;
+
+	SIL_LOC_INT();
+	*p_round = VAR_round;
+	*p_phase = VAR_phase;
+	*p_index = VAR_index;
+	SIL_UNL_INT();
+	return(E_OK);
+}
+
+/*
+ *  段階的な整合性検査の検出結果の参照（受け口関数）
+ */
+ER
+eIncrementalTest_getFinding(uint_t *p_count, ER *p_ercd,
+										uint_t *p_phase, uint_t *p_index)
+{
+	SIL_PRE_LOC;
+
+	SIL_LOC_INT();
+	*p_count = VAR_errorCount;
+	*p_ercd = VAR_lastError;
+	*p_phase = VAR_lastPhase;
+	*p_index = VAR_lastIndex;
+	SIL_UNL_INT();
+	return(E_OK);
+}
+
+/*
+ *  段階的な整合性検査の初期化（受け口関数）
+ */
+ER
+eIncrementalTest_reset(void)
+{
+	SIL_PRE_LOC;
+
+	SIL_LOC_INT();
+	VAR_round = 0U;
+	VAR_phase = BIT_PHASE_STATE;
+	VAR_index = 0U;
+	VAR_subIndex = 0U;
+	VAR_errorCount = 0U;
+	VAR_lastError = E_OK;
+	VAR_lastPhase = 0U;
+	VAR_lastIndex = 0U;
+	SIL_UNL_INT();
+	return(E_OK);
+}
+
+/*
+ *  段階的な整合性検査を行うタスクの本体（受け口関数）
+ *
+ *  ATTR_interval毎に，ATTR_stepsPerRun回だけ検査の1単位を実行する．
+ *  低い優先度のタスク（時間パーティショニングを使用する場合には，アイ
+ *  ドルウィンドウで動作するタスク）の本体とすることを想定している．
+ */
+void
+eIncrementalTestBody_main(void)
+{
+	uint_t	i, count, phase, index;
+	ER		ercd;
+
+	while (true) {
+		for (i = 0U; i < ATTR_stepsPerRun; i++) {
+			if (eIncrementalTest_step() < 0) {
+				(void) eIncrementalTest_getFinding(&count, &ercd,
+														&phase, &index);
+				syslog_5(LOG_ERROR, "## Internal inconsistency detected "
+								"(%d, %d) at phase %d, index %d (total %d).",
+								MERCD(ercd), SERCD(ercd), phase, index, count);
+			}
+		}
+		(void) dly_tsk(ATTR_interval);
+	}
+}
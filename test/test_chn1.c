@@ -0,0 +1,282 @@
+/*
+ *  TOPPERS Software
+ *      Toyohashi Open Platform for Embedded Real-Time Systems
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/* 
+ *		チャネル機能のテスト(1)
+ *
+ * 【テストの目的】
+ *
+ *  ユーザドメイン間のチャネルによるブロックの受渡しを，待ち状態への遷
+ *  移と待ち解除，アクセス許可の検査，管理領域が不正な場合の検出を中心
+ *  にテストする．
+ *
+ * 【テスト項目】
+ *
+ *	(A) ref_chnでチャネルの状態を参照できる
+ *	(B) sig_chn，wai_chnの静的エラーのテスト
+ *		(B-1) chnmodeが不正（E_PAR）
+ *		(B-2) 相手側の操作に対するアクセス許可がない（E_OACV）
+ *	(C) 空きブロックがある場合に，chn_get_sblkでブロックを取り出せる
+ *	(D) 空きブロックがない場合に，chn_get_sblkが待ち状態になる
+ *		(D-1) tmout=TMO_POLの時にE_TMOUTが返る
+ *		(D-2) tmout=TMO_FEVRの時に，chn_rel_rblkで待ち解除される
+ *	(E) 受信すべきブロックがある場合に，chn_get_rblkでブロックを取り出
+ *		せる
+ *	(F) 受信すべきブロックがない場合に，chn_get_rblkが待ち状態になる
+ *		(F-1) tmout=TMO_POLの時にE_TMOUTが返る
+ *		(F-2) タイムアウトを設定した時にE_TMOUTが返る
+ *	(G) ブロックの番地が，ブロック数の累計に従って巡回する
+ *	(H) 送信・受信したブロック数の差がブロック数を超える場合に，E_OBJ
+ *		が返る
+ *
+ * 【使用リソース】
+ *
+ *	DOM1: 送信側の保護ドメイン
+ *	DOM2: 受信側の保護ドメイン
+ *	TASK1: DOM1，高優先度タスク，TA_ACT属性
+ *	TASK2: DOM2，中優先度タスク，TA_ACT属性
+ *	CHN1: TA_NULL属性，ブロック数2，ブロックのサイズCHN1_BLKSZ，
+ *		  送信側DOM1，受信側DOM2
+ *
+ * 【テストシーケンス】
+ *
+ *	== TASK1（優先度：高）==
+ *	1:	ref_chn(CHN1, &rchn)									... (A)
+ *		assert(rchn.chnid == CHN1)
+ *		assert(rchn.stskid == TSK_NONE)
+ *		assert(rchn.rtskid == TSK_NONE)
+ *		assert(rchn.blkcnt == 2U)
+ *		assert(rchn.blksz == CHN1_BLKSZ)
+ *	2:	sig_chn(CHN1, TCHN_SND|TCHN_RCV) -> E_PAR				... (B-1)
+ *		wai_chn(CHN1, TCHN_RCV) -> E_OACV						... (B-2)
+ *		sig_chn(CHN1, TCHN_RCV) -> E_OACV						... (B-2)
+ *	3:	chn_get_sblk(&rchn, &blk, TMO_FEVR)						... (C)
+ *		assert(blk == rchn.chn)
+ *		DO(*((uint_t *) blk) = 1U)
+ *		chn_snd_blk(&rchn)
+ *		chn_get_sblk(&rchn, &blk, TMO_FEVR)
+ *		assert(blk == (void *)(((char *) rchn.chn) + CHN1_BLKSZ))
+ *		DO(*((uint_t *) blk) = 2U)
+ *		chn_snd_blk(&rchn)
+ *	4:	chn_get_sblk(&rchn, &blk, TMO_POL) -> E_TMOUT			... (D-1)
+ *	5:	chn_get_sblk(&rchn, &blk, TMO_FEVR)						... (D-2)
+ *	== TASK2（優先度：中）==
+ *	6:	ref_chn(CHN1, &rchn)
+ *		assert(rchn.stskid == TASK1)
+ *		assert(rchn.rtskid == TSK_NONE)
+ *	7:	chn_get_rblk(&rchn, &blk, TMO_FEVR)						... (E)
+ *		assert(blk == rchn.chn)
+ *		assert(*((uint_t *) blk) == 1U)
+ *		chn_rel_rblk(&rchn)
+ *	== TASK1（続き）==
+ *	8:	assert(blk == rchn.chn)									... (G)
+ *		DO(*((uint_t *) blk) = 3U)
+ *		chn_snd_blk(&rchn)
+ *		slp_tsk()
+ *	== TASK2（続き）==
+ *	9:	chn_get_rblk(&rchn, &blk, TMO_FEVR)
+ *		assert(blk == (void *)(((char *) rchn.chn) + CHN1_BLKSZ))
+ *		assert(*((uint_t *) blk) == 2U)
+ *		chn_rel_rblk(&rchn)
+ *		chn_get_rblk(&rchn, &blk, TMO_FEVR)						... (G)
+ *		assert(blk == rchn.chn)
+ *		assert(*((uint_t *) blk) == 3U)
+ *		chn_rel_rblk(&rchn)
+ *	10:	chn_get_rblk(&rchn, &blk, TMO_POL) -> E_TMOUT			... (F-1)
+ *	11:	chn_get_rblk(&rchn, &blk, TEST_TIME_PROC) -> E_TMOUT	... (F-2)
+ *	12:	DO(rchn.p_chnrcv->rcvcnt += 10U)						... (H)
+ *		chn_get_rblk(&rchn, &blk, TMO_POL) -> E_OBJ
+ *		wai_chn(CHN1, TCHN_RCV) -> E_OBJ
+ *		DO(rchn.p_chnrcv->rcvcnt -= 10U)
+ *	13:	END
+ */
+
+#include <kernel.h>
+#include <chnblk.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "kernel_cfg.h"
+#include "test_chn1.h"
+
+/* DO NOT DELETE THIS LINE -- gentest depends on it. */
+
+void
+task1(EXINF exinf)
+{
+	ER_UINT	ercd;
+	T_RCHN	rchn;
+	void	*blk;
+
+	test_start(__FILE__);
+
+	check_point(1);
+	ercd = ref_chn(CHN1, &rchn);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rchn.chnid == CHN1);
+
+	check_assert(rchn.stskid == TSK_NONE);
+
+	check_assert(rchn.rtskid == TSK_NONE);
+
+	check_assert(rchn.blkcnt == 2U);
+
+	check_assert(rchn.blksz == CHN1_BLKSZ);
+
+	check_point(2);
+	ercd = sig_chn(CHN1, TCHN_SND|TCHN_RCV);
+	check_ercd(ercd, E_PAR);
+
+	ercd = wai_chn(CHN1, TCHN_RCV);
+	check_ercd(ercd, E_OACV);
+
+	ercd = sig_chn(CHN1, TCHN_RCV);
+	check_ercd(ercd, E_OACV);
+
+	check_point(3);
+	ercd = chn_get_sblk(&rchn, &blk, TMO_FEVR);
+	check_ercd(ercd, E_OK);
+
+	check_assert(blk == rchn.chn);
+
+	*((uint_t *) blk) = 1U;
+
+	ercd = chn_snd_blk(&rchn);
+	check_ercd(ercd, E_OK);
+
+	ercd = chn_get_sblk(&rchn, &blk, TMO_FEVR);
+	check_ercd(ercd, E_OK);
+
+	check_assert(blk == (void *)(((char *) rchn.chn) + CHN1_BLKSZ));
+
+	*((uint_t *) blk) = 2U;
+
+	ercd = chn_snd_blk(&rchn);
+	check_ercd(ercd, E_OK);
+
+	check_point(4);
+	ercd = chn_get_sblk(&rchn, &blk, TMO_POL);
+	check_ercd(ercd, E_TMOUT);
+
+	check_point(5);
+	ercd = chn_get_sblk(&rchn, &blk, TMO_FEVR);
+	check_ercd(ercd, E_OK);
+
+	check_point(8);
+	check_assert(blk == rchn.chn);
+
+	*((uint_t *) blk) = 3U;
+
+	ercd = chn_snd_blk(&rchn);
+	check_ercd(ercd, E_OK);
+
+	ercd = slp_tsk();
+	check_ercd(ercd, E_OK);
+
+	check_assert(false);
+}
+
+void
+task2(EXINF exinf)
+{
+	ER_UINT	ercd;
+	T_RCHN	rchn;
+	void	*blk;
+
+	check_point(6);
+	ercd = ref_chn(CHN1, &rchn);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rchn.stskid == TASK1);
+
+	check_assert(rchn.rtskid == TSK_NONE);
+
+	check_point(7);
+	ercd = chn_get_rblk(&rchn, &blk, TMO_FEVR);
+	check_ercd(ercd, E_OK);
+
+	check_assert(blk == rchn.chn);
+
+	check_assert(*((uint_t *) blk) == 1U);
+
+	ercd = chn_rel_rblk(&rchn);
+	check_ercd(ercd, E_OK);
+
+	check_point(9);
+	ercd = chn_get_rblk(&rchn, &blk, TMO_FEVR);
+	check_ercd(ercd, E_OK);
+
+	check_assert(blk == (void *)(((char *) rchn.chn) + CHN1_BLKSZ));
+
+	check_assert(*((uint_t *) blk) == 2U);
+
+	ercd = chn_rel_rblk(&rchn);
+	check_ercd(ercd, E_OK);
+
+	ercd = chn_get_rblk(&rchn, &blk, TMO_FEVR);
+	check_ercd(ercd, E_OK);
+
+	check_assert(blk == rchn.chn);
+
+	check_assert(*((uint_t *) blk) == 3U);
+
+	ercd = chn_rel_rblk(&rchn);
+	check_ercd(ercd, E_OK);
+
+	check_point(10);
+	ercd = chn_get_rblk(&rchn, &blk, TMO_POL);
+	check_ercd(ercd, E_TMOUT);
+
+	check_point(11);
+	ercd = chn_get_rblk(&rchn, &blk, TEST_TIME_PROC);
+	check_ercd(ercd, E_TMOUT);
+
+	check_point(12);
+	rchn.p_chnrcv->rcvcnt += 10U;
+
+	ercd = chn_get_rblk(&rchn, &blk, TMO_POL);
+	check_ercd(ercd, E_OBJ);
+
+	ercd = wai_chn(CHN1, TCHN_RCV);
+	check_ercd(ercd, E_OBJ);
+
+	rchn.p_chnrcv->rcvcnt -= 10U;
+
+	check_finish(13);
+	check_assert(false);
+}
@@ -0,0 +1,192 @@
+/*
+ *  TOPPERS Software
+ *      Toyohashi Open Platform for Embedded Real-Time Systems
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/* 
+ *		遅延ISRのテスト(1)
+ *
+ * 【テストの目的】
+ *
+ *  レベルトリガの割込み番号に，TA_DEFER属性のISRを2つ登録した場合に，
+ *  両方のISRの実行が終わった時点で割込み要求禁止フラグがクリアされる
+ *  ことをテストする．
+ *
+ * 【制限事項】
+ *
+ *  このテストを実施するには，dis_int，ena_int，ras_int，prb_intがサ
+ *  ポートされており，それらを行える割込み要求ラインがあることが必要で
+ *  ある．INTNO1は，レベルトリガ（TA_EDGE属性でない）として設定されて
+ *  いる必要がある．
+ *
+ * 【テスト項目】
+ *
+ *	(A) 遅延ISRの実行順序
+ *		(A-1) 同じ割込み番号に登録された遅延ISRが，ISR優先度順に実行される
+ *		(A-2) 下半部の実行中に登録された実行要求は，実行中の下半部の後
+ *			  で，ISR優先度順に実行される
+ *	(B) 割込み要求禁止フラグの操作
+ *		(B-1) 実行要求の登録時に，割込み要求禁止フラグがセットされる
+ *		(B-2) 最初のISRの実行が終わっても，割込み要求禁止フラグはセッ
+ *			  トされたままである
+ *		(B-3) 最後のISRの実行が終わった時点で，割込み要求禁止フラグが
+ *			  クリアされる
+ *
+ * 【使用リソース】
+ *
+ *	TASK1: 中優先度タスク，TA_ACT属性
+ *	ISR1:  遅延ISR，INTNO1，ISR優先度1
+ *	ISR2:  遅延ISR，INTNO1，ISR優先度2
+ *
+ * 【補足説明】
+ *
+ *  ISR1とISR2は，同じ遅延ISR実行タスクによって実行される．割込み要求
+ *  禁止フラグをISR毎に操作すると，ISR1-1の実行後に割込み要求禁止フラ
+ *  グがクリアされ，ISR1-2がISR2-1よりも先に実行される．
+ *
+ * 【テストシーケンス】
+ *
+ *	== TASK1（優先度：中）==
+ *	1:	ras_int(INTNO1)
+ *	== ISR1-1 ==
+ *	2:	DO(intno1_clear())
+ *		ras_int(INTNO1)
+ *		prb_int(INTNO1) -> true				... (A-1)(B-1)
+ *		RETURN
+ *	== ISR2-1 ==
+ *	3:	prb_int(INTNO1) -> true				... (A-1)(B-2)
+ *		RETURN
+ *	== ISR1-2 ==
+ *	4:	DO(intno1_clear())					... (A-2)(B-3)
+ *		RETURN
+ *	== ISR2-2 ==
+ *	5:	RETURN								... (A-2)
+ *	== TASK1（続き）==
+ *	6:	prb_int(INTNO1) -> false			... (B-3)
+ *	7:	END
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "kernel_cfg.h"
+#include "test_dfrisr1.h"
+
+/* DO NOT DELETE THIS LINE -- gentest depends on it. */
+
+static uint_t	isr1_count = 0;
+
+void
+isr1(EXINF exinf)
+{
+	ER_UINT	ercd;
+
+	switch (++isr1_count) {
+	case 1:
+		check_point(2);
+		intno1_clear();
+
+		ercd = ras_int(INTNO1);
+		check_ercd(ercd, E_OK);
+
+		ercd = prb_int(INTNO1);
+		check_ercd(ercd, true);
+
+		return;
+
+		check_assert(false);
+
+	case 2:
+		check_point(4);
+		intno1_clear();
+
+		return;
+
+		check_assert(false);
+
+	default:
+		check_assert(false);
+	}
+	check_assert(false);
+}
+
+static uint_t	isr2_count = 0;
+
+void
+isr2(EXINF exinf)
+{
+	ER_UINT	ercd;
+
+	switch (++isr2_count) {
+	case 1:
+		check_point(3);
+		ercd = prb_int(INTNO1);
+		check_ercd(ercd, true);
+
+		return;
+
+		check_assert(false);
+
+	case 2:
+		check_point(5);
+		return;
+
+		check_assert(false);
+
+	default:
+		check_assert(false);
+	}
+	check_assert(false);
+}
+
+void
+task1(EXINF exinf)
+{
+	ER_UINT	ercd;
+
+	test_start(__FILE__);
+
+	check_point(1);
+	ercd = ras_int(INTNO1);
+	check_ercd(ercd, E_OK);
+
+	check_point(6);
+	ercd = prb_int(INTNO1);
+	check_ercd(ercd, false);
+
+	check_finish(7);
+	check_assert(false);
+}
@@ -0,0 +1,241 @@
+/*
+ *  TOPPERS Software
+ *      Toyohashi Open Platform for Embedded Real-Time Systems
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/* 
+ *		EDFスケジューリングのテスト(1)
+ *
+ * 【テストの目的】
+ *
+ *  EDFスケジューリングを行うスケジューリング単位で，同じ優先度のタス
+ *  クが絶対デッドラインの早い順に実行されることと，rot_rdq／mrot_rdq
+ *  およびchg_dlnの振舞いをテストする．
+ *
+ * 【テスト項目】
+ *
+ *	(A) 同じ優先度のタスクが，起動された順ではなく，絶対デッドライン
+ *		の早い順に実行される
+ *	(B) rot_rdqが，タスクの優先順位を変更しない
+ *	(C) mrot_rdqが，タスクの優先順位を変更しない
+ *	(D) 実行可能状態のタスクに対するchg_dlnにより，タスクの優先順位
+ *		が変更される
+ *
+ * 【使用リソース】
+ *
+ *	DOM1: 保護ドメイン，タイムウィンドウを割当て，EDFスケジューリング
+ *	TASK1: DOM1，低優先度タスク，TA_ACT属性
+ *	TASK2: DOM1，中優先度タスク，相対デッドライン：TEST_TIME_CP
+ *	TASK3: DOM1，中優先度タスク，相対デッドライン：3 * TEST_TIME_CP
+ *	TASK4: DOM1，中優先度タスク，相対デッドライン：2 * TEST_TIME_CP
+ *
+ * 【補足説明】
+ *
+ *	TASK2〜TASK4を起動した順（TASK2，TASK3，TASK4）や，それをローテー
+ *	トした順とは異なり，絶対デッドラインの早い順はTASK2，TASK4，TASK3
+ *	である．
+ *
+ * 【テストシーケンス】
+ *
+ *	== TASK1（優先度：低）==
+ *	1:	dis_dsp()
+ *		act_tsk(TASK2)
+ *		act_tsk(TASK3)
+ *		act_tsk(TASK4)
+ *		rot_rdq(MID_PRIORITY)								... (B)
+ *		mrot_rdq(TDOM_SELF, MID_PRIORITY)					... (C)
+ *		ena_dsp()											... (A)
+ *	== TASK2-1（1回目）==
+ *	2:	RETURN
+ *	== TASK4-1（1回目）==
+ *	3:	RETURN
+ *	== TASK3-1（1回目）==
+ *	4:	RETURN
+ *	== TASK1（続き）==
+ *	5:	dis_dsp()
+ *		act_tsk(TASK2)
+ *		act_tsk(TASK3)
+ *		act_tsk(TASK4)
+ *		chg_dln(TASK4, TEST_TIME_PROC)						... (D)
+ *		ena_dsp()
+ *	== TASK4-2（2回目）==
+ *	6:	RETURN
+ *	== TASK2-2（2回目）==
+ *	7:	RETURN
+ *	== TASK3-2（2回目）==
+ *	8:	RETURN
+ *	== TASK1（続き）==
+ *	9:	END
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "kernel_cfg.h"
+#include "test_edf1.h"
+
+#ifndef USE_EDF_SCHED
+#error Compiler option "-DUSE_EDF_SCHED" is missing.
+#endif /* USE_EDF_SCHED */
+
+/* DO NOT DELETE THIS LINE -- gentest depends on it. */
+
+void
+task1(EXINF exinf)
+{
+	ER_UINT	ercd;
+
+	test_start(__FILE__);
+
+	check_point(1);
+	ercd = dis_dsp();
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK2);
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK3);
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK4);
+	check_ercd(ercd, E_OK);
+
+	ercd = rot_rdq(MID_PRIORITY);
+	check_ercd(ercd, E_OK);
+
+	ercd = mrot_rdq(TDOM_SELF, MID_PRIORITY);
+	check_ercd(ercd, E_OK);
+
+	ercd = ena_dsp();
+	check_ercd(ercd, E_OK);
+
+	check_point(5);
+	ercd = dis_dsp();
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK2);
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK3);
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK4);
+	check_ercd(ercd, E_OK);
+
+	ercd = chg_dln(TASK4, TEST_TIME_PROC);
+	check_ercd(ercd, E_OK);
+
+	ercd = ena_dsp();
+	check_ercd(ercd, E_OK);
+
+	check_finish(9);
+	check_assert(false);
+}
+
+static uint_t	task2_count = 0;
+
+void
+task2(EXINF exinf)
+{
+
+	switch (++task2_count) {
+	case 1:
+		check_point(2);
+		return;
+
+		check_assert(false);
+
+	case 2:
+		check_point(7);
+		return;
+
+		check_assert(false);
+
+	default:
+		check_assert(false);
+	}
+	check_assert(false);
+}
+
+static uint_t	task3_count = 0;
+
+void
+task3(EXINF exinf)
+{
+
+	switch (++task3_count) {
+	case 1:
+		check_point(4);
+		return;
+
+		check_assert(false);
+
+	case 2:
+		check_point(8);
+		return;
+
+		check_assert(false);
+
+	default:
+		check_assert(false);
+	}
+	check_assert(false);
+}
+
+static uint_t	task4_count = 0;
+
+void
+task4(EXINF exinf)
+{
+
+	switch (++task4_count) {
+	case 1:
+		check_point(3);
+		return;
+
+		check_assert(false);
+
+	case 2:
+		check_point(6);
+		return;
+
+		check_assert(false);
+
+	default:
+		check_assert(false);
+	}
+	check_assert(false);
+}
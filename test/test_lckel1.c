@@ -0,0 +1,349 @@
+/*
+ *  TOPPERS Software
+ *      Toyohashi Open Platform for Embedded Real-Time Systems
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/* 
+ *		CPUロックの省略のテスト(1)
+ *
+ * 【テストの目的】
+ *
+ *  USE_LOCK_ELISIONをマクロ定義した場合に，タスクコンテキスト専用のオ
+ *  ブジェクトに対する操作が，待ちタスクの有無によらず正しく行われるこ
+ *  とと，タスク切換えの保留中に割込み処理で必要になったタスク切換えが，
+ *  保留を解除する時点で行われることをテストする．
+ *
+ * 【テスト項目】
+ *
+ *	(A) TA_TSKCTX属性のセマフォ
+ *		(A-1) 資源がある場合のwai_sem
+ *		(A-2) 待ちタスクがない場合のsig_sem
+ *		(A-3) 資源がない場合のwai_semで待ち状態になる
+ *		(A-4) 待ちタスクがある場合のsig_semで待ち解除される
+ *	(B) ミューテックス
+ *		(B-1) ロックされていない場合のloc_mtx
+ *		(B-2) 待ちタスクがない場合のunl_mtx
+ *		(B-3) ロックされている場合のloc_mtxで待ち状態になる
+ *		(B-4) 待ちタスクがある場合のunl_mtxで待ち解除される
+ *	(C) TA_TSKCTX属性のデータキュー
+ *		(C-1) 受信待ちタスクがない場合のsnd_dtq
+ *		(C-2) 送信待ちタスクがない場合のrcv_dtq
+ *		(C-3) データがない場合のrcv_dtqで待ち状態になる
+ *		(C-4) 受信待ちタスクがある場合のsnd_dtqで待ち解除される
+ *		(C-5) データキューが一杯の場合のsnd_dtqで待ち状態になる
+ *		(C-6) 送信待ちタスクがある場合のrcv_dtqで待ち解除される
+ *	(D) タスク切換えの保留中の割込み
+ *		(D-1) 保留中に割込み処理で高優先度タスクを起床しても，割込み
+ *			  処理からのリターン時にはタスク切換えが起こらない
+ *		(D-2) 保留を解除する時点でタスク切換えが起こる
+ *
+ * 【使用リソース】
+ *
+ *	TASK1: 中優先度タスク，TA_ACT属性
+ *	TASK2: 高優先度タスク，TA_NULL属性
+ *	ISR1:  割込みサービスルーチン
+ *	SEM1:  TA_TSKCTX属性，初期資源数1，最大資源数1
+ *	MTX1:  TA_NULL属性
+ *	DTQ1:  TA_TSKCTX属性，データキューの容量1
+ *
+ * 【テストシーケンス】
+ *
+ *	== TASK1（優先度：中）==
+ *	1:	wai_sem(SEM1)							... (A-1)
+ *		ref_sem(SEM1, &rsem)
+ *		assert(rsem.semcnt == 0U)
+ *		sig_sem(SEM1)							... (A-2)
+ *		ref_sem(SEM1, &rsem)
+ *		assert(rsem.semcnt == 1U)
+ *		loc_mtx(MTX1)							... (B-1)
+ *		ref_mtx(MTX1, &rmtx)
+ *		assert(rmtx.htskid == TASK1)
+ *		unl_mtx(MTX1)							... (B-2)
+ *		ref_mtx(MTX1, &rmtx)
+ *		assert(rmtx.htskid == TSK_NONE)
+ *		snd_dtq(DTQ1, DATA1)					... (C-1)
+ *		rcv_dtq(DTQ1, &data)					... (C-2)
+ *		assert(data == DATA1)
+ *	2:	wai_sem(SEM1)
+ *		loc_mtx(MTX1)
+ *		act_tsk(TASK2)
+ *	== TASK2（優先度：高）==
+ *	3:	wai_sem(SEM1)							... (A-3)
+ *	== TASK1（続き）==
+ *	4:	sig_sem(SEM1)							... (A-4)
+ *	== TASK2（続き）==
+ *	5:	ref_sem(SEM1, &rsem)
+ *		assert(rsem.semcnt == 0U)
+ *		sig_sem(SEM1)
+ *		loc_mtx(MTX1)							... (B-3)
+ *	== TASK1（続き）==
+ *	6:	unl_mtx(MTX1)							... (B-4)
+ *	== TASK2（続き）==
+ *	7:	ref_mtx(MTX1, &rmtx)
+ *		assert(rmtx.htskid == TASK2)
+ *		unl_mtx(MTX1)
+ *		rcv_dtq(DTQ1, &data)					... (C-3)
+ *	== TASK1（続き）==
+ *	8:	snd_dtq(DTQ1, DATA2)					... (C-4)
+ *	== TASK2（続き）==
+ *	9:	assert(data == DATA2)
+ *		snd_dtq(DTQ1, DATA3)
+ *		snd_dtq(DTQ1, DATA4)					... (C-5)
+ *	== TASK1（続き）==
+ *	10:	rcv_dtq(DTQ1, &data)					... (C-6)
+ *	== TASK2（続き）==
+ *	11:	slp_tsk()
+ *	== TASK1（続き）==
+ *	12:	assert(data == DATA3)
+ *		rcv_dtq(DTQ1, &data)
+ *		assert(data == DATA4)
+ *		DO(hook_armed = true)
+ *		wai_sem(SEM1)
+ *	== ISR1 ==
+ *	13:	DO(intno1_clear())
+ *		wup_tsk(TASK2)							... (D-1)
+ *		ref_sem(SEM1, &rsem)
+ *		assert(rsem.semcnt == 1U)
+ *		RETURN
+ *	== TASK2（続き）==
+ *	14:	ref_sem(SEM1, &rsem)					... (D-2)
+ *		assert(rsem.semcnt == 0U)
+ *	15:	END
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "kernel_cfg.h"
+#include "test_lckel1.h"
+
+#ifndef USE_LOCK_ELISION
+#error Compiler option "-DUSE_LOCK_ELISION" is missing.
+#endif /* USE_LOCK_ELISION */
+
+#ifndef HOOK_DSP_HOLD
+#error Compiler option "-DHOOK_DSP_HOLD" is missing.
+#endif /* HOOK_DSP_HOLD */
+
+/*
+ *  タスク切換えを保留した直後に割込みを発生させるためのフック
+ */
+static volatile bool_t	hook_armed = false;
+
+void
+hook_dsp_hold(void)
+{
+	if (hook_armed) {
+		hook_armed = false;
+		(void) ras_int(INTNO1);
+	}
+}
+
+/* DO NOT DELETE THIS LINE -- gentest depends on it. */
+
+void
+isr1(EXINF exinf)
+{
+	ER_UINT	ercd;
+	T_RSEM	rsem;
+
+	check_point(13);
+	intno1_clear();
+
+	ercd = wup_tsk(TASK2);
+	check_ercd(ercd, E_OK);
+
+	ercd = ref_sem(SEM1, &rsem);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rsem.semcnt == 1U);
+
+	return;
+
+	check_assert(false);
+}
+
+void
+task1(EXINF exinf)
+{
+	ER_UINT	ercd;
+	T_RSEM	rsem;
+	T_RMTX	rmtx;
+	intptr_t	data;
+
+	test_start(__FILE__);
+
+	check_point(1);
+	ercd = wai_sem(SEM1);
+	check_ercd(ercd, E_OK);
+
+	ercd = ref_sem(SEM1, &rsem);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rsem.semcnt == 0U);
+
+	ercd = sig_sem(SEM1);
+	check_ercd(ercd, E_OK);
+
+	ercd = ref_sem(SEM1, &rsem);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rsem.semcnt == 1U);
+
+	ercd = loc_mtx(MTX1);
+	check_ercd(ercd, E_OK);
+
+	ercd = ref_mtx(MTX1, &rmtx);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rmtx.htskid == TASK1);
+
+	ercd = unl_mtx(MTX1);
+	check_ercd(ercd, E_OK);
+
+	ercd = ref_mtx(MTX1, &rmtx);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rmtx.htskid == TSK_NONE);
+
+	ercd = snd_dtq(DTQ1, DATA1);
+	check_ercd(ercd, E_OK);
+
+	ercd = rcv_dtq(DTQ1, &data);
+	check_ercd(ercd, E_OK);
+
+	check_assert(data == DATA1);
+
+	check_point(2);
+	ercd = wai_sem(SEM1);
+	check_ercd(ercd, E_OK);
+
+	ercd = loc_mtx(MTX1);
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK2);
+	check_ercd(ercd, E_OK);
+
+	check_point(4);
+	ercd = sig_sem(SEM1);
+	check_ercd(ercd, E_OK);
+
+	check_point(6);
+	ercd = unl_mtx(MTX1);
+	check_ercd(ercd, E_OK);
+
+	check_point(8);
+	ercd = snd_dtq(DTQ1, DATA2);
+	check_ercd(ercd, E_OK);
+
+	check_point(10);
+	ercd = rcv_dtq(DTQ1, &data);
+	check_ercd(ercd, E_OK);
+
+	check_point(12);
+	check_assert(data == DATA3);
+
+	ercd = rcv_dtq(DTQ1, &data);
+	check_ercd(ercd, E_OK);
+
+	check_assert(data == DATA4);
+
+	hook_armed = true;
+
+	ercd = wai_sem(SEM1);
+	check_ercd(ercd, E_OK);
+
+	check_assert(false);
+}
+
+void
+task2(EXINF exinf)
+{
+	ER_UINT	ercd;
+	T_RSEM	rsem;
+	T_RMTX	rmtx;
+	intptr_t	data;
+
+	check_point(3);
+	ercd = wai_sem(SEM1);
+	check_ercd(ercd, E_OK);
+
+	check_point(5);
+	ercd = ref_sem(SEM1, &rsem);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rsem.semcnt == 0U);
+
+	ercd = sig_sem(SEM1);
+	check_ercd(ercd, E_OK);
+
+	ercd = loc_mtx(MTX1);
+	check_ercd(ercd, E_OK);
+
+	check_point(7);
+	ercd = ref_mtx(MTX1, &rmtx);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rmtx.htskid == TASK2);
+
+	ercd = unl_mtx(MTX1);
+	check_ercd(ercd, E_OK);
+
+	ercd = rcv_dtq(DTQ1, &data);
+	check_ercd(ercd, E_OK);
+
+	check_point(9);
+	check_assert(data == DATA2);
+
+	ercd = snd_dtq(DTQ1, DATA3);
+	check_ercd(ercd, E_OK);
+
+	ercd = snd_dtq(DTQ1, DATA4);
+	check_ercd(ercd, E_OK);
+
+	check_point(11);
+	ercd = slp_tsk();
+	check_ercd(ercd, E_OK);
+
+	check_point(14);
+	ercd = ref_sem(SEM1, &rsem);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rsem.semcnt == 0U);
+
+	check_finish(15);
+	check_assert(false);
+}
@@ -0,0 +1,206 @@
+/*
+ *  TOPPERS Software
+ *      Toyohashi Open Platform for Embedded Real-Time Systems
+ * 
+ *  Copyright (C) 2026 by agent
+ * 
+ *  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+ *  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+ *  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+ *  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+ *      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+ *      スコード中に含まれていること．
+ *  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+ *      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+ *      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+ *      の無保証規定を掲載すること．
+ *  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+ *      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+ *      と．
+ *    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+ *        作権表示，この利用条件および下記の無保証規定を掲載すること．
+ *    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+ *        報告すること．
+ *  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+ *      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+ *      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+ *      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+ *      免責すること．
+ * 
+ *  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+ *  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+ *  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+ *  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+ *  の責任を負わない．
+ * 
+ *  $Id$
+ */
+
+/* 
+ *		制約タスクのテスト(3)
+ *
+ * 【テストの目的】
+ *
+ *  制約タスクに対して行えない操作がE_NOSPTエラーとなることと，同じ保
+ *  護ドメインに属する同じ優先度の制約タスクが，スタック領域を共有して
+ *  順に実行されることをテストする．
+ *
+ * 【テスト項目】
+ *
+ *	(A) 制約タスクを対象としたsus_tskがE_NOSPTエラーとなる
+ *	(B) 制約タスクを対象としたchg_priがE_NOSPTエラーとなる
+ *	(C) レディキューの先頭が制約タスクである優先度に対するrot_rdqが
+ *		E_NOSPTエラーとなる
+ *		(C-1) 先頭の制約タスクが実行を開始する前
+ *		(C-2) 先頭の制約タスクが実行途中でプリエンプトされている時
+ *	(D) レディキューの先頭が制約タスクである優先度に対するmrot_rdqが
+ *		E_NOSPTエラーとなる
+ *		(D-1) 先頭の制約タスクが実行を開始する前
+ *		(D-2) 先頭の制約タスクが実行途中でプリエンプトされている時
+ *	(E) 制約タスクが待ち状態に入るサービスコールを呼び出すと，E_NOSPT
+ *		エラーとなる
+ *	(F) 同じ優先度の2つの制約タスクが，起動された順に実行される
+ *	(G) 同じ優先度の2つの制約タスクが，同じスタック領域で実行される
+ *
+ * 【使用リソース】
+ *
+ *	DOM1: 保護ドメイン
+ *	TASK1: DOM1，高優先度タスク，TA_ACT属性
+ *	TASK2: DOM1，中優先度タスク，TA_RSTR属性
+ *	TASK3: DOM1，中優先度タスク，TA_RSTR属性
+ *
+ * 【テストシーケンス】
+ *
+ *	== TASK1（優先度：高）==
+ *	1:	act_tsk(TASK2)
+ *		act_tsk(TASK3)
+ *		sus_tsk(TASK2) -> E_NOSPT							... (A)
+ *		chg_pri(TASK2, LOW_PRIORITY) -> E_NOSPT				... (B)
+ *		rot_rdq(MID_PRIORITY) -> E_NOSPT					... (C-1)
+ *		mrot_rdq(DOM1, MID_PRIORITY) -> E_NOSPT				... (D-1)
+ *		slp_tsk()
+ *	== TASK2（優先度：中，制約タスク）==
+ *	2:	DO(task2_stkadr = (intptr_t) &exinf)
+ *		slp_tsk() -> E_NOSPT								... (E)
+ *		dly_tsk(TEST_TIME_PROC) -> E_NOSPT					... (E)
+ *		wup_tsk(TASK1)
+ *	== TASK1（続き）==
+ *	3:	rot_rdq(MID_PRIORITY) -> E_NOSPT					... (C-2)
+ *		mrot_rdq(TDOM_SELF, MID_PRIORITY) -> E_NOSPT		... (D-2)
+ *		ref_tsk(TASK3, &rtsk)
+ *		assert(rtsk.tskstat == TTS_RDY)
+ *		slp_tsk()
+ *	== TASK2（続き）==
+ *	4:	RETURN
+ *	== TASK3（優先度：中，制約タスク）==
+ *	5:	DO(task3_stkadr = (intptr_t) &exinf)				... (F)
+ *		assert(task3_stkadr - task2_stkadr < STACK_SIZE / 2)	... (G)
+ *		assert(task2_stkadr - task3_stkadr < STACK_SIZE / 2)	... (G)
+ *		wup_tsk(TASK1)
+ *	== TASK1（続き）==
+ *	6:	END
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "kernel_cfg.h"
+#include "test_rstr3.h"
+
+/*
+ *  制約タスクの実行開始時のスタック上の番地
+ */
+static intptr_t	task2_stkadr;
+static intptr_t	task3_stkadr;
+
+/* DO NOT DELETE THIS LINE -- gentest depends on it. */
+
+void
+task1(EXINF exinf)
+{
+	ER_UINT	ercd;
+	T_RTSK	rtsk;
+
+	test_start(__FILE__);
+
+	check_point(1);
+	ercd = act_tsk(TASK2);
+	check_ercd(ercd, E_OK);
+
+	ercd = act_tsk(TASK3);
+	check_ercd(ercd, E_OK);
+
+	ercd = sus_tsk(TASK2);
+	check_ercd(ercd, E_NOSPT);
+
+	ercd = chg_pri(TASK2, LOW_PRIORITY);
+	check_ercd(ercd, E_NOSPT);
+
+	ercd = rot_rdq(MID_PRIORITY);
+	check_ercd(ercd, E_NOSPT);
+
+	ercd = mrot_rdq(DOM1, MID_PRIORITY);
+	check_ercd(ercd, E_NOSPT);
+
+	ercd = slp_tsk();
+	check_ercd(ercd, E_OK);
+
+	check_point(3);
+	ercd = rot_rdq(MID_PRIORITY);
+	check_ercd(ercd, E_NOSPT);
+
+	ercd = mrot_rdq(TDOM_SELF, MID_PRIORITY);
+	check_ercd(ercd, E_NOSPT);
+
+	ercd = ref_tsk(TASK3, &rtsk);
+	check_ercd(ercd, E_OK);
+
+	check_assert(rtsk.tskstat == TTS_RDY);
+
+	ercd = slp_tsk();
+	check_ercd(ercd, E_OK);
+
+	check_finish(6);
+	check_assert(false);
+}
+
+void
+task2(EXINF exinf)
+{
+	ER_UINT	ercd;
+
+	check_point(2);
+	task2_stkadr = (intptr_t) &exinf;
+
+	ercd = slp_tsk();
+	check_ercd(ercd, E_NOSPT);
+
+	ercd = dly_tsk(TEST_TIME_PROC);
+	check_ercd(ercd, E_NOSPT);
+
+	ercd = wup_tsk(TASK1);
+	check_ercd(ercd, E_OK);
+
+	check_point(4);
+	return;
+
+	check_assert(false);
+}
+
+void
+task3(EXINF exinf)
+{
+	ER_UINT	ercd;
+
+	check_point(5);
+	task3_stkadr = (intptr_t) &exinf;
+
+	check_assert(task3_stkadr - task2_stkadr < STACK_SIZE / 2);
+
+	check_assert(task2_stkadr - task3_stkadr < STACK_SIZE / 2);
+
+	ercd = wup_tsk(TASK1);
+	check_ercd(ercd, E_OK);
+
+	check_assert(false);
+}
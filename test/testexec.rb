@@ -78,6 +78,7 @@ require "pp"
 TEST_SPEC = {
   # 機能テストプログラム
   "calsvc"   => { SRC: "test_calsvc" },
+  "chn1"     => { SRC: "test_chn1" },
   "cpuexc1"  => { SRC: "test_cpuexc1" },
   "cpuexc2"  => { SRC: "test_cpuexc2" },
   "cpuexc3"  => { SRC: "test_cpuexc3" },
@@ -88,13 +89,17 @@ TEST_SPEC = {
   "cpuexc8"  => { SRC: "test_cpuexc8" },
   "cpuexc9"  => { SRC: "test_cpuexc9" },
   "cpuexc10" => { SRC: "test_cpuexc10" },
+  "dfrisr1"  => { SRC: "test_dfrisr1" },
   "dlynse"   => { SRC: "test_dlynse" },
   "dtq1"     => { SRC: "test_dtq1" },
+  "edf1"     => { SRC: "test_edf1", DEFS: "-DUSE_EDF_SCHED" },
   "extsvc1"  => { SRC: "test_extsvc1" },
   "exttsk"   => { SRC: "test_exttsk", CDL: "test_pf_bitkernel" },
   "flg1"     => { SRC: "test_flg1" },
   "hrt1"     => { SRC: "test_hrt1" },
   "int1"     => { SRC: "test_int1" },
+  "lckel1"   => { SRC: "test_lckel1",
+								DEFS: "-DUSE_LOCK_ELISION -DHOOK_DSP_HOLD" },
   "messagebuf1" => { SRC: "test_messagebuf1", CDL: "test_pf_bitkernel" },
   "messagebuf2" => { SRC: "test_messagebuf2", CDL: "test_pf_bitkernel" },
   "mprot1"   => { SRC: "test_mprot1" },
@@ -134,10 +139,12 @@ TEST_SPEC = {
   "ovrhdr3"  => { TARGET: 2, SRC: "simt_ovrhdr3", DEFS: "-DHRT_CONFIG1" },
   "ovrhdr4"  => { SRC: "test_ovrhdr4" },
   "ovrhdr5"  => { SRC: "test_ovrhdr5" },
+  "ovrhdr6"  => { TARGET: 2, SRC: "simt_ovrhdr6", DEFS: "-DHRT_CONFIG1" },
 
   # 制約タスク拡張パッケージの機能テストプログラム
   "rstr1"    => { SRC: "test_rstr1" },
   "rstr2"    => { SRC: "test_rstr2" },
+  "rstr3"    => { SRC: "test_rstr3" },
 
   # サブ優先度機能拡張パッケージの機能テストプログラム
   "subprio1" => { SRC: "test_subprio1" },
@@ -161,6 +168,12 @@ TEST_SPEC = {
 
   # タイムウィンドウ管理機能のテストプログラム
   "twd1" => { TARGET: 2, SRC: "simt_twd1", DEFS: "-DHRT_CONFIG1" },
+  "twd2" => { TARGET: 2, SRC: "simt_twd2",
+								DEFS: "-DHRT_CONFIG1 -DUSE_SLACK_RECLAIM" },
+
+  # EDFスケジューリングのテストプログラム
+  "edf2" => { TARGET: 2, SRC: "simt_edf2",
+								DEFS: "-DHRT_CONFIG1 -DUSE_EDF_SCHED" },
 
   # ドリフト調整機能拡張パッケージのシステム時刻管理機能テストプログラム
   "drift1"        => { TARGET: 2, SRC: "simt_drift1",
@@ -192,11 +205,19 @@ TEST_SPEC = {
   "perf3" => { TARGET: 1, CDL: "perf_pf", NK_DEFS: "-DHIST_INVALIDATE_CACHE" },
   "perf4" => { TARGET: 1, CDL: "perf_pf", NK_DEFS: "-DHIST_INVALIDATE_CACHE" },
   "perf5" => { TARGET: 1, CDL: "perf_pf", NK_DEFS: "-DHIST_INVALIDATE_CACHE" },
+  "perf6" => { TARGET: 1, CDL: "perf_pf", NK_DEFS: "-DHIST_INVALIDATE_CACHE" },
+  "perf7" => { TARGET: 1, CDL: "perf_pf", DEFS: "-DUSE_SNAPSHOT",
+										NK_DEFS: "-DHIST_INVALIDATE_CACHE" },
+  "perf8" => { TARGET: 1, CDL: "perf_pf", NK_DEFS: "-DHIST_INVALIDATE_CACHE" },
 
   "perf0u" => { TARGET: 1, SRC: "perf0", CFG: "perf0u", CDL: "perf_pf",
 				NK_DEFS: "-DHIST_INVALIDATE_CACHE" },
   "perf1u" => { TARGET: 1, SRC: "perf1", CFG: "perf1u", CDL: "perf_pf",
 				NK_DEFS: "-DHIST_INVALIDATE_CACHE" },
+  "perf8u" => { TARGET: 1, SRC: "perf8", CFG: "perf8u", CDL: "perf_pf",
+				NK_DEFS: "-DHIST_INVALIDATE_CACHE" },
+  "perf8d" => { TARGET: 1, SRC: "perf8", CFG: "perf8d", CDL: "perf_pf",
+				NK_DEFS: "-DHIST_INVALIDATE_CACHE" },
 
   # ライブラリのテスト
   "prbstr"  => { SRC: "test_prbstr" },
@@ -0,0 +1,742 @@
+#!/usr/bin/env ruby
+# -*- coding: utf-8 -*-
+#
+#  TOPPERS Software
+#      Toyohashi Open Platform for Embedded Real-Time Systems
+# 
+#  Copyright (C) 2026 by agent
+# 
+#  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+#  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+#  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+#  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+#      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+#      スコード中に含まれていること．
+#  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+#      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+#      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+#      の無保証規定を掲載すること．
+#  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+#      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+#      と．
+#    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+#        作権表示，この利用条件および下記の無保証規定を掲載すること．
+#    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+#        報告すること．
+#  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+#      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+#      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+#      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+#      免責すること．
+# 
+#  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+#  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+#  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+#  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+#  の責任を負わない．
+# 
+#  $Id$
+# 
+
+#
+#		サービスコールの性能評価プログラム生成ツール
+#
+#  サービスコール定義ファイル（kernel/svc.def）と，このファイル中の計
+#  測方法の定義から，サービスコール毎の実行時間を計測する性能評価プロ
+#  グラム(8)（test/perf8.c）を生成する．
+#
+#  使用方法：testディレクトリで，次のコマンドを実行する．
+#
+#	ruby ../utils/genperf.rb [-o perf8.c] [../kernel/svc.def]
+#
+#  計測方法の定義がないサービスコールは，生成したファイルの先頭に，計
+#  測していないサービスコールとして列挙する．
+#
+
+Encoding.default_external = 'utf-8'
+require "optparse"
+
+#
+#  計測方法の定義
+#
+#  サービスコール毎に，計測方法のリストを定義する．計測方法は，次のキー
+#  を持つハッシュで定義する．PRE，POST，WAIT，AFTER，WAKEには，サービ
+#  スコール呼出しの文字列か，そのリストを記述する．
+#
+#	CALL	計測するサービスコール呼出し
+#	PRE		計測の前に，メインタスクが行う処理
+#	POST	計測の後に，メインタスクが行う処理
+#	ERCD	CALLの期待される返値（省略時は，返値の型がERの場合はE_OK）
+#	WAIT	計測タスク1（高優先度）が待ち状態に入る処理
+#	AFTER	計測タスク1が計測を終了した後に行う処理
+#	WAKE	計測タスク3（低優先度）がメインタスクの待ち状態を解除する処理
+#	TASK2	計測タスク2（高優先度）を起動する場合にtrue
+#	LABEL	計測方法の名称（省略時は，次の種別）
+#
+#  WAITを定義した場合には，CALLによって計測タスク1に切り換わるまでの
+#  時間を計測する（switch）．WAKEを定義した場合には，CALLによってメイ
+#  ンタスクが待ち状態に入り，計測タスク3に切り換わるまでの時間を計測す
+#  る（block）．TASK2を定義した場合には，CALLによって計測タスク2に切り
+#  換わるまでの時間を計測する（switch）．いずれも定義しない場合には，
+#  CALLの実行時間を計測する（nowait）．
+#
+$measureDefinition = {
+  # タスク管理機能
+  "act_tsk" => [
+    { CALL: "act_tsk(TASK3)", POST: "can_act(TASK3)" },
+    { CALL: "act_tsk(TASK2)", TASK2: true } ],
+  "get_tst" => [
+    { CALL: "get_tst(TASK3, &tskstat)" } ],
+  "can_act" => [
+    { CALL: "can_act(TASK3)", PRE: "act_tsk(TASK3)", ERCD: "1" } ],
+  "chg_pri" => [
+    { CALL: "chg_pri(TSK_SELF, MAIN_PRIORITY)" },
+    { CALL: "chg_pri(TSK_SELF, LOW_PRIORITY)",
+      WAKE: "chg_pri(MAIN_TASK, MAIN_PRIORITY)" } ],
+  "get_pri" => [
+    { CALL: "get_pri(TASK3, &tskpri)" } ],
+  "get_inf" => [
+    { CALL: "get_inf(&tskinf)" } ],
+  "ref_tsk" => [
+    { CALL: "ref_tsk(TASK3, &rtsk)" } ],
+  "ref_stk" => [
+    { CALL: "ref_stk(TASK3, &rstk)" } ],
+
+  # タスク付属同期機能
+  "slp_tsk" => [
+    { CALL: "slp_tsk()", WAKE: "wup_tsk(MAIN_TASK)" } ],
+  "tslp_tsk" => [
+    { CALL: "tslp_tsk(PERF_TMOUT)", WAKE: "wup_tsk(MAIN_TASK)" } ],
+  "wup_tsk" => [
+    { CALL: "wup_tsk(TSK_SELF)", POST: "can_wup(TSK_SELF)" },
+    { CALL: "wup_tsk(TASK1)", WAIT: "slp_tsk()" } ],
+  "can_wup" => [
+    { CALL: "can_wup(TSK_SELF)", PRE: "wup_tsk(TSK_SELF)", ERCD: "1" } ],
+  "rel_wai" => [
+    { CALL: "rel_wai(TASK1)", WAIT: "slp_tsk()" } ],
+  "sus_tsk" => [
+    { CALL: "sus_tsk(TASK3)", POST: "rsm_tsk(TASK3)" } ],
+  "rsm_tsk" => [
+    { CALL: "rsm_tsk(TASK3)", PRE: "sus_tsk(TASK3)" },
+    { CALL: "rsm_tsk(TASK1)", WAIT: "sus_tsk(TSK_SELF)" } ],
+
+  # タスク終了機能
+  "dis_ter" => [
+    { CALL: "dis_ter()", POST: "ena_ter()" } ],
+  "ena_ter" => [
+    { CALL: "ena_ter()", PRE: "dis_ter()" } ],
+  "sns_ter" => [
+    { CALL: "sns_ter()" } ],
+
+  # セマフォ
+  "sig_sem" => [
+    { CALL: "sig_sem(SEM1)", POST: "pol_sem(SEM1)" },
+    { CALL: "sig_sem(SEM1)", WAIT: "wai_sem(SEM1)" } ],
+  "wai_sem" => [
+    { CALL: "wai_sem(SEM1)", PRE: "sig_sem(SEM1)" },
+    { CALL: "wai_sem(SEM1)", WAKE: "sig_sem(SEM1)" } ],
+  "pol_sem" => [
+    { CALL: "pol_sem(SEM1)", PRE: "sig_sem(SEM1)" } ],
+  "twai_sem" => [
+    { CALL: "twai_sem(SEM1, PERF_TMOUT)", PRE: "sig_sem(SEM1)" },
+    { CALL: "twai_sem(SEM1, PERF_TMOUT)", WAKE: "sig_sem(SEM1)" } ],
+  "ini_sem" => [
+    { CALL: "ini_sem(SEM1)" } ],
+  "ref_sem" => [
+    { CALL: "ref_sem(SEM1, &rsem)" } ],
+
+  # イベントフラグ
+  "set_flg" => [
+    { CALL: "set_flg(FLG1, 0x01U)", POST: "clr_flg(FLG1, 0U)" },
+    { CALL: "set_flg(FLG1, 0x01U)",
+      WAIT: "wai_flg(FLG1, 0x01U, TWF_ORW, &flgptn)" } ],
+  "clr_flg" => [
+    { CALL: "clr_flg(FLG1, 0U)", PRE: "set_flg(FLG1, 0x01U)" } ],
+  "wai_flg" => [
+    { CALL: "wai_flg(FLG1, 0x01U, TWF_ORW, &flgptn)",
+      PRE: "set_flg(FLG1, 0x01U)" },
+    { CALL: "wai_flg(FLG1, 0x01U, TWF_ORW, &flgptn)",
+      WAKE: "set_flg(FLG1, 0x01U)" } ],
+  "pol_flg" => [
+    { CALL: "pol_flg(FLG1, 0x01U, TWF_ORW, &flgptn)",
+      PRE: "set_flg(FLG1, 0x01U)" } ],
+  "twai_flg" => [
+    { CALL: "twai_flg(FLG1, 0x01U, TWF_ORW, &flgptn, PERF_TMOUT)",
+      PRE: "set_flg(FLG1, 0x01U)" },
+    { CALL: "twai_flg(FLG1, 0x01U, TWF_ORW, &flgptn, PERF_TMOUT)",
+      WAKE: "set_flg(FLG1, 0x01U)" } ],
+  "ini_flg" => [
+    { CALL: "ini_flg(FLG1)" } ],
+  "ref_flg" => [
+    { CALL: "ref_flg(FLG1, &rflg)" } ],
+
+  # データキュー
+  "snd_dtq" => [
+    { CALL: "snd_dtq(DTQ2, 1)", POST: "prcv_dtq(DTQ2, &data)" },
+    { CALL: "snd_dtq(DTQ1, 1)", WAIT: "rcv_dtq(DTQ1, &data)" },
+    { CALL: "snd_dtq(DTQ1, 1)", WAKE: "prcv_dtq(DTQ1, &data)" } ],
+  "psnd_dtq" => [
+    { CALL: "psnd_dtq(DTQ2, 1)", POST: "prcv_dtq(DTQ2, &data)" },
+    { CALL: "psnd_dtq(DTQ1, 1)", WAIT: "rcv_dtq(DTQ1, &data)" } ],
+  "tsnd_dtq" => [
+    { CALL: "tsnd_dtq(DTQ2, 1, PERF_TMOUT)", POST: "prcv_dtq(DTQ2, &data)" },
+    { CALL: "tsnd_dtq(DTQ1, 1, PERF_TMOUT)", WAIT: "rcv_dtq(DTQ1, &data)" },
+    { CALL: "tsnd_dtq(DTQ1, 1, PERF_TMOUT)",
+      WAKE: "prcv_dtq(DTQ1, &data)" } ],
+  "fsnd_dtq" => [
+    { CALL: "fsnd_dtq(DTQ2, 1)", POST: "prcv_dtq(DTQ2, &data)" },
+    { CALL: "fsnd_dtq(DTQ2, 1)", WAIT: "rcv_dtq(DTQ2, &data)" } ],
+  "rcv_dtq" => [
+    { CALL: "rcv_dtq(DTQ2, &data)", PRE: "psnd_dtq(DTQ2, 1)" },
+    { CALL: "rcv_dtq(DTQ1, &data)", WAKE: "psnd_dtq(DTQ1, 1)" } ],
+  "prcv_dtq" => [
+    { CALL: "prcv_dtq(DTQ2, &data)", PRE: "psnd_dtq(DTQ2, 1)" } ],
+  "trcv_dtq" => [
+    { CALL: "trcv_dtq(DTQ2, &data, PERF_TMOUT)", PRE: "psnd_dtq(DTQ2, 1)" },
+    { CALL: "trcv_dtq(DTQ1, &data, PERF_TMOUT)",
+      WAKE: "psnd_dtq(DTQ1, 1)" } ],
+  "ini_dtq" => [
+    { CALL: "ini_dtq(DTQ2)" } ],
+  "ref_dtq" => [
+    { CALL: "ref_dtq(DTQ2, &rdtq)" } ],
+
+  # 優先度データキュー
+  "snd_pdq" => [
+    { CALL: "snd_pdq(PDQ2, 1, 1)", POST: "prcv_pdq(PDQ2, &data, &datapri)" },
+    { CALL: "snd_pdq(PDQ1, 1, 1)", WAIT: "rcv_pdq(PDQ1, &data, &datapri)" },
+    { CALL: "snd_pdq(PDQ1, 1, 1)",
+      WAKE: "prcv_pdq(PDQ1, &data, &datapri)" } ],
+  "psnd_pdq" => [
+    { CALL: "psnd_pdq(PDQ2, 1, 1)", POST: "prcv_pdq(PDQ2, &data, &datapri)" },
+    { CALL: "psnd_pdq(PDQ1, 1, 1)", WAIT: "rcv_pdq(PDQ1, &data, &datapri)" } ],
+  "tsnd_pdq" => [
+    { CALL: "tsnd_pdq(PDQ2, 1, 1, PERF_TMOUT)",
+      POST: "prcv_pdq(PDQ2, &data, &datapri)" },
+    { CALL: "tsnd_pdq(PDQ1, 1, 1, PERF_TMOUT)",
+      WAIT: "rcv_pdq(PDQ1, &data, &datapri)" } ],
+  "rcv_pdq" => [
+    { CALL: "rcv_pdq(PDQ2, &data, &datapri)", PRE: "psnd_pdq(PDQ2, 1, 1)" },
+    { CALL: "rcv_pdq(PDQ1, &data, &datapri)", WAKE: "psnd_pdq(PDQ1, 1, 1)" } ],
+  "prcv_pdq" => [
+    { CALL: "prcv_pdq(PDQ2, &data, &datapri)", PRE: "psnd_pdq(PDQ2, 1, 1)" } ],
+  "trcv_pdq" => [
+    { CALL: "trcv_pdq(PDQ2, &data, &datapri, PERF_TMOUT)",
+      PRE: "psnd_pdq(PDQ2, 1, 1)" },
+    { CALL: "trcv_pdq(PDQ1, &data, &datapri, PERF_TMOUT)",
+      WAKE: "psnd_pdq(PDQ1, 1, 1)" } ],
+  "ini_pdq" => [
+    { CALL: "ini_pdq(PDQ2)" } ],
+  "ref_pdq" => [
+    { CALL: "ref_pdq(PDQ2, &rpdq)" } ],
+
+  # ミューテックス
+  "loc_mtx" => [
+    { CALL: "loc_mtx(MTX1)", POST: "unl_mtx(MTX1)" },
+    { CALL: "loc_mtx(MTX2)", POST: "unl_mtx(MTX2)", LABEL: "ceiling" } ],
+  "ploc_mtx" => [
+    { CALL: "ploc_mtx(MTX1)", POST: "unl_mtx(MTX1)" } ],
+  "tloc_mtx" => [
+    { CALL: "tloc_mtx(MTX1, PERF_TMOUT)", POST: "unl_mtx(MTX1)" } ],
+  "unl_mtx" => [
+    { CALL: "unl_mtx(MTX1)", PRE: "loc_mtx(MTX1)" },
+    { CALL: "unl_mtx(MTX2)", PRE: "loc_mtx(MTX2)", LABEL: "ceiling" },
+    { CALL: "unl_mtx(MTX1)", PRE: [ "loc_mtx(MTX1)", "wup_tsk(TASK1)" ],
+      WAIT: [ "slp_tsk()", "loc_mtx(MTX1)" ], AFTER: "unl_mtx(MTX1)" } ],
+  "ini_mtx" => [
+    { CALL: "ini_mtx(MTX1)" } ],
+  "ref_mtx" => [
+    { CALL: "ref_mtx(MTX1, &rmtx)" } ],
+
+  # メッセージバッファ
+  "snd_mbf" => [
+    { CALL: "snd_mbf(MBF1, perf_smsg, PERF_MSGSZ)",
+      POST: "prcv_mbf(MBF1, perf_rmsg)" },
+    { CALL: "snd_mbf(MBF1, perf_smsg, PERF_MSGSZ)",
+      WAIT: "rcv_mbf(MBF1, perf_rmsg)" } ],
+  "psnd_mbf" => [
+    { CALL: "psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ)",
+      POST: "prcv_mbf(MBF1, perf_rmsg)" },
+    { CALL: "psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ)",
+      WAIT: "rcv_mbf(MBF1, perf_rmsg)" } ],
+  "tsnd_mbf" => [
+    { CALL: "tsnd_mbf(MBF1, perf_smsg, PERF_MSGSZ, PERF_TMOUT)",
+      POST: "prcv_mbf(MBF1, perf_rmsg)" },
+    { CALL: "tsnd_mbf(MBF1, perf_smsg, PERF_MSGSZ, PERF_TMOUT)",
+      WAIT: "rcv_mbf(MBF1, perf_rmsg)" } ],
+  "rcv_mbf" => [
+    { CALL: "rcv_mbf(MBF1, perf_rmsg)", ERCD: "PERF_MSGSZ",
+      PRE: "psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ)" },
+    { CALL: "rcv_mbf(MBF1, perf_rmsg)", ERCD: "PERF_MSGSZ",
+      WAKE: "psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ)" } ],
+  "prcv_mbf" => [
+    { CALL: "prcv_mbf(MBF1, perf_rmsg)", ERCD: "PERF_MSGSZ",
+      PRE: "psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ)" } ],
+  "trcv_mbf" => [
+    { CALL: "trcv_mbf(MBF1, perf_rmsg, PERF_TMOUT)", ERCD: "PERF_MSGSZ",
+      PRE: "psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ)" },
+    { CALL: "trcv_mbf(MBF1, perf_rmsg, PERF_TMOUT)", ERCD: "PERF_MSGSZ",
+      WAKE: "psnd_mbf(MBF1, perf_smsg, PERF_MSGSZ)" } ],
+  "ini_mbf" => [
+    { CALL: "ini_mbf(MBF1)" } ],
+  "ref_mbf" => [
+    { CALL: "ref_mbf(MBF1, &rmbf)" } ],
+
+  # 固定長メモリプール
+  "get_mpf" => [
+    { CALL: "get_mpf(MPF1, &blk)", POST: "rel_mpf(MPF1, blk)" },
+    { CALL: "get_mpf(MPF1, &blk2)", PRE: "pget_mpf(MPF1, &blk)",
+      WAKE: "rel_mpf(MPF1, blk)", POST: "rel_mpf(MPF1, blk2)" } ],
+  "pget_mpf" => [
+    { CALL: "pget_mpf(MPF1, &blk)", POST: "rel_mpf(MPF1, blk)" } ],
+  "tget_mpf" => [
+    { CALL: "tget_mpf(MPF1, &blk, PERF_TMOUT)", POST: "rel_mpf(MPF1, blk)" },
+    { CALL: "tget_mpf(MPF1, &blk2, PERF_TMOUT)", PRE: "pget_mpf(MPF1, &blk)",
+      WAKE: "rel_mpf(MPF1, blk)", POST: "rel_mpf(MPF1, blk2)" } ],
+  "rel_mpf" => [
+    { CALL: "rel_mpf(MPF1, blk)", PRE: "pget_mpf(MPF1, &blk)" },
+    { CALL: "rel_mpf(MPF1, blk)", PRE: [ "pget_mpf(MPF1, &blk)",
+                                         "wup_tsk(TASK1)" ],
+      WAIT: [ "slp_tsk()", "get_mpf(MPF1, &blk2)" ],
+      AFTER: "rel_mpf(MPF1, blk2)" } ],
+  "ini_mpf" => [
+    { CALL: "ini_mpf(MPF1)" } ],
+  "ref_mpf" => [
+    { CALL: "ref_mpf(MPF1, &rmpf)" } ],
+
+  # 時間管理機能
+  "get_tim" => [
+    { CALL: "get_tim(&systim)" } ],
+  "adj_tim" => [
+    { CALL: "adj_tim(0)" } ],
+  "fch_hrt" => [
+    { CALL: "fch_hrt()" } ],
+  "sta_cyc" => [
+    { CALL: "sta_cyc(CYC1)", POST: "stp_cyc(CYC1)" } ],
+  "stp_cyc" => [
+    { CALL: "stp_cyc(CYC1)", PRE: "sta_cyc(CYC1)" } ],
+  "ref_cyc" => [
+    { CALL: "ref_cyc(CYC1, &rcyc)" } ],
+  "sta_alm" => [
+    { CALL: "sta_alm(ALM1, PERF_ALMTIM)", POST: "stp_alm(ALM1)" } ],
+  "stp_alm" => [
+    { CALL: "stp_alm(ALM1)", PRE: "sta_alm(ALM1, PERF_ALMTIM)" } ],
+  "ref_alm" => [
+    { CALL: "ref_alm(ALM1, &ralm)" } ],
+
+  # システム状態管理機能
+  "rot_rdq" => [
+    { CALL: "rot_rdq(MAIN_PRIORITY)" } ],
+  "get_lod" => [
+    { CALL: "get_lod(MAIN_PRIORITY, &load)" } ],
+  "get_did" => [
+    { CALL: "get_did(&domid)" } ],
+  "get_tid" => [
+    { CALL: "get_tid(&tskid)" } ],
+  "get_nth" => [
+    { CALL: "get_nth(MAIN_PRIORITY, 0U, &tskid)" } ],
+  "loc_cpu" => [
+    { CALL: "loc_cpu()", POST: "unl_cpu()" } ],
+  "unl_cpu" => [
+    { CALL: "unl_cpu()", PRE: "loc_cpu()" } ],
+  "dis_dsp" => [
+    { CALL: "dis_dsp()", POST: "ena_dsp()" } ],
+  "ena_dsp" => [
+    { CALL: "ena_dsp()", PRE: "dis_dsp()" },
+    { CALL: "ena_dsp()", PRE: [ "dis_dsp()", "wup_tsk(TASK1)" ],
+      WAIT: "slp_tsk()" } ],
+  "sns_ctx" => [
+    { CALL: "sns_ctx()" } ],
+  "sns_loc" => [
+    { CALL: "sns_loc()" } ],
+  "sns_dsp" => [
+    { CALL: "sns_dsp()" } ],
+  "sns_dpn" => [
+    { CALL: "sns_dpn()" } ],
+  "sns_ker" => [
+    { CALL: "sns_ker()" } ],
+
+  # メモリオブジェクト管理機能
+  "prb_mem" => [
+    { CALL: "prb_mem(perf_smsg, PERF_MSGSZ, TSK_SELF, TPM_READ)" } ],
+  "ref_mem" => [
+    { CALL: "ref_mem(perf_smsg, &rmem)" } ],
+
+  # 割込み管理機能
+  "chg_ipm" => [
+    { CALL: "chg_ipm(TIPM_ENAALL)" } ],
+  "get_ipm" => [
+    { CALL: "get_ipm(&intpri)" } ],
+
+  # システム構成管理機能
+  "get_som" => [
+    { CALL: "get_som(&somid)" } ]
+}
+
+#
+#  オプションの処理
+#
+$outFileName = "perf8.c"
+
+OptionParser.new do |opt|
+  opt.banner = "Usage: genperf.rb [options] [svc.def]"
+  opt.on("-o", "--output FILE", "output file name") do |val|
+    $outFileName = val
+  end
+  opt.parse!(ARGV)
+end
+
+#
+#  サービスコール定義ファイルの読込み
+#
+#  サービスコール定義ファイルの形式は，gensvc.rbと同じである．HRP3カー
+#  ネルがサポートするサービスコール（SまたはPフラグ）のみを取り出す．
+#
+$inFileName = ARGV[0] || "../kernel/svc.def"
+$svcList = []
+$svcTable = {}
+
+begin
+  inFile = File.open($inFileName)
+rescue Errno::ENOENT, Errno::EACCES => ex
+  abort(ex.message)
+end
+
+while line = inFile.gets do
+  line.chomp!
+  line.sub!(/#.*$/, "")			# コメントの削除
+  line.rstrip!
+  next if line.empty?			# 空行のスキップ
+
+  # 継続行（行末が '\' の行）の処理
+  while /\\$/ =~ line
+    line.chop!
+    if !(line1 = inFile.gets)
+      abort("Unexpected EOF.")
+    end
+    line1.chomp!
+    line1.sub!(/#.*$/, "")
+    line1.rstrip!
+    line += line1
+  end
+
+  if /^(-?[0-9]*)[ \t]+([^ \t]+)[ \t]*(.*)$/ !~ line
+    abort("Syntax error at line #{inFile.lineno}.")
+  end
+  flags = $2
+  proto = $3.gsub(/[ \t]+/, " ")
+  next if /[SP]/ !~ flags
+
+  # 条件の解析
+  if /\[([^\]]+)\]/ =~ flags
+    cond = $1
+  else
+    cond = ""
+  end
+
+  if /^(\w+) ([a-z_]+)\(/ =~ proto
+    $svcList.push($2)
+    $svcTable[$2] = { type: $1, cond: cond }
+  end
+end
+inFile.close
+
+#
+#  計測方法の定義の検査
+#
+$measureDefinition.each_key do |svcName|
+  if !$svcTable.has_key?(svcName)
+    abort("#{svcName} is not defined in #{$inFileName}.")
+  end
+end
+
+#
+#  計測方法のリストの作成
+#
+$measureList = []
+$svcList.each do |svcName|
+  next if !$measureDefinition.has_key?(svcName)
+  $measureDefinition[svcName].each do |measure|
+    if measure.has_key?(:WAIT) || measure.has_key?(:TASK2)
+      kind = "switch"
+    elsif measure.has_key?(:WAKE)
+      kind = "block"
+    else
+      kind = "nowait"
+    end
+    $measureList.push(measure.merge(NO: $measureList.size + 1, SVC: svcName,
+									KIND: kind,
+									LABEL: measure[:LABEL] || kind))
+  end
+end
+
+#
+#  処理の出力
+#
+def genStatements(outFile, statements, indent)
+  Array(statements).each do |statement|
+    outFile.puts("#{indent}(void) #{statement};")
+  end
+end
+
+#
+#  #ifdef／#endifの生成
+#
+def genIfdef(outFile, measure)
+  cond = $svcTable[measure[:SVC]][:cond]
+  outFile.puts("#ifdef TOPPERS_SUPPORT_#{cond}") if !cond.empty?
+end
+
+def genEndif(outFile, measure)
+  cond = $svcTable[measure[:SVC]][:cond]
+  outFile.puts("#endif /* TOPPERS_SUPPORT_#{cond} */") if !cond.empty?
+end
+
+#
+#  性能評価プログラムの生成
+#
+outFile = File.open($outFileName, "w")
+outFile.puts(<<EOS)
+/*  This file is generated from #{$inFileName} by genperf.rb. */
+
+/*
+ *		カーネル性能評価プログラム(8)
+ *
+ *  サービスコール毎の実行時間を計測するためのプログラム．サービスコー
+ *  ルの呼出し方毎に，次のいずれかの時間を計測する．
+ *
+ *	nowait	サービスコールの実行時間（タスク切換えなし）
+ *	switch	サービスコールにより，高優先度のタスクに切り換わるまでの時間
+ *	block	サービスコールにより待ち状態に入り，低優先度のタスクに切り
+ *			換わるまでの時間
+ *
+ *  計測結果は，"Execution times of <サービスコール名> (<呼出し方>)"に
+ *  続けて，print_histにより出力する．
+ *
+ *  計測していないサービスコール：
+EOS
+
+unmeasured = $svcList.reject { |svcName| $measureDefinition.has_key?(svcName) }
+line = " *\t"
+unmeasured.each do |svcName|
+  if line.length + svcName.length > 72
+    outFile.puts(line.rstrip)
+    line = " *\t"
+  end
+  line += svcName + " "
+end
+outFile.puts(line.rstrip) if line != " *\t"
+
+outFile.puts(<<EOS)
+ */
+
+#include <kernel.h>
+#include <t_syslog.h>
+#include "syssvc/test_svc.h"
+#include "syssvc/histogram.h"
+#include "kernel_cfg.h"
+#include "perf8.h"
+
+/*
+ *  計測回数
+ */
+#define NO_MEASURE	1000U			/* 計測回数 */
+
+/*
+ *  サービスコールの引数と返値を格納する変数
+ */
+static STAT		tskstat;
+static PRI		tskpri;
+static EXINF	tskinf;
+static FLGPTN	flgptn;
+static intptr_t	data;
+static PRI		datapri;
+static void		*blk, *blk2;
+static SYSTIM	systim;
+static uint_t	load;
+static ID		tskid;
+static ID		domid;
+static ID		somid;
+static PRI		intpri;
+static T_RTSK	rtsk;
+static T_RSTK	rstk;
+static T_RSEM	rsem;
+static T_RFLG	rflg;
+static T_RDTQ	rdtq;
+static T_RPDQ	rpdq;
+static T_RMTX	rmtx;
+static T_RMBF	rmbf;
+static T_RMPF	rmpf;
+static T_RCYC	rcyc;
+static T_RALM	ralm;
+static T_RMEM	rmem;
+static char		perf_smsg[PERF_MSGSZ];
+static char		perf_rmsg[PERF_MSGSZ];
+
+/*
+ *  計測中の処理の番号
+ */
+static uint_t	perf_no;
+
+/*
+ *  計測の開始
+ */
+static void
+perf_start(uint_t no, bool_t restart)
+{
+	ER		ercd;
+
+	perf_no = no;
+	ercd = init_hist(1);
+	check_ercd(ercd, E_OK);
+
+	/*
+	 *  計測タスク1を再起動し，計測する処理の待ち状態に入れる．
+	 */
+	if (restart) {
+		(void) ter_tsk(TASK1);
+		ercd = act_tsk(TASK1);
+		check_ercd(ercd, E_OK);
+	}
+}
+
+/*
+ *  計測結果の出力
+ */
+static void
+perf_finish(const char *svcname, const char *label)
+{
+	ER		ercd;
+
+	syslog_2(LOG_NOTICE, "Execution times of %s (%s)", svcname, label);
+	ercd = print_hist(1);
+	check_ercd(ercd, E_OK);
+}
+
+/*
+ *  計測タスク1（高優先度）
+ *
+ *  計測する処理の待ち状態に入り，待ち解除されたら計測を終了する．
+ */
+void
+task1(EXINF exinf)
+{
+	while (true) {
+		switch (perf_no) {
+EOS
+
+$measureList.each do |measure|
+  next if !measure.has_key?(:WAIT)
+  genIfdef(outFile, measure)
+  outFile.puts("\t\tcase #{measure[:NO]}U:")
+  genStatements(outFile, measure[:WAIT], "\t\t\t")
+  outFile.puts("\t\t\t(void) end_measure(1);")
+  genStatements(outFile, measure[:AFTER], "\t\t\t")
+  outFile.puts("\t\t\tbreak;")
+  genEndif(outFile, measure)
+end
+
+outFile.puts(<<EOS)
+		default:
+			check_assert(false);
+			break;
+		}
+	}
+}
+
+/*
+ *  計測タスク2（高優先度）
+ *
+ *  起動されたら計測を終了する．
+ */
+void
+task2(EXINF exinf)
+{
+	(void) end_measure(1);
+}
+
+/*
+ *  計測タスク3（低優先度）
+ *
+ *  メインタスクが待ち状態に入ったら計測を終了し，待ち状態を解除する．
+ */
+void
+task3(EXINF exinf)
+{
+	while (true) {
+		(void) end_measure(1);
+
+		switch (perf_no) {
+EOS
+
+$measureList.each do |measure|
+  next if !measure.has_key?(:WAKE)
+  genIfdef(outFile, measure)
+  outFile.puts("\t\tcase #{measure[:NO]}U:")
+  genStatements(outFile, measure[:WAKE], "\t\t\t")
+  outFile.puts("\t\t\tbreak;")
+  genEndif(outFile, measure)
+end
+
+outFile.puts(<<EOS)
+		default:
+			check_assert(false);
+			break;
+		}
+	}
+}
+
+/*
+ *  メインタスク
+ */
+void
+main_task(EXINF exinf)
+{
+	uint_t	i;
+	ER_UINT	ercd;
+
+	syslog_0(LOG_NOTICE, "Performance evaluation program (8)");
+EOS
+
+$measureList.each do |measure|
+  svc = $svcTable[measure[:SVC]]
+  if /^ER/ =~ svc[:type]
+    call = "ercd = #{measure[:CALL]};"
+    ercd = measure[:ERCD] || (svc[:type] == "ER" ? "E_OK" : nil)
+  else
+    call = "(void) #{measure[:CALL]};"
+    ercd = nil
+  end
+  restart = measure.has_key?(:WAIT) ? "true" : "false"
+
+  outFile.puts
+  genIfdef(outFile, measure)
+  outFile.puts(<<EOS)
+	/*
+	 *  #{measure[:SVC]}（#{measure[:LABEL]}）
+	 */
+	perf_start(#{measure[:NO]}U, #{restart});
+	for (i = 0; i < NO_MEASURE; i++) {
+EOS
+  genStatements(outFile, measure[:PRE], "\t\t")
+  outFile.puts("\t\t(void) begin_measure(1);")
+  outFile.puts("\t\t#{call}")
+  if measure[:KIND] == "nowait"
+    outFile.puts("\t\t(void) end_measure(1);")
+  end
+  genStatements(outFile, measure[:POST], "\t\t")
+  if ercd
+    outFile.puts("\t\tcheck_ercd(ercd, #{ercd});")
+  end
+  outFile.puts(<<EOS)
+	}
+	perf_finish("#{measure[:SVC]}", "#{measure[:LABEL]}");
+EOS
+  genEndif(outFile, measure)
+end
+
+outFile.puts(<<EOS)
+
+	check_finish(0);
+}
+EOS
+outFile.close
@@ -55,6 +55,7 @@ $parameterDefinition = {
   "get_pri" => { 2 => "PRI" },
   "get_inf" => { 1 => "EXINF" },
   "ref_tsk" => { 2 => "T_RTSK" },
+  "ref_stk" => { 2 => "T_RSTK" },
   "ref_sem" => { 2 => "T_RSEM" },
   "wai_flg" => { 4 => "FLGPTN" },
   "pol_flg" => { 4 => "FLGPTN" },
@@ -75,6 +76,11 @@ $parameterDefinition = {
   "pget_mpf" => { 2 => "void *" },
   "tget_mpf" => { 2 => "void *" },
   "ref_mpf" => { 2 => "T_RMPF" },
+  "ref_chn" => { 2 => "T_RCHN" },
+  "chn_get_sblk" => { 2 => "void *" },
+  "chn_get_rblk" => { 2 => "void *" },
+  "ref_ost" => { 4 => "T_ROST" },
+  "ref_snp" => { 4 => "T_RTSK", 5 => "uint_t" },
   "get_tim" => { 1 => "SYSTIM" },
   "ref_cyc" => { 2 => "T_RCYC" },
   "ref_alm" => { 2 => "T_RALM" },
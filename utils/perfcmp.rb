@@ -0,0 +1,224 @@
+#!/usr/bin/env ruby
+# -*- coding: utf-8 -*-
+#
+#  TOPPERS Software
+#      Toyohashi Open Platform for Embedded Real-Time Systems
+# 
+#  Copyright (C) 2026 by agent
+# 
+#  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+#  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+#  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+#  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+#      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+#      スコード中に含まれていること．
+#  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+#      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+#      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+#      の無保証規定を掲載すること．
+#  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+#      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+#      と．
+#    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+#        作権表示，この利用条件および下記の無保証規定を掲載すること．
+#    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+#        報告すること．
+#  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+#      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+#      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+#      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+#      免責すること．
+# 
+#  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+#  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+#  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+#  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+#  の責任を負わない．
+# 
+#  $Id$
+# 
+
+#
+#		性能評価結果の集計・比較ツール
+#
+#  性能評価プログラムの出力（ログファイル）から，"Execution times of
+#  <名称>"に続けてprint_histにより出力された実行時間分布を読み込み，計
+#  測毎に，計測回数，最小値，中央値，99パーセンタイル値，最大値を求め
+#  て，タブ区切りで出力する．時間の単位は，実行時間分布の単位（高分解
+#  能タイマのカウント値）である．
+#
+#  使用方法：perfcmp.rb [-o 出力ファイル] [-b 基準ファイル]
+#									[-t 許容率] [-m 許容差] ログファイル ...
+#
+#  計測の名前は，"<ログファイル名から拡張子を除いたもの>:<名称>"とする．
+#  記録する最大時間を超えた計測がある場合には，最大値を"<記録する最大
+#  時間>+1"とし，その度数をoverの欄に出力する．
+#
+#  -bを指定した場合には，このツールで以前に出力したファイルを基準とし
+#  て，中央値または99パーセンタイル値が，基準の値から許容率（デフォル
+#  トは10%）を超えて，かつ許容差（デフォルトは1）を超えて増加した計測
+#  を性能の低下として報告し，終了ステータスを1とする．基準ファイルにあ
+#  る計測が，ログファイルにない場合も報告する．
+#
+
+Encoding.default_external = 'utf-8'
+require "optparse"
+
+#
+#  オプションの処理
+#
+$outFileName = nil
+$baseFileName = nil
+$threshold = 10.0
+$margin = 1
+
+OptionParser.new do |opt|
+  opt.banner = "Usage: perfcmp.rb [options] logfile ..."
+  opt.on("-o", "--output FILE", "output file of the results") do |val|
+    $outFileName = val
+  end
+  opt.on("-b", "--baseline FILE", "baseline file to compare with") do |val|
+    $baseFileName = val
+  end
+  opt.on("-t", "--threshold PERCENT", Float,
+							"allowed increase in percent (default 10)") do |val|
+    $threshold = val
+  end
+  opt.on("-m", "--margin TICKS", Integer,
+							"allowed increase in ticks (default 1)") do |val|
+    $margin = val
+  end
+  opt.parse!(ARGV)
+end
+if ARGV.empty?
+  abort("Usage: perfcmp.rb [options] logfile ...")
+end
+
+#
+#  実行時間分布からの集計
+#
+#  histは，[実行時間, 度数]のリスト．パーセンタイル値は，度数を累積し
+#  て全体のp%以上になる最小の実行時間とする．
+#
+def summarize(hist, over, maxval)
+  count = hist.inject(0) { |sum, (val, freq)| sum + freq } + over
+  return(nil) if count == 0
+
+  hist = hist.sort_by { |val, freq| val }
+  hist.push([ maxval + 1, over ]) if over > 0
+
+  percentile = lambda do |p|
+    rank = (count * p + 99) / 100
+    sum = 0
+    hist.each do |val, freq|
+      sum += freq
+      return(val) if sum >= rank
+    end
+  end
+
+  return({ count: count, min: hist.first[0], median: percentile.(50),
+			p99: percentile.(99), max: hist.last[0], over: over })
+end
+
+#
+#  ログファイルの読込み
+#
+$resultList = []
+$results = {}
+
+def finishEntry(entry)
+  return if entry.nil?
+  summary = summarize(entry[:hist], entry[:over], entry[:maxval])
+  return if summary.nil?
+  if !$results.has_key?(entry[:name])
+    $resultList.push(entry[:name])
+  end
+  $results[entry[:name]] = summary
+end
+
+ARGV.each do |logFileName|
+  label = File.basename(logFileName, ".*")
+  entry = nil
+  begin
+    File.open(logFileName) do |file|
+      file.each_line do |line|
+        line.chomp!
+        case line
+        when /Execution times of (.*?)\s*$/
+          finishEntry(entry)
+          entry = { name: "#{label}:#{$1}", hist: [], over: 0, maxval: 0 }
+        when /> (\d+) : (\d+)\s*$/
+          if !entry.nil?
+            entry[:maxval] = $1.to_i
+            entry[:over] = $2.to_i
+          end
+        when /(^|\s)(\d+) : (\d+)\s*$/
+          if !entry.nil?
+            entry[:hist].push([ $2.to_i, $3.to_i ])
+            entry[:maxval] = $2.to_i if $2.to_i > entry[:maxval]
+          end
+        when /> INT_MAX : \d+\s*$/
+          # 時間の逆転が疑われる計測は無視する
+        else
+          finishEntry(entry)
+          entry = nil
+        end
+      end
+    end
+  rescue Errno::ENOENT, Errno::EACCES => ex
+    abort(ex.message)
+  end
+  finishEntry(entry)
+end
+
+#
+#  集計結果の出力
+#
+outFile = $outFileName.nil? ? STDOUT : File.open($outFileName, "w")
+outFile.puts("# name\tcount\tmin\tmedian\tp99\tmax\tover")
+$resultList.each do |name|
+  r = $results[name]
+  outFile.puts([ name, r[:count], r[:min], r[:median], r[:p99],
+									r[:max], r[:over] ].join("\t"))
+end
+outFile.close if !$outFileName.nil?
+
+#
+#  基準ファイルとの比較
+#
+exit(0) if $baseFileName.nil?
+
+baseList = []
+baseResults = {}
+begin
+  File.open($baseFileName) do |file|
+    file.each_line do |line|
+      next if /^#/ =~ line
+      fields = line.chomp.split("\t")
+      next if fields.size < 7
+      baseList.push(fields[0])
+      baseResults[fields[0]] = { median: fields[3].to_i, p99: fields[4].to_i }
+    end
+  end
+rescue Errno::ENOENT, Errno::EACCES => ex
+  abort(ex.message)
+end
+
+regression = false
+baseList.each do |name|
+  if !$results.has_key?(name)
+    STDERR.puts("missing: #{name}")
+    regression = true
+    next
+  end
+  [ :median, :p99 ].each do |key|
+    base = baseResults[name][key]
+    current = $results[name][key]
+    if current - base > $margin && current > base * (1.0 + $threshold / 100.0)
+      STDERR.printf("regression: %s: %s %d -> %d (%+.1f%%)\n", name, key,
+							base, current, (current - base) * 100.0 / base)
+      regression = true
+    end
+  end
+end
+exit(regression ? 1 : 0)
@@ -0,0 +1,361 @@
+#!/usr/bin/env ruby
+# -*- coding: utf-8 -*-
+#
+#  TOPPERS Software
+#      Toyohashi Open Platform for Embedded Real-Time Systems
+# 
+#  Copyright (C) 2026 by agent
+# 
+#  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+#  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+#  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+#  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+#      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+#      スコード中に含まれていること．
+#  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+#      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+#      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+#      の無保証規定を掲載すること．
+#  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+#      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+#      と．
+#    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+#        作権表示，この利用条件および下記の無保証規定を掲載すること．
+#    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+#        報告すること．
+#  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+#      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+#      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+#      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+#      免責すること．
+# 
+#  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+#  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+#  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+#  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+#  の責任を負わない．
+# 
+#  $Id$
+# 
+
+#
+#		スケジューリング解析ツール
+#
+#  コンフィギュレータがパス2で生成するschedcfg.txt（システム周期，シス
+#  テム動作モード，タイムウィンドウ，タスクの所属と優先度，タスクを起
+#  動／起床する周期通知）と，タスク毎の最悪実行時間と周期を記述したファ
+#  イルを読み込み，システム動作モード毎に，タイムウィンドウの使用率と，
+#  タイムウィンドウ内の固定優先度スケジューリングを仮定したタスクの最
+#  悪応答時間を求める．
+#
+#  使用方法：schedcheck.rb [-c schedcfg.txt] [パラメータファイル ...]
+#
+#  パラメータファイルの各行には，次の形式でタスクのパラメータを記述す
+#  る（時間の単位はμ秒）．周期を省略した場合には，そのタスクを起動ま
+#  たは起床する周期通知の周期を用いる．相対デッドラインを省略した場合
+#  には，周期と同じとする．#から行末まではコメントとする．
+#
+#	タスク名 最悪実行時間 [周期 [相対デッドライン]]
+#
+#  デッドラインを満たせないタスクか，使用率が100%を超えるタイムウィン
+#  ドウがある場合には，終了ステータスを1とする．
+#
+
+Encoding.default_external = 'utf-8'
+require "optparse"
+
+#
+#  オプションの処理
+#
+$cfgFile = "schedcfg.txt"
+
+OptionParser.new do |opt|
+  opt.banner = "Usage: schedcheck.rb [options] [paramfile ...]"
+  opt.on("-c", "--sched-cfg FILE", "schedcfg.txt generated by cfg") do |val|
+    $cfgFile = val
+  end
+  opt.parse!(ARGV)
+end
+
+#
+#  構成情報の読込み
+#
+$scyctim = 0
+$domKind = { "kernel" => "kernel" }
+$somList = []
+$somData = {}
+$twdList = []
+$taskList = []
+$taskData = {}
+$cycPeriod = {}
+
+File.open($cfgFile) do |file|
+  file.each_line do |line|
+    fields = line.chomp.split("\t")
+    case fields[0]
+    when "SCY"
+      $scyctim = fields[1].to_i
+    when "DOM"
+      $domKind[fields[1]] = fields[2]
+    when "SOM"
+      $somList.push(fields[1])
+      $somData[fields[1]] = { nxtsom: fields[2], inisom: fields[3] == "1" }
+    when "TWD"
+      $twdList.push({ som: fields[1], dom: fields[2], len: fields[3].to_i })
+    when "TSK"
+      $taskList.push(fields[1])
+      $taskData[fields[1]] = { dom: fields[2], pri: fields[3].to_i }
+    when "CYC"
+      # 同じタスクに複数の周期通知がある場合は，短い方の周期を用いる
+      period = fields[3].to_i
+      if !$cycPeriod.has_key?(fields[2]) || period < $cycPeriod[fields[2]]
+        $cycPeriod[fields[2]] = period
+      end
+    end
+  end
+end
+
+#
+#  タスクのパラメータの読込み
+#
+$warnings = []
+ARGF.each_line do |line|
+  line = line.sub(/#.*/, "").strip
+  next if line.empty?
+  name, wcet, period, deadline = line.split(/\s+/)
+  if !$taskData.has_key?(name)
+    $warnings.push("#{name}: no such task in #{$cfgFile}")
+    next
+  end
+  params = $taskData[name]
+  params[:wcet] = wcet.to_i
+  params[:period] = period.nil? ? $cycPeriod[name] : period.to_i
+  if params[:period].nil?
+    $warnings.push("#{name}: period is not given and no cyclic " \
+										"notification activates it")
+    params.delete(:wcet)
+    next
+  end
+  params[:deadline] = deadline.nil? ? params[:period] : deadline.to_i
+end
+
+# 解析の対象とするタスク
+$analyzed = $taskList.select {|name| $taskData[name].has_key?(:wcet) }
+($taskList - $analyzed).each do |name|
+  $warnings.push("#{name}: not analyzed (interference from it is ignored)")
+end
+
+#
+#  供給区間に関する関数
+#
+#  供給区間は，周期cycleの中で処理が実行できる区間[start, end)の配列で
+#  表す．nilは常に実行できることを表す．
+#
+
+# 時刻sから処理時間wを得るまでの時間
+def timeToSupply(intervals, cycle, s, w)
+  return(w) if intervals.nil?
+  t = s
+  remain = w
+  base = s - s % cycle
+  while true
+    intervals.each do |(start, finish)|
+      from = [ base + start, t ].max
+      to = base + finish
+      next if from >= to
+      if to - from >= remain
+        return(from + remain - s)
+      end
+      remain -= to - from
+      t = to
+    end
+    base += cycle
+  end
+end
+
+# 処理時間wを得るのに必要な最大の時間（供給区間の終了時刻から始める場
+# 合が最悪となる）
+def worstTimeToSupply(intervals, cycle, w)
+  return(w) if intervals.nil?
+  return(0) if w == 0
+  return(intervals.map {|(_, finish)| \
+					timeToSupply(intervals, cycle, finish, w) }.max)
+end
+
+#
+#  最悪応答時間の計算
+#
+#  干渉するタスクの実行時間を，供給区間の中で消費されるものとして扱う．
+#  デッドラインを超えた時点で打ち切り，nilを返す．
+#
+def responseTime(name, interferers, intervals, cycle)
+  params = $taskData[name]
+  response = worstTimeToSupply(intervals, cycle, params[:wcet])
+  while response <= params[:deadline]
+    demand = params[:wcet]
+    interferers.each do |other|
+      oparams = $taskData[other]
+      demand += ((response + oparams[:period] - 1) / oparams[:period]) \
+														* oparams[:wcet]
+    end
+    newResponse = worstTimeToSupply(intervals, cycle, demand)
+    return(response) if newResponse == response
+    response = newResponse
+  end
+  return(nil)
+end
+
+def utilization(names)
+  return(names.inject(0.0) {|sum, name| \
+			sum + $taskData[name][:wcet].to_f / $taskData[name][:period] })
+end
+
+def percent(value)
+  return(format("%.1f%%", value * 100))
+end
+
+#
+#  システム動作モード毎の解析
+#
+#  時間パーティショニングを使用しない場合には，すべてのタスクを1つの固
+#  定優先度スケジューリングとして解析する．
+#
+$infeasible = false
+
+def analyzeMode(som)
+  if som.nil?
+    windows = []
+    cycle = 1
+  else
+    windows = []
+    offset = 0
+    $twdList.each do |twd|
+      next if twd[:som] != som
+      windows.push([ twd[:dom], offset, offset + twd[:len] ])
+      offset += twd[:len]
+    end
+    cycle = $scyctim
+  end
+  idleStart = windows.empty? ? 0 : windows.last[2]
+
+  # 保護ドメイン毎の供給区間（長さが0の区間は含めない．タイムウィン
+  # ドウがシステム周期全体を占める場合には，アイドルウィンドウの供給区
+  # 間は空になる）
+  supply = {}
+  $domKind.each do |dom, kind|
+    if som.nil? || kind == "kernel"
+      supply[dom] = nil
+    elsif kind == "idle"
+      supply[dom] = [[ idleStart, cycle ]]
+    else
+      supply[dom] = windows.select {|(wdom, _, _)| wdom == dom } \
+									.map {|(_, start, finish)| [ start, finish ] }
+    end
+    supply[dom] = supply[dom].reject {|(start, finish)| start >= finish } \
+														if !supply[dom].nil?
+  end
+
+  # スケジューリング単位（タイムウィンドウを持たないユーザドメインは，
+  # アイドルドメインにまとめられる）
+  unit = lambda do |dom|
+    if som.nil? || $domKind[dom] == "idle"
+      "idle"
+    else
+      dom
+    end
+  end
+
+  # タイムウィンドウの使用率
+  if !som.nil?
+    windows.each_with_index do |(dom, start, finish), index|
+      share = supply[dom].inject(0) {|sum, (s, f)| sum + f - s }
+      load = utilization($analyzed.select {|name| \
+							$taskData[name][:dom] == dom }) * cycle / share
+      mark = (load > 1.0) ? "  ** overloaded" : ""
+      $infeasible = true if load > 1.0
+      puts("  window #{index + 1}: #{dom} [#{start}, #{finish}) " \
+						"load #{percent(load)}#{mark}")
+    end
+    idleTasks = $analyzed.select {|name| \
+						$domKind[$taskData[name][:dom]] == "idle" }
+    if idleStart < cycle
+      load = utilization(idleTasks) * cycle / (cycle - idleStart)
+      mark = (load > 1.0) ? "  ** overloaded" : ""
+      $infeasible = true if load > 1.0
+      puts("  idle window: [#{idleStart}, #{cycle}) " \
+						"load #{percent(load)}#{mark}")
+    end
+  end
+  kernelTasks = $analyzed.select {|name| $taskData[name][:dom] == "kernel" }
+  puts("  kernel domain: utilization #{percent(utilization(kernelTasks))}")
+  if som.nil?
+    load = utilization($analyzed)
+    mark = (load > 1.0) ? "  ** overloaded" : ""
+    $infeasible = true if load > 1.0
+    puts("  total: utilization #{percent(load)}#{mark}")
+  end
+
+  # タスク毎の最悪応答時間
+  $analyzed.each do |name|
+    params = $taskData[name]
+    dom = params[:dom]
+    line = "  #{name} (#{dom}, pri #{params[:pri]}): C=#{params[:wcet]} " \
+				"T=#{params[:period]} D=#{params[:deadline]}"
+    if $domKind[dom] == "edf" && !som.nil?
+      puts("#{line}: EDF domain, checked by window load only")
+      next
+    end
+    if !supply[dom].nil? && supply[dom].empty?
+      if $domKind[dom] == "idle"
+        puts("#{line}: ** no idle window in this mode")
+      else
+        puts("#{line}: ** no time window in this mode")
+      end
+      $infeasible = true
+      next
+    end
+
+    # 干渉するタスク：同じスケジューリング単位で優先度が同じか高いタ
+    # スクと，優先度が同じか高いカーネルドメインのタスク．カーネルド
+    # メインのタスクに対しては，優先度が高いユーザドメインのタスクも
+    # 干渉するものとする．
+    interferers = $analyzed.select do |other|
+      oparams = $taskData[other]
+      next false if other == name
+      if dom == "kernel"
+        (oparams[:dom] == "kernel" && oparams[:pri] <= params[:pri]) \
+							|| (oparams[:dom] != "kernel" \
+									&& oparams[:pri] < params[:pri])
+      else
+        oparams[:pri] <= params[:pri] \
+					&& (oparams[:dom] == "kernel" \
+						|| unit.call(oparams[:dom]) == unit.call(dom))
+      end
+    end
+
+    response = responseTime(name, interferers, supply[dom], cycle)
+    if response.nil?
+      puts("#{line}: R > D  ** deadline miss")
+      $infeasible = true
+    else
+      puts("#{line}: R=#{response}")
+    end
+  end
+end
+
+if $scyctim == 0 || $somList.empty?
+  puts("no temporal partitioning")
+  analyzeMode(nil)
+else
+  puts("system cycle: #{$scyctim}")
+  $somList.each do |som|
+    attr = $somData[som][:inisom] ? "initial, " : ""
+    puts("#{som} (#{attr}next #{$somData[som][:nxtsom]}):")
+    analyzeMode(som)
+  end
+end
+
+$warnings.each do |message|
+  $stderr.puts("schedcheck.rb: #{message}")
+end
+exit($infeasible ? 1 : 0)
@@ -0,0 +1,156 @@
+#!/usr/bin/env ruby
+# -*- coding: utf-8 -*-
+#
+#  TOPPERS Software
+#      Toyohashi Open Platform for Embedded Real-Time Systems
+# 
+#  Copyright (C) 2026 by agent
+# 
+#  上記著作権者は，以下の(1)〜(4)の条件を満たす場合に限り，本ソフトウェ
+#  ア（本ソフトウェアを改変したものを含む．以下同じ）を使用・複製・改
+#  変・再配布（以下，利用と呼ぶ）することを無償で許諾する．
+#  (1) 本ソフトウェアをソースコードの形で利用する場合には，上記の著作
+#      権表示，この利用条件および下記の無保証規定が，そのままの形でソー
+#      スコード中に含まれていること．
+#  (2) 本ソフトウェアを，ライブラリ形式など，他のソフトウェア開発に使
+#      用できる形で再配布する場合には，再配布に伴うドキュメント（利用
+#      者マニュアルなど）に，上記の著作権表示，この利用条件および下記
+#      の無保証規定を掲載すること．
+#  (3) 本ソフトウェアを，機器に組み込むなど，他のソフトウェア開発に使
+#      用できない形で再配布する場合には，次のいずれかの条件を満たすこ
+#      と．
+#    (a) 再配布に伴うドキュメント（利用者マニュアルなど）に，上記の著
+#        作権表示，この利用条件および下記の無保証規定を掲載すること．
+#    (b) 再配布の形態を，別に定める方法によって，TOPPERSプロジェクトに
+#        報告すること．
+#  (4) 本ソフトウェアの利用により直接的または間接的に生じるいかなる損
+#      害からも，上記著作権者およびTOPPERSプロジェクトを免責すること．
+#      また，本ソフトウェアのユーザまたはエンドユーザからのいかなる理
+#      由に基づく請求からも，上記著作権者およびTOPPERSプロジェクトを
+#      免責すること．
+# 
+#  本ソフトウェアは，無保証で提供されているものである．上記著作権者お
+#  よびTOPPERSプロジェクトは，本ソフトウェアに関して，特定の使用目的
+#  に対する適合性も含めて，いかなる保証も行わない．また，本ソフトウェ
+#  アの利用により直接的または間接的に生じたいかなる損害に関しても，そ
+#  の責任を負わない．
+# 
+#  $Id$
+# 
+
+#
+#		スタック領域のサイズの推奨値を求めるツール
+#
+#  USE_STACK_WATERMARKをマクロ定義して構築したカーネルで，スタック使用
+#  量出力サービス（syssvc/stkmon.c）が出力したシステムログを読み込み，
+#  タスク毎の最大使用量に余裕を加えた値を，CRE_TSKに記述するスタック領
+#  域のサイズの推奨値として出力する．
+#
+#  使用方法：stksize.rb [-m 余裕（%）] [-u 丸めの単位] [-c kernel_cfg.h]
+#									[ログファイル ...]
+#
+#  -cでkernel_cfg.hを指定すると，タスクIDをタスク名で表示する．ログフ
+#  ァイルを指定しない場合には，標準入力から読み込む．
+#
+
+Encoding.default_external = 'utf-8'
+require "optparse"
+
+#
+#  オプションの処理
+#
+$margin = 20
+$unit = 8
+$cfgFile = nil
+
+OptionParser.new do |opt|
+  opt.banner = "Usage: stksize.rb [options] [logfile ...]"
+  opt.on("-m", "--margin PERCENT", Integer,
+				"margin added to the measured usage (%)") do |val|
+    $margin = val
+  end
+  opt.on("-u", "--unit BYTES", Integer,
+				"unit to which suggested sizes are rounded up") do |val|
+    $unit = val
+  end
+  opt.on("-c", "--cfg-header FILE", "kernel_cfg.h to look up task names") do |val|
+    $cfgFile = val
+  end
+  opt.parse!(ARGV)
+end
+
+#
+#  推奨値の計算（使用量に余裕を加え，丸めの単位に切り上げる）
+#
+def suggestSize(used)
+  size = (used * (100 + $margin) + 99) / 100
+  return((size + $unit - 1) / $unit * $unit)
+end
+
+#
+#  タスク名の読込み
+#
+$taskName = {}
+if !$cfgFile.nil?
+  File.open($cfgFile) do |file|
+    file.each_line do |line|
+      if /^#define\s+(\w+)\s+(\d+)\s*$/ =~ line
+        name, value = $1, $2.to_i
+        $taskName[value] ||= name if name !~ /^TNUM_/
+      end
+    end
+  end
+end
+
+#
+#  システムログの読込み
+#
+#  ログが複数回出力されている場合には，それぞれの最大値を用いる．
+#
+$istk = nil
+$task = {}
+ARGF.each_line do |line|
+  case line
+  when /stack: istk (\d+) \/ (\d+)/
+    used, size = $1.to_i, $2.to_i
+    if $istk.nil? || used > $istk[0]
+      $istk = [ used, size ]
+    end
+  when /stack: task (\d+) sstk (\d+) \/ (\d+) ustk (\d+) \/ (\d+)/
+    tskid = $1.to_i
+    data = [ $2.to_i, $3.to_i, $4.to_i, $5.to_i ]
+    if $task.has_key?(tskid)
+      data[0] = [ data[0], $task[tskid][0] ].max
+      data[2] = [ data[2], $task[tskid][2] ].max
+    end
+    $task[tskid] = data
+  end
+end
+
+if $istk.nil? && $task.empty?
+  abort("stksize.rb: no stack usage report is found")
+end
+
+#
+#  推奨値の出力
+#
+#  ユーザタスクでは，CRE_TSKのstkszがユーザスタック領域，sstkszがシス
+#  テムスタック領域のサイズである．システムタスクでは，stkszがシステム
+#  スタック領域のサイズである．
+#
+$task.keys.sort.each do |tskid|
+  sused, ssize, uused, usize = $task[tskid]
+  name = $taskName.fetch(tskid, "task #{tskid}")
+  if usize > 0
+    puts("#{name}: stksz = #{suggestSize(uused)} " \
+				"(used #{uused} of #{usize}), sstksz = #{suggestSize(sused)} " \
+				"(used #{sused} of #{ssize})")
+  else
+    puts("#{name}: stksz = #{suggestSize(sused)} (used #{sused} of #{ssize})")
+  end
+end
+if !$istk.nil?
+  puts("DEF_ICS: istksz = #{suggestSize($istk[0])} " \
+				"(used #{$istk[0]} of #{$istk[1]}; filled below " \
+				"the startup frame only)")
+end